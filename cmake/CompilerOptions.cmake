@@ -132,7 +132,7 @@ elseif(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
     endif()
 endif()
 
-# 프로파일링 옵션
+# 프로파일링 옵션 (gprof 계측)
 if(ENABLE_PROFILING)
     message(STATUS "Profiling support enabled")
     if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
@@ -144,6 +144,12 @@ if(ENABLE_PROFILING)
     endif()
 endif()
 
+# utils/Profiler.h의 PROFILE_* 구간 계측 (-pg 없이 켤 수 있도록 별도 옵션, 꺼져 있으면 매크로가 비어 있음)
+if(ENABLE_PROFILER_ZONES)
+    message(STATUS "Profiler zones enabled")
+    add_compile_definitions(ENABLE_PROFILER_ZONES)
+endif()
+
 # C++ 기능 정의
 add_compile_definitions(
     $<$<CONFIG:Debug>:DEBUG_BUILD>
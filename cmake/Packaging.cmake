@@ -158,6 +158,11 @@ install(DIRECTORY ${CMAKE_SOURCE_DIR}/assets/
     PATTERN ".gitkeep" EXCLUDE
 )
 
+# 셰이더 파일 설치
+install(DIRECTORY ${CMAKE_SOURCE_DIR}/shaders/
+    DESTINATION bin/shaders
+)
+
 # 문서 파일 설치
 install(FILES 
     ${CMAKE_SOURCE_DIR}/README.md
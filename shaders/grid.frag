@@ -2,47 +2,47 @@
 
 in vec2 vWorldPos;
 
-uniform float uGridSize;
 uniform vec4 uGridColor;
-uniform vec4 uSubGridColor;
-uniform vec2 uCameraPos;
-uniform float uZoom;
+uniform float uGridOpacity;
+uniform float uPixelsPerCell;   // 셀 한 칸의 화면 픽셀 수 (줌에 비례)
+uniform vec4 uGridBounds;       // (minX, minY, maxX, maxY) 셀 좌표, 경계 없는 그리드면 무시
+uniform int uBounded;
 
 out vec4 fragColor;
 
-float grid(vec2 pos, float size) {
-    vec2 grid = abs(fract(pos / size - 0.5) - 0.5) / fwidth(pos / size);
-    return 1.0 - min(min(grid.x, grid.y), 1.0);
+// 선 간격 spacing인 격자에서 이 픽셀의 선 커버리지 (약 1픽셀 두께, fwidth로 안티앨리어싱)
+float gridLine(vec2 pos, float spacing) {
+    vec2 coord = pos / spacing;
+    vec2 dist = abs(fract(coord - 0.5) - 0.5) / fwidth(coord);
+    return 1.0 - min(min(dist.x, dist.y), 1.0);
+}
+
+float axisLine(vec2 pos) {
+    vec2 dist = abs(pos) / fwidth(pos);
+    return 1.0 - min(min(dist.x, dist.y), 1.0);
 }
 
 void main() {
-    // Calculate major (10x) and minor grid lines
-    float majorGrid = grid(vWorldPos, uGridSize * 10.0);
-    float minorGrid = grid(vWorldPos, uGridSize);
+    if (uBounded != 0 &&
+        (vWorldPos.x < uGridBounds.x || vWorldPos.y < uGridBounds.y ||
+         vWorldPos.x > uGridBounds.z || vWorldPos.y > uGridBounds.w)) {
+        discard;
+    }
     
-    // Mix colors based on grid type
-    vec4 color = mix(uSubGridColor, uGridColor, majorGrid);
-    float alpha = max(majorGrid, minorGrid * 0.5);
+    // 선 사이가 MIN_SPACING 픽셀보다 좁아지면 10배 간격 단계로 넘어가며,
+    // 단계 사이에서는 가는 선을 서서히 흐리게 함
+    const float MIN_SPACING = 8.0;
+    float lod = max(0.0, log(MIN_SPACING / uPixelsPerCell) / log(10.0));
+    float level = floor(lod);
+    float fade = 1.0 - fract(lod);
     
-    // Distance-based fade
-    float dist = length(vWorldPos - uCameraPos);
-    float fadeStart = 100.0 / max(uZoom, 0.1);
-    float fadeEnd = 200.0 / max(uZoom, 0.1);
-    alpha *= 1.0 - smoothstep(fadeStart, fadeEnd, dist);
+    float minorSpacing = pow(10.0, level);
+    float minor = gridLine(vWorldPos, minorSpacing) * fade;
+    float major = gridLine(vWorldPos, minorSpacing * 10.0);
     
-    // Axis highlighting
-    float axisThickness = 2.0 / uZoom;
-    float xAxis = 1.0 - smoothstep(0.0, axisThickness, abs(vWorldPos.y));
-    float yAxis = 1.0 - smoothstep(0.0, axisThickness, abs(vWorldPos.x));
+    // 기존 CPU 그리드와 같은 강도: 보조선 0.5, 10칸 선 1.0, 원점 축 1.5
+    float intensity = max(minor * 0.5, major * mix(0.5, 1.0, fade));
+    intensity = max(intensity, axisLine(vWorldPos) * 1.5);
     
-    if (xAxis > 0.0) {
-        color = mix(color, vec4(1.0, 0.0, 0.0, 1.0), xAxis);
-        alpha = max(alpha, xAxis);
-    }
-    if (yAxis > 0.0) {
-        color = mix(color, vec4(0.0, 1.0, 0.0, 1.0), yAxis);
-        alpha = max(alpha, yAxis);
-    }
-    
-    fragColor = vec4(color.rgb, color.a * alpha);
-}
\ No newline at end of file
+    fragColor = vec4(uGridColor.rgb, uGridColor.a * uGridOpacity * intensity);
+}
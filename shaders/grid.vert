@@ -2,8 +2,6 @@
 
 layout(location = 0) in vec2 aPosition;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
 uniform mat4 uInvViewProj;
 
 out vec2 vWorldPos;
@@ -12,7 +10,7 @@ void main() {
     // Full screen quad in clip space
     gl_Position = vec4(aPosition * 2.0 - 1.0, 0.0, 1.0);
     
-    // Calculate world position for fragment shader
+    // 직교 투영이므로 정점에서 역변환 후 보간해도 정확함
     vec4 worldPos = uInvViewProj * gl_Position;
     vWorldPos = worldPos.xy / worldPos.w;
-}
\ No newline at end of file
+}
@@ -20,7 +20,10 @@
 #include "../input/InputManager.h"
 #include "../input/WireInputHandler.h"
 #include "../simulation/CircuitSimulator.h"
+#include "../ui/ProfilerPanel.h"
+#include "../utils/Profiler.h"
 #include <imgui.h>
+#include <cmath>
 #include <iostream>
 
 Application::Application()
@@ -66,7 +69,9 @@ bool Application::initialize(const AppConfig& config) {
     }
     
     m_eventSystem = std::make_unique<EventSystem>();
+    m_profilerPanel = std::make_unique<ProfilerPanel>();
     m_timer = std::make_unique<Timer>(config.targetFPS);
+    m_profilerPanel->setTimer(m_timer.get());
     
     m_camera = std::make_unique<Camera>(config.windowWidth, config.windowHeight);
     m_gridRenderer = std::make_unique<GridRenderer>();
@@ -93,16 +98,27 @@ bool Application::initialize(const AppConfig& config) {
     // Grid 시스템 생성 및 연결
     Grid* gridSystem = new Grid();
     m_placementManager->initialize(m_circuit.get(), m_gridMap.get(), gridSystem, m_cellWireManager.get());
-    m_selectionManager->initialize(m_circuit.get(), m_gridMap.get(), gridSystem);
+    m_selectionManager->initialize(m_circuit.get(), m_gridMap.get(), gridSystem, m_cellWireManager.get());
     m_gatePaletteUI->initialize(m_placementManager.get(), m_selectionManager.get());
     
     // WireManager 초기화
+    m_wireManager->setGridMap(m_gridMap.get());
     m_wireManager->initialize();
     
     // CircuitSimulator 초기화
     m_circuitSimulator = std::make_unique<simulation::CircuitSimulator>(m_circuit.get());
     m_circuitSimulator->setCellWireManager(m_cellWireManager.get());  // CellWireManager 연결
+    m_circuitSimulator->addMemoryCollector([this](MemoryReport& report) {
+        if (m_renderManager) {
+            m_renderManager->CollectMemoryUsage(report);
+        }
+    });
     m_circuitSimulator->initialize();
+    if (m_config.idleSimulation) {
+        m_timer->setIdleWork([this](float remainingSeconds) {
+            return m_circuitSimulator && m_circuitSimulator->runIdleStep(remainingSeconds);
+        });
+    }
     m_circuitSimulator->start(); // 시뮬레이션 시작
     
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Gate Placement System initialized successfully");
@@ -124,7 +140,12 @@ bool Application::initialize(const AppConfig& config) {
                     m_cellWireManager->onDragStart(glm::vec2(e.startWorld.x, e.startWorld.y));
                     break;
                 case Input::DragPhase::Move:
-                    m_cellWireManager->onDragMove(glmWorldPos);
+                    // 프레임 동안 모인 이동 경로 전체를 따라가야 빠른 드래그에서도 셀이 빠지지 않음
+                    if (e.path && e.pathLength > 0) {
+                        m_cellWireManager->onDragPath(e.path, e.pathLength);
+                    } else {
+                        m_cellWireManager->onDragMove(glmWorldPos);
+                    }
                     break;
                 case Input::DragPhase::End:
                     m_cellWireManager->onDragEnd(glmWorldPos);
@@ -143,6 +164,10 @@ bool Application::initialize(const AppConfig& config) {
     
     m_inputManager->subscribe<Input::HoverEvent>([this](const Input::HoverEvent& e) {
         if (m_wireManager) {
+            if (m_camera) {
+                glm::vec4 bounds = m_camera->GetVisibleBounds();
+                m_wireManager->setVisibleRegion(Vec2{bounds.x, bounds.y}, Vec2{bounds.z, bounds.w});
+            }
             Vec2 worldPos{e.worldPos.x, e.worldPos.y};
             m_wireManager->onMouseMove(worldPos);
         }
@@ -287,12 +312,24 @@ bool Application::initializeImGui() {
 void Application::run() {
     SDL_Log("Main loop started");
     
+    PROFILE_THREAD("Main");
+    
     while (m_running) {
+        PROFILE_FRAME();
         m_timer->beginFrame();
         
-        handleEvents();
-        update(m_timer->getDeltaTime());
-        render();
+        {
+            PROFILE_SCOPE("Application::handleEvents");
+            handleEvents();
+        }
+        {
+            PROFILE_SCOPE("Application::update");
+            update(m_timer->getDeltaTime());
+        }
+        {
+            PROFILE_SCOPE("Application::render");
+            render();
+        }
         
         m_timer->endFrame();
         regulateFrameRate();
@@ -410,6 +447,42 @@ void Application::handleEvents() {
                     }
                     break;
                     
+                case SDLK_c:
+                case SDLK_x:
+                    if (m_selectionManager && m_currentState == AppState::PLAYING &&
+                        (event.key.keysym.mod & KMOD_CTRL)) {
+                        if (event.key.keysym.sym == SDLK_x) {
+                            m_selectionManager->cutSelected();
+                        } else {
+                            m_selectionManager->copySelected();
+                        }
+                    }
+                    break;
+                    
+                case SDLK_v:
+                    if (m_selectionManager && m_camera && m_currentState == AppState::PLAYING &&
+                        (event.key.keysym.mod & KMOD_CTRL) && m_selectionManager->hasClipboard()) {
+                        // 마우스 커서 위치를 블록 원점으로 붙여넣기
+                        int mouseX = 0, mouseY = 0;
+                        SDL_GetMouseState(&mouseX, &mouseY);
+                        glm::vec2 worldPos = m_camera->ScreenToWorld(
+                            glm::vec2(static_cast<float>(mouseX), static_cast<float>(mouseY)));
+                        Vec2i origin(static_cast<int>(std::floor(worldPos.x)), 
+                                     static_cast<int>(std::floor(worldPos.y)));
+                        auto result = m_selectionManager->paste(origin);
+                        if (result.isError()) {
+                            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Paste failed, error: %d", 
+                                       (int)result.error);
+                        }
+                    }
+                    break;
+                    
+                case SDLK_F9:
+                    if (m_profilerPanel) {
+                        m_profilerPanel->toggleVisible();
+                    }
+                    break;
+                    
                 case SDLK_F11:
                     {
                         Uint32 flags = SDL_GetWindowFlags(m_window);
@@ -468,6 +541,9 @@ void Application::handleEvents() {
         if (shouldProcessEvent) {
             // Handle placement and selection mouse events
             if (m_currentState == AppState::PLAYING && !imguiCapturedMouse) {
+                if (event.type == SDL_MOUSEBUTTONDOWN) {
+                    flushPlacementMove();
+                }
                 if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_LEFT) {
                     if (m_placementManager && m_placementManager->isInPlacementMode()) {
                         // Placement mode takes priority
@@ -517,12 +593,10 @@ void Application::handleEvents() {
                         }
                     }
                 } else if (event.type == SDL_MOUSEMOTION) {
-                    if (m_placementManager && m_camera) {
-                        glm::vec2 screenPos(static_cast<float>(event.motion.x), static_cast<float>(event.motion.y));
-                        glm::vec2 worldPos = m_camera->ScreenToWorld(screenPos);
-                        Vec2 pos(worldPos.x, worldPos.y);
-                        m_placementManager->onMouseMove(pos);
-                    }
+                    // 배치 미리보기는 프레임의 마지막 위치로 한 번만 갱신
+                    m_pendingMouseMove = true;
+                    m_pendingMousePos = glm::vec2(static_cast<float>(event.motion.x),
+                                                  static_cast<float>(event.motion.y));
                 }
             }
             
@@ -538,6 +612,20 @@ void Application::handleEvents() {
             m_eventSystem->processEvent(event);
         }
     }
+    
+    flushPlacementMove();
+}
+
+void Application::flushPlacementMove() {
+    if (!m_pendingMouseMove) {
+        return;
+    }
+    m_pendingMouseMove = false;
+    
+    if (m_currentState == AppState::PLAYING && m_placementManager && m_camera) {
+        glm::vec2 worldPos = m_camera->ScreenToWorld(m_pendingMousePos);
+        m_placementManager->onMouseMove(Vec2(worldPos.x, worldPos.y));
+    }
 }
 
 void Application::update(float deltaTime) {
@@ -561,8 +649,14 @@ void Application::update(float deltaTime) {
         m_cellWireManager->updateSignals();
     }
     
+    // 이후 UI 구성 전체를 ImGui 구간으로 계측
+    PROFILE_SCOPE("ImGui::Build");
     m_imguiManager->BeginFrame();
     
+    if (m_profilerPanel) {
+        m_profilerPanel->render();
+    }
+    
     static bool editorInitialized = false;
     
     // Debug: Always show state
@@ -747,6 +841,19 @@ void Application::update(float deltaTime) {
                                     m_selectionManager->deleteSelected();
                                 }
                             }
+                            if (ImGui::MenuItem("Copy", "Ctrl+C")) {
+                                m_selectionManager->copySelected();
+                            }
+                            if (ImGui::MenuItem("Cut", "Ctrl+X")) {
+                                m_selectionManager->cutSelected();
+                            }
+                            ImGui::Separator();
+                        }
+                        
+                        if (m_selectionManager && m_selectionManager->hasClipboard()) {
+                            if (ImGui::MenuItem("Paste", "Ctrl+V")) {
+                                m_selectionManager->paste(m_contextMenuGridPos);
+                            }
                             ImGui::Separator();
                         }
                         
@@ -847,12 +954,20 @@ void Application::render() {
     
     // Render the grid and circuit first
     if (m_renderManager && m_circuit && (m_currentState == AppState::PLAYING || m_currentState == AppState::EDITOR)) {
+        // 적응형 품질 조절 결과를 렌더러에 반영 (레벨은 이전 프레임들의 작업 시간으로 결정됨)
+        if (m_circuitSimulator) {
+            const simulation::QualitySettings& quality = m_circuitSimulator->getQualitySettings();
+            m_renderManager->SetSignalAnimation(quality.signalAnimations);
+            m_renderManager->SetDrawPorts(quality.drawPorts);
+            m_renderManager->SetLodThreshold(quality.lodPixelsPerCell);
+        }
+        
         m_renderManager->BeginFrame();
         m_renderManager->RenderCircuit(*m_circuit);
         
         // CellWire 렌더링
         if (m_cellWireManager) {
-            m_renderManager->RenderCellWires(m_cellWireManager->getAllWires());
+            m_renderManager->RenderCellWires(*m_cellWireManager);
         }
         
         m_renderManager->EndFrame();
@@ -889,7 +1004,15 @@ void Application::render() {
     // Removed repetitive rendering logs
     
     // Render ImGui on top of everything else
-    m_imguiManager->EndFrame();
+    {
+        PROFILE_SCOPE("ImGui::Render");
+        m_imguiManager->EndFrame();
+    }
+    
+    // 부하는 vsync/프레임 제한 대기를 뺀 작업 시간, 조절기 시간축은 실제 프레임 간격
+    if (m_circuitSimulator) {
+        m_circuitSimulator->recordFrameTime(m_timer->getFrameElapsed() * 1000.0f, m_timer->getDeltaTime());
+    }
     
     SDL_GL_SwapWindow(m_window);
 }
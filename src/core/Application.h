@@ -22,6 +22,7 @@ class GridMap;
 class GatePaletteUI;
 class WireManager;
 class CellWireManager;
+class ProfilerPanel;
 
 namespace simulation {
     class CircuitSimulator;
@@ -47,6 +48,7 @@ struct AppConfig {
     bool fullscreen = false;
     bool vsync = true;
     int targetFPS = 60;
+    bool idleSimulation = false;    // 프레임 제한 대기 시간에 잠 대신 밀린 시뮬레이션 스텝 처리
     int glMajorVersion = 3;
     int glMinorVersion = 3;
 };
@@ -79,6 +81,7 @@ private:
     void createDemoCircuit();
     
     void handleEvents();
+    void flushPlacementMove();
     void update(float deltaTime);
     void render();
     void regulateFrameRate();
@@ -99,6 +102,7 @@ private:
     std::unique_ptr<EventSystem> m_eventSystem;
     std::unique_ptr<Timer> m_timer;
     std::unique_ptr<ImGuiManager> m_imguiManager;
+    std::unique_ptr<ProfilerPanel> m_profilerPanel;     // F9로 표시 (구간 타임라인, Chrome trace 내보내기)
     
     std::unique_ptr<GridRenderer> m_gridRenderer;
     std::unique_ptr<Camera> m_camera;
@@ -121,6 +125,10 @@ private:
     float m_fpsUpdateTimer;
     float m_currentFPS;
     
+    // 프레임 동안 받은 마지막 마우스 위치 (배치 미리보기를 프레임당 한 번 갱신)
+    bool m_pendingMouseMove{false};
+    glm::vec2 m_pendingMousePos{0, 0};
+    
     // Context menu state
     bool m_showContextMenu{false};
     glm::vec2 m_contextMenuPos{0, 0};
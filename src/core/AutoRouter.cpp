@@ -0,0 +1,689 @@
+#include "AutoRouter.h"
+#include "core/Circuit.h"
+#include "core/Gate.h"
+#include "core/CellWireManager.h"
+#include "../utils/JobSystem.h"
+#include <SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    constexpr int64_t MAX_REGION_CELLS = 1 << 24;
+    constexpr int TILE_SIZE = 16;  // 병렬 묶음을 나눌 때 쓰는 타일 크기
+
+    constexpr uint8_t DIR_UP = static_cast<uint8_t>(WireDirection::Up);
+    constexpr uint8_t DIR_RIGHT = static_cast<uint8_t>(WireDirection::Right);
+    constexpr uint8_t DIR_DOWN = static_cast<uint8_t>(WireDirection::Down);
+    constexpr uint8_t DIR_LEFT = static_cast<uint8_t>(WireDirection::Left);
+
+    constexpr GateId SHARED_CELL = ~GateId{0};  // 두 게이트 이상의 몸체/포트가 걸친 셀
+
+    // 출력 포트가 걸친 셀 (CellWireManager::updateSignals와 같은 규칙)
+    Vec2i outputCell(const Gate& gate) noexcept {
+        Vec2 pos = gate.getOutputPortPosition();
+        return Vec2i{
+            static_cast<int32_t>(std::floor(pos.x)),
+            static_cast<int32_t>(std::floor(pos.y))
+        };
+    }
+
+    // 입력 포트가 걸친 셀 (CellWireManager::checkGateInputs와 같은 규칙)
+    Vec2i inputCell(const Gate& gate, PortIndex port) noexcept {
+        Vec2 pos = gate.getInputPortPosition(port);
+        return Vec2i{
+            static_cast<int32_t>(std::floor(pos.x)),
+            static_cast<int32_t>(std::floor(pos.y))
+        };
+    }
+
+    int manhattan(Vec2i a, Vec2i b) noexcept {
+        return std::abs(a.x - b.x) + std::abs(a.y - b.y);
+    }
+}
+
+// 스레드별 탐색 버퍼: 넷 탐색 창 크기에 맞춰 늘리고 세대 스탬프로 재사용
+struct AutoRouter::Worker {
+    struct OpenEntry {
+        float f;
+        int32_t cell;
+    };
+
+    int x0{0};
+    int y0{0};
+    int width{0};
+    int height{0};
+    uint32_t generation{0};
+
+    std::vector<uint32_t> openStamp;
+    std::vector<uint32_t> closedStamp;
+    std::vector<uint32_t> treeStamp;
+    std::vector<uint32_t> dirStamp;
+    std::vector<float> gCost;
+    std::vector<int32_t> parent;
+    std::vector<uint8_t> dirs;
+    std::vector<int32_t> treeCells;
+    std::vector<OpenEntry> heap;
+
+    void begin(int wx0, int wy0, int w, int h) {
+        x0 = wx0;
+        y0 = wy0;
+        width = w;
+        height = h;
+
+        const size_t count = static_cast<size_t>(w) * h;
+        if (openStamp.size() < count) {
+            openStamp.resize(count, 0);
+            closedStamp.resize(count, 0);
+            treeStamp.resize(count, 0);
+            dirStamp.resize(count, 0);
+            gCost.resize(count, 0.0f);
+            parent.resize(count, -1);
+            dirs.resize(count, 0);
+        }
+
+        if (++generation == 0) {
+            std::fill(openStamp.begin(), openStamp.end(), 0);
+            std::fill(closedStamp.begin(), closedStamp.end(), 0);
+            std::fill(treeStamp.begin(), treeStamp.end(), 0);
+            std::fill(dirStamp.begin(), dirStamp.end(), 0);
+            generation = 1;
+        }
+
+        treeCells.clear();
+        heap.clear();
+    }
+
+    // 탐색을 새로 시작할 때마다 열린/닫힌 목록만 초기화 (트리/경로 정보는 유지)
+    void beginSearch() {
+        if (++generation == 0) {
+            std::fill(openStamp.begin(), openStamp.end(), 0);
+            std::fill(closedStamp.begin(), closedStamp.end(), 0);
+            generation = 1;
+        }
+        heap.clear();
+    }
+};
+
+AutoRouter::AutoRouter(Circuit* circuit) noexcept
+    : m_circuit(circuit) {
+}
+
+AutoRouter::~AutoRouter() = default;
+
+Result<AutoRouteStats> AutoRouter::route(
+    const std::vector<RouteRequest>& requests,
+    CellWireManager& wires,
+    const AutoRouterConfig& config) noexcept {
+
+    auto startTime = std::chrono::steady_clock::now();
+    AutoRouteStats stats;
+    stats.connections = requests.size();
+
+    if (!m_circuit) {
+        return Result<AutoRouteStats>{stats, ErrorCode::NOT_INITIALIZED};
+    }
+    if (requests.empty()) {
+        return Result<AutoRouteStats>{stats};
+    }
+
+    ErrorCode error = buildRegion(requests, wires, config, stats);
+    if (error != ErrorCode::SUCCESS) {
+        return Result<AutoRouteStats>{stats, error};
+    }
+
+    unsigned threadCount = config.threadCount;
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // 워커 스레드는 스레드 수가 바뀔 때만 새로 만들고, 반복/묶음마다 같은 풀을 재사용
+    if (!m_jobs || m_jobs->GetWorkerCount() != threadCount) {
+        m_jobs.reset();
+        m_jobs = std::make_unique<JobSystem>(threadCount);
+    }
+    if (m_workers.size() < m_jobs->GetWorkerCount()) {
+        m_workers.resize(m_jobs->GetWorkerCount());
+    }
+
+    // 협상 반복: 과사용 셀이 있는 넷만 뜯어내고 다시 배선
+    float presentFactor = config.presentFactor;
+    size_t overused = 0;
+    size_t bestOverused = SIZE_MAX;
+    int stalledIterations = 0;
+    std::vector<size_t> pending;
+    for (int iteration = 1; iteration <= config.maxIterations; ++iteration) {
+        pending.clear();
+        for (size_t i = 0; i < m_nets.size(); ++i) {
+            if (m_nets[i].dirty) {
+                pending.push_back(i);
+            }
+        }
+        if (pending.empty()) {
+            break;
+        }
+
+        stats.iterations = iteration;
+        routeNets(pending, presentFactor);
+        overused = updateCongestion(config.historyFactor);
+
+        SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION,
+                     "[AutoRouter] Iteration %d: routed %zu nets, %zu overused cells",
+                     iteration, pending.size(), overused);
+
+        // 셀 와이어는 교차할 수 없어 평면으로 풀리지 않는 넷이 있으면 끝까지 수렴하지 않음
+        if (overused < bestOverused) {
+            bestOverused = overused;
+            stalledIterations = 0;
+        } else if (++stalledIterations >= config.maxStalledIterations) {
+            break;
+        }
+
+        presentFactor *= config.presentGrowth;
+    }
+
+    if (overused > 0) {
+        legalize();
+    }
+
+    std::vector<CellWire> cellWires;
+    std::vector<GateConnection> connections;
+
+    for (const Net& net : m_nets) {
+        for (size_t i = 0; i < net.cells.size(); ++i) {
+            int32_t cell = net.cells[i];
+
+            CellWire wire;
+            wire.cellPos = Vec2{
+                static_cast<float>(m_origin.x + cell % m_width),
+                static_cast<float>(m_origin.y + cell / m_width)
+            };
+            wire.connections = static_cast<WireDirection>(net.dirs[i]);
+            wire.exists = true;
+            cellWires.push_back(wire);
+        }
+
+        for (size_t i = 0; i < net.sinks.size(); ++i) {
+            if (!net.sinkRouted[i]) {
+                continue;
+            }
+            ++stats.routedConnections;
+            const RouteRequest& request = requests[net.requests[i]];
+            connections.push_back(GateConnection{request.fromGate, request.toGate, request.toPort});
+        }
+    }
+
+    stats.failedConnections = stats.connections - stats.routedConnections;
+    stats.wireCells = cellWires.size();
+
+    wires.mergeWires(cellWires);
+    if (config.connectCircuit && !connections.empty()) {
+        m_circuit->connectGatesBatch(connections);
+    }
+
+    stats.elapsedMs = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+                "[AutoRouter] Routed %zu/%zu connections (%zu nets, %zu cells) in %d iterations, %.1f ms",
+                stats.routedConnections, stats.connections, stats.nets,
+                stats.wireCells, stats.iterations, stats.elapsedMs);
+
+    return Result<AutoRouteStats>{stats};
+}
+
+ErrorCode AutoRouter::buildRegion(const std::vector<RouteRequest>& requests,
+                                  const CellWireManager& wires,
+                                  const AutoRouterConfig& config,
+                                  AutoRouteStats& stats) noexcept {
+    m_nets.clear();
+
+    // 출력 게이트별로 넷 구성
+    struct Terminal {
+        size_t net;
+        size_t request;
+        Vec2i cell;
+    };
+    std::unordered_map<GateId, size_t> netByGate;
+    std::vector<Vec2i> sources;
+    std::vector<GateId> sourceGates;
+    std::vector<Terminal> sinks;
+    sinks.reserve(requests.size());
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const RouteRequest& request = requests[i];
+        const Gate* from = m_circuit->getGate(request.fromGate);
+        const Gate* to = m_circuit->getGate(request.toGate);
+        if (!from || !to || request.toPort < 0 || request.toPort >= Constants::MAX_INPUT_PORTS) {
+            continue;
+        }
+
+        auto [it, inserted] = netByGate.try_emplace(request.fromGate, m_nets.size());
+        if (inserted) {
+            m_nets.emplace_back();
+            sources.push_back(outputCell(*from));
+            sourceGates.push_back(request.fromGate);
+        }
+        sinks.push_back(Terminal{it->second, i, inputCell(*to, request.toPort)});
+    }
+
+    stats.nets = m_nets.size();
+    if (m_nets.empty()) {
+        return ErrorCode::INVALID_ID;
+    }
+
+    // 영역: 모든 단자의 경계 상자 + 넷 여유가 몇 번 늘어날 만큼의 공간
+    Vec2i min = sources.front();
+    Vec2i max = sources.front();
+    auto extend = [&](Vec2i p) {
+        min = Vec2i{std::min(min.x, p.x), std::min(min.y, p.y)};
+        max = Vec2i{std::max(max.x, p.x), std::max(max.y, p.y)};
+    };
+    for (Vec2i p : sources) extend(p);
+    for (const Terminal& t : sinks) extend(t.cell);
+
+    const int regionMargin = std::max(1, config.searchMargin) * 4;
+    m_origin = Vec2i{min.x - regionMargin, min.y - regionMargin};
+    const int64_t width = static_cast<int64_t>(max.x) - min.x + 1 + 2 * regionMargin;
+    const int64_t height = static_cast<int64_t>(max.y) - min.y + 1 + 2 * regionMargin;
+    if (width * height > MAX_REGION_CELLS) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "[AutoRouter] Routing region %lldx%lld is too large",
+                    static_cast<long long>(width), static_cast<long long>(height));
+        return ErrorCode::OUT_OF_BOUNDS;
+    }
+    m_width = static_cast<int>(width);
+    m_height = static_cast<int>(height);
+
+    const size_t cellCount = static_cast<size_t>(width * height);
+    m_blocked.assign(cellCount, 0);
+    m_terminalOwner.assign(cellCount, 0);
+    m_occupancy.assign(cellCount, 0);
+    m_history.assign(cellCount, 0.0f);
+
+    // 게이트 몸체/포트 셀의 주인 게이트: 셀 와이어는 셀 단위로 포트에 붙으므로
+    // 이 셀은 해당 포트를 단자로 쓰는 넷만 지날 수 있음
+    std::vector<GateId> cellGate(cellCount, Constants::INVALID_GATE_ID);
+    auto reserveCell = [&](Vec2i cell, GateId id) {
+        if (!inRegion(cell)) {
+            return;
+        }
+        GateId& gate = cellGate[regionIndex(cell)];
+        gate = (gate == Constants::INVALID_GATE_ID || gate == id) ? id : SHARED_CELL;
+    };
+    for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
+        const Gate& gate = it->second;
+        reserveCell(Vec2i{
+            static_cast<int32_t>(std::floor(gate.position.x)),
+            static_cast<int32_t>(std::floor(gate.position.y))
+        }, gate.id);
+        reserveCell(outputCell(gate), gate.id);
+        for (PortIndex port = 0; port < Constants::MAX_INPUT_PORTS; ++port) {
+            reserveCell(inputCell(gate, port), gate.id);
+        }
+    }
+
+    // 기존 와이어 셀은 배선 불가
+    wires.forEachWire([this](const CellWire& wire) {
+        Vec2i cell{
+            static_cast<int32_t>(std::floor(wire.cellPos.x)),
+            static_cast<int32_t>(std::floor(wire.cellPos.y))
+        };
+        if (inRegion(cell)) {
+            m_blocked[regionIndex(cell)] = 1;
+        }
+    });
+
+    // 단자 소유권: 다른 넷의 단자와 겹치는 연결은 배선하지 않음
+    for (size_t n = 0; n < m_nets.size(); ++n) {
+        Net& net = m_nets[n];
+        net.source = regionIndex(sources[n]);
+        net.min = sources[n];
+        net.max = sources[n];
+        net.margin = std::max(1, config.searchMargin);
+
+        int32_t& owner = m_terminalOwner[net.source];
+        if (owner == 0 && !m_blocked[net.source] && cellGate[net.source] == sourceGates[n]) {
+            owner = static_cast<int32_t>(n + 1);
+        } else {
+            net.source = -1;
+        }
+    }
+
+    std::sort(sinks.begin(), sinks.end(), [&](const Terminal& a, const Terminal& b) {
+        if (a.net != b.net) return a.net < b.net;
+        return manhattan(a.cell, sources[a.net]) < manhattan(b.cell, sources[b.net]);
+    });
+
+    for (const Terminal& t : sinks) {
+        Net& net = m_nets[t.net];
+        if (net.source < 0) {
+            continue;
+        }
+
+        int32_t index = regionIndex(t.cell);
+        int32_t& owner = m_terminalOwner[index];
+        if (m_blocked[index] || cellGate[index] != requests[t.request].toGate ||
+            (owner != 0 && owner != static_cast<int32_t>(t.net + 1))) {
+            continue;
+        }
+        owner = static_cast<int32_t>(t.net + 1);
+
+        net.sinks.push_back(index);
+        net.requests.push_back(t.request);
+        net.min = Vec2i{std::min(net.min.x, t.cell.x), std::min(net.min.y, t.cell.y)};
+        net.max = Vec2i{std::max(net.max.x, t.cell.x), std::max(net.max.y, t.cell.y)};
+    }
+
+    for (Net& net : m_nets) {
+        net.sinkRouted.assign(net.sinks.size(), 0);
+        net.dirty = net.source >= 0 && !net.sinks.empty();
+    }
+
+    // 어느 넷의 단자도 아닌 게이트 몸체/포트 셀은 모든 넷에 막힘
+    // (싱크가 없어 배선하지 않는 넷의 출발 셀도 포함)
+    for (size_t i = 0; i < cellCount; ++i) {
+        if (cellGate[i] == Constants::INVALID_GATE_ID) {
+            continue;
+        }
+        const int32_t owner = m_terminalOwner[i];
+        if (owner == 0 || !m_nets[owner - 1].dirty) {
+            m_terminalOwner[i] = -1;
+        }
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+void AutoRouter::netWindow(const Net& net, int& x0, int& y0, int& x1, int& y1) const noexcept {
+    x0 = std::max(0, net.min.x - m_origin.x - net.margin);
+    y0 = std::max(0, net.min.y - m_origin.y - net.margin);
+    x1 = std::min(m_width - 1, net.max.x - m_origin.x + net.margin);
+    y1 = std::min(m_height - 1, net.max.y - m_origin.y + net.margin);
+}
+
+void AutoRouter::routeNets(const std::vector<size_t>& netIndices, float presentFactor) noexcept {
+    // 탐색 창이 겹치지 않는 넷끼리 묶어 병렬로 배선: 같은 묶음의 넷은 서로 다른 셀만 건드리고,
+    // 묶음 사이에서는 점유가 바로 반영되므로 순차 배선과 같은 방식으로 수렴함
+    const int tilesX = (m_width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (m_height + TILE_SIZE - 1) / TILE_SIZE;
+    std::vector<uint32_t> tileBatch(static_cast<size_t>(tilesX) * tilesY, 0);
+    uint32_t batchId = 0;
+
+    std::vector<size_t> remaining = netIndices;
+    std::vector<size_t> deferred;
+    std::vector<size_t> batch;
+
+    while (!remaining.empty()) {
+        ++batchId;
+        batch.clear();
+        deferred.clear();
+
+        for (size_t index : remaining) {
+            int x0, y0, x1, y1;
+            netWindow(m_nets[index], x0, y0, x1, y1);
+            const int tx0 = x0 / TILE_SIZE, ty0 = y0 / TILE_SIZE;
+            const int tx1 = x1 / TILE_SIZE, ty1 = y1 / TILE_SIZE;
+
+            bool free = true;
+            for (int ty = ty0; ty <= ty1 && free; ++ty) {
+                for (int tx = tx0; tx <= tx1; ++tx) {
+                    if (tileBatch[ty * tilesX + tx] == batchId) {
+                        free = false;
+                        break;
+                    }
+                }
+            }
+            if (!free) {
+                deferred.push_back(index);
+                continue;
+            }
+
+            for (int ty = ty0; ty <= ty1; ++ty) {
+                for (int tx = tx0; tx <= tx1; ++tx) {
+                    tileBatch[ty * tilesX + tx] = batchId;
+                }
+            }
+            batch.push_back(index);
+        }
+
+        runBatch(batch, presentFactor);
+        remaining.swap(deferred);
+    }
+}
+
+void AutoRouter::runBatch(const std::vector<size_t>& netIndices, float presentFactor) noexcept {
+    // 같은 묶음의 넷은 서로 다른 셀만 건드리므로 워커별 탐색 버퍼만 나눠 쓰면 됨
+    m_jobs->ParallelFor(netIndices.size(), [&](size_t i, unsigned worker) {
+        routeNet(netIndices[i], m_workers[worker], presentFactor, false);
+    });
+}
+
+void AutoRouter::legalize() noexcept {
+    // 남은 충돌 정리: 앞선 넷부터 확정하고, 확정된 셀과 겹치는 넷은 그 셀을 막은 채 다시 배선
+    if (m_workers.empty()) {
+        m_workers.resize(1);
+    }
+    std::fill(m_occupancy.begin(), m_occupancy.end(), 0);
+
+    for (size_t i = 0; i < m_nets.size(); ++i) {
+        Net& net = m_nets[i];
+
+        bool conflict = false;
+        for (int32_t cell : net.cells) {
+            if (m_occupancy[cell] > 0) {
+                conflict = true;
+                break;
+            }
+        }
+
+        if (conflict) {
+            routeNet(i, m_workers[0], 0.0f, true);
+        } else {
+            for (int32_t cell : net.cells) {
+                ++m_occupancy[cell];
+            }
+        }
+    }
+}
+
+void AutoRouter::routeNet(size_t netIndex, Worker& worker, float presentFactor,
+                          bool legalizing) noexcept {
+    Net& net = m_nets[netIndex];
+    const int32_t owner = static_cast<int32_t>(netIndex + 1);
+
+    // 넷 경계 상자 + 여유 크기의 탐색 창 (영역으로 잘라냄)
+    int wx0, wy0, wx1, wy1;
+    netWindow(net, wx0, wy0, wx1, wy1);
+    const int ww = wx1 - wx0 + 1;
+    worker.begin(wx0, wy0, ww, wy1 - wy0 + 1);
+    const uint32_t netGeneration = worker.generation;
+
+    auto toLocal = [&](int32_t regionCell) {
+        return (regionCell / m_width - wy0) * ww + (regionCell % m_width - wx0);
+    };
+    auto toRegion = [&](int32_t localCell) {
+        return (localCell / ww + wy0) * m_width + (localCell % ww + wx0);
+    };
+
+    // 이전 경로를 뜯어냄 (정리 단계에서는 아직 점유에 들어가 있지 않음)
+    if (!legalizing) {
+        for (int32_t cell : net.cells) {
+            --m_occupancy[cell];
+        }
+    }
+
+    auto addTreeCell = [&](int32_t local) {
+        worker.treeStamp[local] = netGeneration;
+        worker.treeCells.push_back(local);
+        if (worker.dirStamp[local] != netGeneration) {
+            worker.dirStamp[local] = netGeneration;
+            worker.dirs[local] = 0;
+        }
+    };
+
+    const int32_t sourceLocal = toLocal(net.source);
+    addTreeCell(sourceLocal);
+
+    bool failed = false;
+    for (size_t s = 0; s < net.sinks.size(); ++s) {
+        const int32_t sinkLocal = toLocal(net.sinks[s]);
+        if (worker.treeStamp[sinkLocal] == netGeneration) {
+            net.sinkRouted[s] = 1;
+            continue;
+        }
+
+        const int sinkX = sinkLocal % ww;
+        const int sinkY = sinkLocal / ww;
+
+        // 현재 트리 전체를 출발점으로 하는 A*
+        worker.beginSearch();
+        const uint32_t searchGeneration = worker.generation;
+        auto push = [&](int32_t local, float g) {
+            const int x = local % ww;
+            const int y = local / ww;
+            worker.gCost[local] = g;
+            worker.openStamp[local] = searchGeneration;
+            worker.heap.push_back(Worker::OpenEntry{
+                g + static_cast<float>(std::abs(x - sinkX) + std::abs(y - sinkY)), local});
+            std::push_heap(worker.heap.begin(), worker.heap.end(),
+                [](const Worker::OpenEntry& a, const Worker::OpenEntry& b) { return a.f > b.f; });
+        };
+        for (int32_t local : worker.treeCells) {
+            worker.parent[local] = -1;
+            push(local, 0.0f);
+        }
+
+        bool found = false;
+        while (!worker.heap.empty()) {
+            std::pop_heap(worker.heap.begin(), worker.heap.end(),
+                [](const Worker::OpenEntry& a, const Worker::OpenEntry& b) { return a.f > b.f; });
+            const int32_t current = worker.heap.back().cell;
+            worker.heap.pop_back();
+
+            if (worker.closedStamp[current] == searchGeneration) {
+                continue;
+            }
+            worker.closedStamp[current] = searchGeneration;
+
+            if (current == sinkLocal) {
+                found = true;
+                break;
+            }
+
+            const int x = current % ww;
+            const int y = current / ww;
+            const int offsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            for (const auto& offset : offsets) {
+                const int nx = x + offset[0];
+                const int ny = y + offset[1];
+                if (nx < 0 || ny < 0 || nx >= ww || ny >= worker.height) {
+                    continue;
+                }
+
+                const int32_t local = ny * ww + nx;
+                if (worker.closedStamp[local] == searchGeneration) {
+                    continue;
+                }
+
+                const int32_t region = toRegion(local);
+                if (m_blocked[region]) {
+                    continue;
+                }
+                // 다른 넷의 단자와 어느 넷의 단자도 아닌 게이트/포트 셀
+                const int32_t terminal = m_terminalOwner[region];
+                if (terminal != 0 && terminal != owner) {
+                    continue;
+                }
+
+                // 협상 비용: (기본 + 이력) * (1 + 현재 계수 * 다른 넷 점유)
+                const int occupancy = m_occupancy[region];
+                if (legalizing && occupancy > 0) {
+                    continue;
+                }
+                const float cost = (1.0f + m_history[region]) *
+                                   (1.0f + presentFactor * static_cast<float>(occupancy));
+
+                const float g = worker.gCost[current] + cost;
+                if (worker.openStamp[local] != searchGeneration || g < worker.gCost[local]) {
+                    worker.parent[local] = current;
+                    push(local, g);
+                }
+            }
+        }
+
+        if (!found) {
+            net.sinkRouted[s] = 0;
+            failed = true;
+            continue;
+        }
+        net.sinkRouted[s] = 1;
+
+        // 싱크에서 트리까지 되짚으며 셀과 연결 방향 기록
+        int32_t cell = sinkLocal;
+        addTreeCell(cell);
+        while (worker.parent[cell] >= 0) {
+            const int32_t prev = worker.parent[cell];
+            const int dx = (cell % ww) - (prev % ww);
+            const int dy = (cell / ww) - (prev / ww);
+
+            uint8_t toCell = dx > 0 ? DIR_RIGHT : dx < 0 ? DIR_LEFT : dy > 0 ? DIR_DOWN : DIR_UP;
+            uint8_t toPrev = dx > 0 ? DIR_LEFT : dx < 0 ? DIR_RIGHT : dy > 0 ? DIR_UP : DIR_DOWN;
+
+            if (worker.treeStamp[prev] != netGeneration) {
+                addTreeCell(prev);
+            }
+            worker.dirs[prev] |= toCell;
+            worker.dirs[cell] |= toPrev;
+            cell = prev;
+        }
+    }
+
+    net.cells.clear();
+    net.dirs.clear();
+    net.cells.reserve(worker.treeCells.size());
+    net.dirs.reserve(worker.treeCells.size());
+    for (int32_t local : worker.treeCells) {
+        const int32_t region = toRegion(local);
+        net.cells.push_back(region);
+        net.dirs.push_back(worker.dirs[local]);
+        ++m_occupancy[region];
+    }
+
+    // 창이 좁아 실패했으면 다음 반복에서 여유를 늘림 (영역 전체를 덮으면 더 늘리지 않음)
+    net.widenWindow = failed && (wx0 > 0 || wy0 > 0 || wx1 < m_width - 1 || wy1 < m_height - 1);
+    if (net.widenWindow) {
+        net.margin *= 2;
+    }
+}
+
+size_t AutoRouter::updateCongestion(float historyFactor) noexcept {
+    size_t overused = 0;
+    for (size_t i = 0; i < m_occupancy.size(); ++i) {
+        if (m_occupancy[i] > 1) {
+            m_history[i] += historyFactor * static_cast<float>(m_occupancy[i] - 1);
+            ++overused;
+        }
+    }
+
+    // 과사용 셀을 지나거나 창을 넓혀 다시 시도할 넷만 다음 반복에서 재배선
+    for (Net& net : m_nets) {
+        if (net.source < 0 || net.sinks.empty()) {
+            net.dirty = false;
+            continue;
+        }
+
+        bool congested = false;
+        for (int32_t cell : net.cells) {
+            if (m_occupancy[cell] > 1) {
+                congested = true;
+                break;
+            }
+        }
+
+        net.dirty = congested || net.widenWindow;
+    }
+
+    return overused;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/Vec2.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+class Circuit;
+class CellWireManager;
+class JobSystem;
+
+// 출력 포트 -> 입력 포트 연결 요청
+struct RouteRequest {
+    GateId fromGate{Constants::INVALID_GATE_ID};
+    GateId toGate{Constants::INVALID_GATE_ID};
+    PortIndex toPort{0};
+};
+
+struct AutoRouterConfig {
+    int searchMargin{8};            // 넷 경계 상자 바깥 탐색 여유 (실패한 넷은 반복마다 두 배)
+    int maxIterations{40};          // 협상 반복 횟수 상한
+    int maxStalledIterations{6};    // 과사용 셀 수가 줄지 않는 반복이 이만큼 이어지면 중단
+    float presentFactor{0.5f};      // 첫 반복의 현재 혼잡 비용 계수
+    float presentGrowth{1.5f};      // 반복마다 현재 혼잡 비용 계수 증가율
+    float historyFactor{0.5f};      // 과사용 셀에 누적되는 이력 비용
+    unsigned threadCount{0};        // 0이면 hardware_concurrency
+    bool connectCircuit{false};     // 배선된 연결을 Circuit에도 연결 (순환 검사 생략)
+};
+
+struct AutoRouteStats {
+    size_t nets{0};
+    size_t connections{0};
+    size_t routedConnections{0};
+    size_t failedConnections{0};
+    size_t wireCells{0};
+    int iterations{0};
+    float elapsedMs{0.0f};
+};
+
+// 여러 연결을 셀 그리드 위에서 한꺼번에 배선 (PathFinder 방식 협상 혼잡 비용)
+// 같은 출력에서 나가는 연결은 하나의 넷(트리)으로 묶고, 탐색 창이 겹치지 않는 넷끼리 병렬로 배선
+// 셀 와이어는 교차할 수 없으므로 셀 용량은 1이고, 끝까지 남은 충돌은 앞선 넷 우선으로 정리
+class AutoRouter {
+public:
+    explicit AutoRouter(Circuit* circuit) noexcept;
+    ~AutoRouter();
+
+    AutoRouter(const AutoRouter&) = delete;
+    AutoRouter& operator=(const AutoRouter&) = delete;
+
+    [[nodiscard]] Result<AutoRouteStats> route(
+        const std::vector<RouteRequest>& requests,
+        CellWireManager& wires,
+        const AutoRouterConfig& config = AutoRouterConfig{}) noexcept;
+
+private:
+    struct Net {
+        int32_t source{-1};                 // 영역 셀 인덱스
+        std::vector<int32_t> sinks;         // 출발점에서 가까운 순
+        std::vector<size_t> requests;       // sinks와 같은 순서의 요청 인덱스
+        std::vector<uint8_t> sinkRouted;
+        Vec2i min;
+        Vec2i max;
+        int margin{0};
+        std::vector<int32_t> cells;         // 현재 경로가 차지한 영역 셀
+        std::vector<uint8_t> dirs;          // cells와 같은 순서의 WireDirection 비트
+        bool widenWindow{false};
+        bool dirty{true};
+    };
+
+    struct Worker;
+
+    ErrorCode buildRegion(const std::vector<RouteRequest>& requests,
+                          const CellWireManager& wires,
+                          const AutoRouterConfig& config,
+                          AutoRouteStats& stats) noexcept;
+    void netWindow(const Net& net, int& x0, int& y0, int& x1, int& y1) const noexcept;
+    void routeNets(const std::vector<size_t>& netIndices, float presentFactor) noexcept;
+    void runBatch(const std::vector<size_t>& netIndices, float presentFactor) noexcept;
+    void routeNet(size_t netIndex, Worker& worker, float presentFactor, bool legalizing) noexcept;
+    size_t updateCongestion(float historyFactor) noexcept;
+    void legalize() noexcept;
+
+    [[nodiscard]] int32_t regionIndex(Vec2i cell) const noexcept {
+        return (cell.y - m_origin.y) * m_width + (cell.x - m_origin.x);
+    }
+    [[nodiscard]] bool inRegion(Vec2i cell) const noexcept {
+        return cell.x >= m_origin.x && cell.y >= m_origin.y &&
+               cell.x < m_origin.x + m_width && cell.y < m_origin.y + m_height;
+    }
+
+    Circuit* m_circuit;
+
+    // 배선 영역: 모든 단자의 경계 상자 + 여유
+    Vec2i m_origin;
+    int m_width{0};
+    int m_height{0};
+    std::vector<uint8_t> m_blocked;         // 기존 와이어 셀
+    std::vector<int32_t> m_terminalOwner;   // 단자 셀의 넷 번호 + 1, 단자가 아닌 게이트/포트 셀은 -1, 빈 셀은 0
+    std::vector<uint16_t> m_occupancy;      // 셀을 쓰는 넷 수
+    std::vector<float> m_history;           // 누적 혼잡 이력 비용
+
+    std::vector<Net> m_nets;
+    std::vector<Worker> m_workers;         // JobSystem 워커 번호별 탐색 버퍼
+    std::unique_ptr<JobSystem> m_jobs;      // route 호출 사이에도 유지되는 배선 스레드 풀
+};
@@ -1,17 +1,65 @@
 #include "CellWireManager.h"
 #include "Circuit.h"
+#include "../utils/Profiler.h"
+#include <algorithm>
 #include <cmath>
+#include <cfloat>
+
+namespace {
+    // 상하좌우 연결 방향과 그 방향 이웃 셀 오프셋 (같은 인덱스끼리 대응)
+    constexpr WireDirection NEIGHBOUR_DIRECTIONS[] = {
+        WireDirection::Up, WireDirection::Right, WireDirection::Down, WireDirection::Left
+    };
+    const glm::ivec2 NEIGHBOUR_OFFSETS[] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+}
 
 CellWireManager::CellWireManager(Circuit* circuit)
     : m_circuit(circuit) {
+    if (m_circuit) {
+        m_circuit->addListener(this);
+        for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
+            addGateCell(gateCellOf(it->second.position));
+        }
+    }
+}
+
+CellWireManager::~CellWireManager() {
+    if (m_circuit) {
+        m_circuit->removeListener(this);
+    }
+}
+
+void CellWireManager::onGateAdded(const Gate& gate) noexcept {
+    addGateCell(gateCellOf(gate.position));
+}
+
+void CellWireManager::onGateRemoved(const Gate& gate) noexcept {
+    removeGateCell(gateCellOf(gate.position));
 }
 
-CellWireManager::~CellWireManager() = default;
+void CellWireManager::onGateMoved(const Gate& gate, Vec2 oldPosition) noexcept {
+    removeGateCell(gateCellOf(oldPosition));
+    addGateCell(gateCellOf(gate.position));
+}
+
+void CellWireManager::onCircuitDestroyed(Circuit& circuit) noexcept {
+    if (m_circuit == &circuit) {
+        m_circuit = nullptr;
+        m_gateCells.clear();
+    }
+}
+
+MemoryUsage CellWireManager::getMemoryUsage() const {
+    MemoryUsage usage = MemoryStats::Measure(m_chunks);
+    usage += MemoryStats::Measure(m_gateCells);
+    return usage;
+}
 
 void CellWireManager::onDragStart(const glm::vec2& worldPos) {
     m_isDragging = true;
     m_dragStartPos = glm::ivec2(std::floor(worldPos.x), std::floor(worldPos.y));
     m_lastGridPos = m_dragStartPos;
+    m_lastDragPos = worldPos;
     
     // 시작 위치에 와이어 설치 (중앙 점)
     placeWireAt(m_dragStartPos);
@@ -24,41 +72,74 @@ void CellWireManager::onDragStart(const glm::vec2& worldPos) {
 void CellWireManager::onDragMove(const glm::vec2& worldPos) {
     if (!m_isDragging) return;
     
-    glm::ivec2 currentGridPos(std::floor(worldPos.x), std::floor(worldPos.y));
+    dragTo(worldPos);
+}
+
+void CellWireManager::onDragPath(const glm::vec2* points, size_t count) {
+    if (!m_isDragging) return;
     
-    // 새로운 셀로 이동했는지 확인
-    if (currentGridPos != m_lastGridPos) {
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                    "[CellWireManager] Moved from cell (%d, %d) to (%d, %d)", 
-                    m_lastGridPos.x, m_lastGridPos.y,
-                    currentGridPos.x, currentGridPos.y);
-        
-        // 현재 셀에 와이어 설치
-        placeWireAt(currentGridPos);
-        
-        // 이전 셀과 현재 셀을 연결
-        connectCells(m_lastGridPos, currentGridPos);
-        
-        m_lastGridPos = currentGridPos;
+    for (size_t i = 0; i < count; ++i) {
+        dragTo(points[i]);
     }
 }
 
 void CellWireManager::onDragEnd(const glm::vec2& worldPos) {
     if (!m_isDragging) return;
     
+    // 마지막 위치까지 이어서 연결
+    dragTo(worldPos);
     m_isDragging = false;
     
-    glm::ivec2 endGridPos(std::floor(worldPos.x), std::floor(worldPos.y));
-    
-    // 마지막 위치가 다르면 연결
-    if (endGridPos != m_lastGridPos) {
-        placeWireAt(endGridPos);
-        connectCells(m_lastGridPos, endGridPos);
-    }
-    
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
                 "[CellWireManager] Drag ended. Total wires: %zu", 
-                m_cellWires.size());
+                m_wireCount);
+}
+
+void CellWireManager::dragTo(const glm::vec2& worldPos) {
+    const glm::ivec2 target(std::floor(worldPos.x), std::floor(worldPos.y));
+    if (target == m_lastGridPos) {
+        m_lastDragPos = worldPos;
+        return;
+    }
+    
+    SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, 
+                   "[CellWireManager] Moved from cell (%d, %d) to (%d, %d)", 
+                   m_lastGridPos.x, m_lastGridPos.y, target.x, target.y);
+    
+    // 선분이 셀 경계를 넘는 순서대로 한 칸씩 이동 (격자 DDA)
+    // 빠른 이동이나 병합된 입력으로 여러 칸을 건너도 연결이 끊기지 않음
+    const glm::vec2 from = m_lastDragPos;
+    const glm::vec2 delta = worldPos - from;
+    const glm::ivec2 step(target.x > m_lastGridPos.x ? 1 : -1, target.y > m_lastGridPos.y ? 1 : -1);
+    
+    auto firstCrossing = [](float start, float d, int cell, int dir) {
+        if (d == 0.0f) return FLT_MAX;
+        float boundary = static_cast<float>(dir > 0 ? cell + 1 : cell);
+        return (boundary - start) / d;
+    };
+    float tMaxX = firstCrossing(from.x, delta.x, m_lastGridPos.x, step.x);
+    float tMaxY = firstCrossing(from.y, delta.y, m_lastGridPos.y, step.y);
+    const float tDeltaX = delta.x != 0.0f ? 1.0f / std::abs(delta.x) : FLT_MAX;
+    const float tDeltaY = delta.y != 0.0f ? 1.0f / std::abs(delta.y) : FLT_MAX;
+    
+    glm::ivec2 cell = m_lastGridPos;
+    while (cell != target) {
+        // 이미 목표 열/행에 도달한 축으로는 더 가지 않음 (부동소수 오차 대비)
+        bool moveX = cell.x != target.x && (cell.y == target.y || tMaxX < tMaxY);
+        if (moveX) {
+            cell.x += step.x;
+            tMaxX += tDeltaX;
+        } else {
+            cell.y += step.y;
+            tMaxY += tDeltaY;
+        }
+        
+        // 현재 셀에 와이어 설치 후 이전 셀과 연결
+        placeWireAt(cell);
+        connectCells(m_lastGridPos, cell);
+        m_lastGridPos = cell;
+    }
+    m_lastDragPos = worldPos;
 }
 
 void CellWireManager::placeWireAt(const glm::ivec2& gridPos) {
@@ -75,88 +156,422 @@ void CellWireManager::placeWireAt(const glm::ivec2& gridPos) {
         }
     }
     
-    uint64_t key = gridToKey(gridPos);
-    
     // 이미 와이어가 있으면 스킵
-    if (m_cellWires.find(key) != m_cellWires.end()) {
+    if (getWireAt(gridPos)) {
         return;
     }
     
-    // 새 와이어 생성
-    CellWire wire;
-    wire.cellPos = Vec2{static_cast<float>(gridPos.x), static_cast<float>(gridPos.y)};
-    wire.exists = true;
-    wire.connections = WireDirection::None;  // 연결은 connectCells에서 설정
+    // 새 와이어 생성 (연결은 connectCells에서 설정)
+    insertCell(getOrCreateChunk(toChunkCoord(gridPos)), gridPos);
     
-    m_cellWires[key] = wire;
-    
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                "[CellWireManager] Wire placed at cell (%d, %d)", 
-                gridPos.x, gridPos.y);
+    SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, 
+                   "[CellWireManager] Wire placed at cell (%d, %d)", 
+                   gridPos.x, gridPos.y);
 }
 
 void CellWireManager::removeWireAt(const glm::ivec2& gridPos) {
-    uint64_t key = gridToKey(gridPos);
-    
-    // 와이어 제거 전에 연결된 와이어들의 연결 정보도 업데이트
-    CellWire* wire = getWireAt(gridPos);
-    if (wire) {
-        // 상하좌우 인접 와이어들의 연결 정보 제거
-        if (wire->hasConnection(WireDirection::Up)) {
-            CellWire* upWire = getWireAt(gridPos + glm::ivec2(0, -1));
-            if (upWire) {
-                upWire->removeConnection(WireDirection::Down);
-            }
+    if (eraseCell(gridPos)) {
+        SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, 
+                       "[CellWireManager] Wire removed at cell (%d, %d)", 
+                       gridPos.x, gridPos.y);
+    }
+}
+
+void CellWireManager::removeWiresInArea(const glm::ivec2& min, const glm::ivec2& max) {
+    size_t removed = clearRect(min, max);
+    
+    if (removed > 0) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
+                    "[CellWireManager] Removed %zu wires in area (%d,%d) to (%d,%d)", 
+                    removed, min.x, min.y, max.x, max.y);
+    }
+}
+
+size_t CellWireManager::clearRect(const glm::ivec2& min, const glm::ivec2& max) {
+    if (max.x < min.x || max.y < min.y) {
+        return 0;
+    }
+    
+    size_t removed = 0;
+    
+    for (const glm::ivec2& coord : findChunksInRect(min, max)) {
+        auto it = m_chunks.find(gridToKey(coord));
+        WireChunk& chunk = it->second;
+        
+        glm::ivec2 base(coord.x << CHUNK_SHIFT, coord.y << CHUNK_SHIFT);
+        int x0 = std::max(min.x, base.x) - base.x;
+        int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+        int y0 = std::max(min.y, base.y) - base.y;
+        int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+        
+        // 청크 전체가 덮이면 통째로 제거
+        if (x0 == 0 && x1 == CHUNK_MASK && y0 == 0 && y1 == CHUNK_MASK) {
+            removed += chunk.count;
+            m_wireCount -= chunk.count;
+            eraseChunk(it);
+            continue;
+        }
+        
+        uint32_t mask = rowMask(x0, x1);
+        uint32_t chunkRemoved = 0;
+        for (int y = y0; y <= y1; ++y) {
+            chunkRemoved += std::popcount(chunk.occupancy[y] & mask);
+            chunk.occupancy[y] &= ~mask;
         }
-        if (wire->hasConnection(WireDirection::Down)) {
-            CellWire* downWire = getWireAt(gridPos + glm::ivec2(0, 1));
-            if (downWire) {
-                downWire->removeConnection(WireDirection::Up);
+        
+        chunk.count -= chunkRemoved;
+        m_wireCount -= chunkRemoved;
+        removed += chunkRemoved;
+        
+        if (chunk.count == 0) {
+            eraseChunk(it);
+        } else if (chunkRemoved > 0) {
+            markGeometryDirty(chunk);
+        }
+    }
+    
+    if (removed > 0) {
+        repairBorder(min, max);
+    }
+    
+    return removed;
+}
+
+void CellWireManager::fillRect(const glm::ivec2& min, const glm::ivec2& max, 
+                               WireDirection connections) {
+    if (max.x < min.x || max.y < min.y) {
+        return;
+    }
+    
+    clearRect(min, max);
+    
+    // 축 단위로 대칭화: 한쪽 방향만 지정해도 양쪽 셀이 서로 연결되도록
+    uint8_t bits = static_cast<uint8_t>(connections);
+    if (bits & static_cast<uint8_t>(WireDirection::Left | WireDirection::Right)) {
+        bits |= static_cast<uint8_t>(WireDirection::Left | WireDirection::Right);
+    }
+    if (bits & static_cast<uint8_t>(WireDirection::Up | WireDirection::Down)) {
+        bits |= static_cast<uint8_t>(WireDirection::Up | WireDirection::Down);
+    }
+    
+    glm::ivec2 minChunk = toChunkCoord(min);
+    glm::ivec2 maxChunk = toChunkCoord(max);
+    
+    for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+        for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+            WireChunk& chunk = getOrCreateChunk(glm::ivec2(cx, cy));
+            markGeometryDirty(chunk);
+            
+            glm::ivec2 base(cx << CHUNK_SHIFT, cy << CHUNK_SHIFT);
+            int x0 = std::max(min.x, base.x) - base.x;
+            int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+            int y0 = std::max(min.y, base.y) - base.y;
+            int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+            uint32_t mask = rowMask(x0, x1);
+            
+            for (int y = y0; y <= y1; ++y) {
+                int worldY = base.y + y;
+                uint8_t rowBits = bits;
+                if (worldY == min.y) rowBits &= ~static_cast<uint8_t>(WireDirection::Up);
+                if (worldY == max.y) rowBits &= ~static_cast<uint8_t>(WireDirection::Down);
+                
+                for (int x = x0; x <= x1; ++x) {
+                    int worldX = base.x + x;
+                    uint8_t cellBits = rowBits;
+                    if (worldX == min.x) cellBits &= ~static_cast<uint8_t>(WireDirection::Left);
+                    if (worldX == max.x) cellBits &= ~static_cast<uint8_t>(WireDirection::Right);
+                    
+                    CellWire& cell = chunk.cells[y * CHUNK_SIZE + x];
+                    cell = CellWire{};
+                    cell.cellPos = Vec2{static_cast<float>(worldX), static_cast<float>(worldY)};
+                    cell.connections = static_cast<WireDirection>(cellBits);
+                    cell.exists = true;
+                }
+                
+                chunk.occupancy[y] |= mask;
+                chunk.count += static_cast<uint32_t>(x1 - x0 + 1);
+                m_wireCount += static_cast<size_t>(x1 - x0 + 1);
             }
         }
-        if (wire->hasConnection(WireDirection::Left)) {
-            CellWire* leftWire = getWireAt(gridPos + glm::ivec2(-1, 0));
-            if (leftWire) {
-                leftWire->removeConnection(WireDirection::Right);
+    }
+    
+    // 게이트가 있는 셀은 비움
+    eraseCells(collectGateCells(min, max));
+    
+    SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, 
+                   "[CellWireManager] Filled area (%d,%d) to (%d,%d). Total wires: %zu", 
+                   min.x, min.y, max.x, max.y, m_wireCount);
+}
+
+void CellWireManager::moveRect(const glm::ivec2& min, const glm::ivec2& max, 
+                               const glm::ivec2& offset) {
+    if (max.x < min.x || max.y < min.y || (offset.x == 0 && offset.y == 0)) {
+        return;
+    }
+    
+    WirePattern pattern = capturePattern(min, max);
+    clearRect(min, max);
+    stampPattern(min + offset, pattern);
+}
+
+void CellWireManager::stampPattern(const glm::ivec2& origin, const WirePattern& pattern) {
+    if (pattern.size.x <= 0 || pattern.size.y <= 0 || 
+        pattern.cells.size() < static_cast<size_t>(pattern.size.x) * pattern.size.y) {
+        return;
+    }
+    
+    glm::ivec2 min = origin;
+    glm::ivec2 max = origin + pattern.size - glm::ivec2(1, 1);
+    clearRect(min, max);
+    
+    auto patternAt = [&](int x, int y) -> uint8_t {
+        if (x < 0 || y < 0 || x >= pattern.size.x || y >= pattern.size.y) {
+            return 0;
+        }
+        return pattern.cells[static_cast<size_t>(y) * pattern.size.x + x];
+    };
+    
+    // 이웃이 없거나 상대 방향 비트가 없는 연결은 버림 (패턴 바깥을 향하는 연결 포함)
+    auto sanitize = [&](int x, int y, uint8_t value) -> uint8_t {
+        uint8_t bits = value & static_cast<uint8_t>(WireDirection::All);
+        constexpr uint8_t UP = static_cast<uint8_t>(WireDirection::Up);
+        constexpr uint8_t DOWN = static_cast<uint8_t>(WireDirection::Down);
+        constexpr uint8_t LEFT = static_cast<uint8_t>(WireDirection::Left);
+        constexpr uint8_t RIGHT = static_cast<uint8_t>(WireDirection::Right);
+        
+        if ((bits & UP) && !(patternAt(x, y - 1) & DOWN)) bits &= ~UP;
+        if ((bits & DOWN) && !(patternAt(x, y + 1) & UP)) bits &= ~DOWN;
+        if ((bits & LEFT) && !(patternAt(x - 1, y) & RIGHT)) bits &= ~LEFT;
+        if ((bits & RIGHT) && !(patternAt(x + 1, y) & LEFT)) bits &= ~RIGHT;
+        return bits;
+    };
+    
+    glm::ivec2 minChunk = toChunkCoord(min);
+    glm::ivec2 maxChunk = toChunkCoord(max);
+    
+    for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+        for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+            glm::ivec2 base(cx << CHUNK_SHIFT, cy << CHUNK_SHIFT);
+            int x0 = std::max(min.x, base.x) - base.x;
+            int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+            int y0 = std::max(min.y, base.y) - base.y;
+            int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+            
+            WireChunk* chunk = nullptr;
+            
+            for (int y = y0; y <= y1; ++y) {
+                int py = base.y + y - origin.y;
+                uint32_t rowBits = 0;
+                
+                for (int x = x0; x <= x1; ++x) {
+                    int px = base.x + x - origin.x;
+                    uint8_t value = patternAt(px, py);
+                    if (!(value & PATTERN_PRESENT)) {
+                        continue;
+                    }
+                    
+                    if (!chunk) {
+                        chunk = &getOrCreateChunk(glm::ivec2(cx, cy));
+                        markGeometryDirty(*chunk);
+                    }
+                    
+                    CellWire& cell = chunk->cells[y * CHUNK_SIZE + x];
+                    cell = CellWire{};
+                    cell.cellPos = Vec2{static_cast<float>(base.x + x), static_cast<float>(base.y + y)};
+                    cell.connections = static_cast<WireDirection>(sanitize(px, py, value));
+                    cell.exists = true;
+                    rowBits |= 1u << x;
+                }
+                
+                if (rowBits) {
+                    chunk->occupancy[y] |= rowBits;
+                    uint32_t added = static_cast<uint32_t>(std::popcount(rowBits));
+                    chunk->count += added;
+                    m_wireCount += added;
+                }
             }
         }
-        if (wire->hasConnection(WireDirection::Right)) {
-            CellWire* rightWire = getWireAt(gridPos + glm::ivec2(1, 0));
-            if (rightWire) {
-                rightWire->removeConnection(WireDirection::Left);
+    }
+    
+    eraseCells(collectGateCells(min, max));
+}
+
+CellWireManager::WirePattern CellWireManager::capturePattern(const glm::ivec2& min, 
+                                                             const glm::ivec2& max) const {
+    WirePattern pattern;
+    if (max.x < min.x || max.y < min.y) {
+        return pattern;
+    }
+    
+    pattern.size = max - min + glm::ivec2(1, 1);
+    pattern.cells.assign(static_cast<size_t>(pattern.size.x) * pattern.size.y, 0);
+    
+    for (const glm::ivec2& coord : findChunksInRect(min, max)) {
+        const WireChunk* chunk = findChunk(coord);
+        
+        glm::ivec2 base(coord.x << CHUNK_SHIFT, coord.y << CHUNK_SHIFT);
+        int x0 = std::max(min.x, base.x) - base.x;
+        int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+        int y0 = std::max(min.y, base.y) - base.y;
+        int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+        uint32_t mask = rowMask(x0, x1);
+        
+        for (int y = y0; y <= y1; ++y) {
+            uint32_t bits = chunk->occupancy[y] & mask;
+            int py = base.y + y - min.y;
+            
+            while (bits) {
+                int x = std::countr_zero(bits);
+                bits &= bits - 1;
+                
+                int px = base.x + x - min.x;
+                uint8_t connections = static_cast<uint8_t>(chunk->cells[y * CHUNK_SIZE + x].connections);
+                pattern.cells[static_cast<size_t>(py) * pattern.size.x + px] = 
+                    PATTERN_PRESENT | connections;
             }
         }
     }
     
-    m_cellWires.erase(key);
+    return pattern;
+}
+
+size_t CellWireManager::mergeWires(const std::vector<CellWire>& wires) {
+    WireChunk* chunk = nullptr;
+    glm::ivec2 cachedCoord(0, 0);
+    
+    for (const CellWire& wire : wires) {
+        glm::ivec2 pos(static_cast<int>(std::floor(wire.cellPos.x)), 
+                       static_cast<int>(std::floor(wire.cellPos.y)));
+        glm::ivec2 coord = toChunkCoord(pos);
+        if (!chunk || coord != cachedCoord) {
+            chunk = &getOrCreateChunk(coord);
+            markGeometryDirty(*chunk);
+            cachedCoord = coord;
+        }
+        
+        CellWire& cell = insertCell(*chunk, pos);
+        cell.connections |= wire.connections;
+        cell.exists = true;
+    }
+    
+    // 기존 와이어와 OR로 합치면 경계에서 한쪽만 가리키는 연결이 남을 수 있음: 양쪽이 모두 가리킬 때만 유지
+    for (const CellWire& wire : wires) {
+        glm::ivec2 pos(static_cast<int>(std::floor(wire.cellPos.x)), 
+                       static_cast<int>(std::floor(wire.cellPos.y)));
+        CellWire* cell = getWireAt(pos);
+        
+        for (int d = 0; d < 4; ++d) {
+            glm::ivec2 neighbourPos = pos + NEIGHBOUR_OFFSETS[d];
+            CellWire* neighbour = getWireAt(neighbourPos);
+            WireDirection opposite = getOppositeDirection(NEIGHBOUR_DIRECTIONS[d]);
+            bool mine = cell->hasConnection(NEIGHBOUR_DIRECTIONS[d]);
+            bool theirs = neighbour && neighbour->hasConnection(opposite);
+            
+            if (mine && !theirs) {
+                cell->removeConnection(NEIGHBOUR_DIRECTIONS[d]);
+            } else if (theirs && !mine) {
+                neighbour->removeConnection(opposite);
+                markGeometryDirty(neighbourPos);
+            }
+        }
+    }
     
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                "[CellWireManager] Wire removed at cell (%d, %d)", 
-                gridPos.x, gridPos.y);
+                "[CellWireManager] Merged %zu wires. Total wires: %zu", 
+                wires.size(), m_wireCount);
+    return wires.size();
 }
 
-void CellWireManager::removeWiresInArea(const glm::ivec2& min, const glm::ivec2& max) {
-    std::vector<glm::ivec2> toRemove;
+size_t CellWireManager::eraseCells(const std::vector<glm::ivec2>& cells) {
+    struct Erased {
+        glm::ivec2 pos;
+        WireDirection connections;
+    };
+    std::vector<Erased> erased;
+    erased.reserve(cells.size());
     
-    // 영역 내의 모든 와이어 찾기
-    for (const auto& [key, wire] : m_cellWires) {
-        glm::ivec2 pos(wire.cellPos.x, wire.cellPos.y);
-        if (pos.x >= min.x && pos.x <= max.x && 
-            pos.y >= min.y && pos.y <= max.y) {
-            toRemove.push_back(pos);
+    // 점유 비트만 먼저 지움 (같은 청크가 이어지면 조회를 재사용)
+    WireChunk* chunk = nullptr;
+    glm::ivec2 cachedCoord(0, 0);
+    bool cached = false;
+    for (const glm::ivec2& pos : cells) {
+        glm::ivec2 coord = toChunkCoord(pos);
+        if (!cached || coord != cachedCoord) {
+            chunk = findChunk(coord);
+            cachedCoord = coord;
+            cached = true;
+            if (chunk) {
+                markGeometryDirty(*chunk);
+            }
         }
+        if (!chunk) {
+            continue;
+        }
+        
+        int x = pos.x & CHUNK_MASK;
+        int y = pos.y & CHUNK_MASK;
+        if (!(chunk->occupancy[y] & (1u << x))) {
+            continue;
+        }
+        chunk->occupancy[y] &= ~(1u << x);
+        chunk->count--;
+        m_wireCount--;
+        erased.push_back({pos, chunk->cells[y * CHUNK_SIZE + x].connections});
     }
     
-    // 찾은 와이어들 제거
-    for (const auto& pos : toRemove) {
-        removeWireAt(pos);
+    // 남은 이웃에서 지운 셀을 가리키는 연결 제거 (지운 셀끼리는 getWireAt이 nullptr)
+    for (const Erased& cell : erased) {
+        for (int d = 0; d < 4; ++d) {
+            if (!(static_cast<uint8_t>(cell.connections) & static_cast<uint8_t>(NEIGHBOUR_DIRECTIONS[d]))) {
+                continue;
+            }
+            glm::ivec2 neighbourPos = cell.pos + NEIGHBOUR_OFFSETS[d];
+            if (CellWire* neighbour = getWireAt(neighbourPos)) {
+                neighbour->removeConnection(getOppositeDirection(NEIGHBOUR_DIRECTIONS[d]));
+                markGeometryDirty(neighbourPos);
+            }
+        }
     }
     
-    if (!toRemove.empty()) {
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                    "[CellWireManager] Removed %zu wires in area (%d,%d) to (%d,%d)", 
-                    toRemove.size(), min.x, min.y, max.x, max.y);
+    // 비게 된 청크 정리
+    for (const Erased& cell : erased) {
+        auto it = m_chunks.find(gridToKey(toChunkCoord(cell.pos)));
+        if (it != m_chunks.end() && it->second.count == 0) {
+            eraseChunk(it);
+        }
     }
+    
+    return erased.size();
+}
+
+std::vector<CellWire> CellWireManager::getWiresInArea(const glm::ivec2& min, 
+                                                      const glm::ivec2& max) const {
+    std::vector<CellWire> result;
+    if (max.x < min.x || max.y < min.y) {
+        return result;
+    }
+    
+    for (const glm::ivec2& coord : findChunksInRect(min, max)) {
+        const WireChunk* chunk = findChunk(coord);
+        
+        glm::ivec2 base(coord.x << CHUNK_SHIFT, coord.y << CHUNK_SHIFT);
+        int x0 = std::max(min.x, base.x) - base.x;
+        int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+        int y0 = std::max(min.y, base.y) - base.y;
+        int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+        uint32_t mask = rowMask(x0, x1);
+        
+        for (int y = y0; y <= y1; ++y) {
+            uint32_t bits = chunk->occupancy[y] & mask;
+            while (bits) {
+                int x = std::countr_zero(bits);
+                bits &= bits - 1;
+                result.push_back(chunk->cells[y * CHUNK_SIZE + x]);
+            }
+        }
+    }
+    
+    return result;
 }
 
 void CellWireManager::connectCells(const glm::ivec2& from, const glm::ivec2& to) {
@@ -190,34 +605,49 @@ void CellWireManager::connectCells(const glm::ivec2& from, const glm::ivec2& to)
     // 연결 추가
     if (fromWire) {
         fromWire->addConnection(fromToDir);
+        markGeometryDirty(from);
     }
     if (toWire) {
         toWire->addConnection(toFromDir);
+        markGeometryDirty(to);
     }
     
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
-                "[CellWireManager] Connected cells (%d, %d) -> (%d, %d)", 
-                from.x, from.y, to.x, to.y);
+    SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, 
+                   "[CellWireManager] Connected cells (%d, %d) -> (%d, %d)", 
+                   from.x, from.y, to.x, to.y);
 }
 
 CellWire* CellWireManager::getWireAt(const glm::ivec2& gridPos) {
-    uint64_t key = gridToKey(gridPos);
-    auto it = m_cellWires.find(key);
-    return (it != m_cellWires.end()) ? &it->second : nullptr;
+    WireChunk* chunk = findChunk(toChunkCoord(gridPos));
+    if (!chunk) {
+        return nullptr;
+    }
+    
+    int x = gridPos.x & CHUNK_MASK;
+    int y = gridPos.y & CHUNK_MASK;
+    return (chunk->occupancy[y] & (1u << x)) ? &chunk->cells[y * CHUNK_SIZE + x] : nullptr;
 }
 
 const CellWire* CellWireManager::getWireAt(const glm::ivec2& gridPos) const {
-    uint64_t key = gridToKey(gridPos);
-    auto it = m_cellWires.find(key);
-    return (it != m_cellWires.end()) ? &it->second : nullptr;
+    const WireChunk* chunk = findChunk(toChunkCoord(gridPos));
+    if (!chunk) {
+        return nullptr;
+    }
+    
+    int x = gridPos.x & CHUNK_MASK;
+    int y = gridPos.y & CHUNK_MASK;
+    return (chunk->occupancy[y] & (1u << x)) ? &chunk->cells[y * CHUNK_SIZE + x] : nullptr;
 }
 
 void CellWireManager::updateSignals() {
     if (!m_circuit) return;
+    PROFILE_SCOPE("CellWireManager::updateSignals");
     
     // 모든 와이어의 신호 상태 초기화
-    for (auto& [key, wire] : m_cellWires) {
-        wire.hasSignal = false;
+    for (auto& [key, chunk] : m_chunks) {
+        for (CellWire& wire : chunk.cells) {
+            wire.hasSignal = false;
+        }
     }
     
     // 게이트의 출력 신호를 인접 와이어로 전파
@@ -249,6 +679,29 @@ void CellWireManager::updateSignals() {
             }
         }
     }
+    
+    // 청크별 신호 비트를 다시 모아 바뀐 청크만 새 리비전을 줌 (배선 메시는 그대로)
+    for (auto& [key, chunk] : m_chunks) {
+        bool changed = false;
+        for (int y = 0; y < CHUNK_SIZE; ++y) {
+            uint32_t bits = 0;
+            uint32_t occupied = chunk.occupancy[y];
+            while (occupied) {
+                int x = std::countr_zero(occupied);
+                occupied &= occupied - 1;
+                if (chunk.cells[y * CHUNK_SIZE + x].hasSignal) {
+                    bits |= 1u << x;
+                }
+            }
+            if (bits != chunk.signalBits[y]) {
+                chunk.signalBits[y] = bits;
+                changed = true;
+            }
+        }
+        if (changed) {
+            chunk.signalRevision = ++m_revision;
+        }
+    }
 }
 
 void CellWireManager::propagateSignal(const glm::ivec2& startPos) {
@@ -351,4 +804,247 @@ WireDirection CellWireManager::getOppositeDirection(WireDirection dir) const {
         case WireDirection::Right: return WireDirection::Left;
         default: return WireDirection::None;
     }
+}
+
+CellWireManager::WireChunk* CellWireManager::findChunk(const glm::ivec2& chunkCoord) {
+    auto it = m_chunks.find(gridToKey(chunkCoord));
+    return it != m_chunks.end() ? &it->second : nullptr;
+}
+
+const CellWireManager::WireChunk* CellWireManager::findChunk(const glm::ivec2& chunkCoord) const {
+    auto it = m_chunks.find(gridToKey(chunkCoord));
+    return it != m_chunks.end() ? &it->second : nullptr;
+}
+
+CellWireManager::WireChunk& CellWireManager::getOrCreateChunk(const glm::ivec2& chunkCoord) {
+    auto [it, inserted] = m_chunks.try_emplace(gridToKey(chunkCoord));
+    if (inserted) {
+        it->second.coord = chunkCoord;
+        it->second.geometryRevision = ++m_revision;
+        it->second.signalRevision = it->second.geometryRevision;
+        ++m_chunkSetRevision;
+    }
+    return it->second;
+}
+
+void CellWireManager::eraseChunk(std::unordered_map<uint64_t, WireChunk>::iterator it) {
+    m_chunks.erase(it);
+    ++m_chunkSetRevision;
+}
+
+void CellWireManager::markGeometryDirty(const glm::ivec2& gridPos) {
+    if (WireChunk* chunk = findChunk(toChunkCoord(gridPos))) {
+        markGeometryDirty(*chunk);
+    }
+}
+
+CellWire& CellWireManager::insertCell(WireChunk& chunk, const glm::ivec2& gridPos) {
+    int x = gridPos.x & CHUNK_MASK;
+    int y = gridPos.y & CHUNK_MASK;
+    CellWire& cell = chunk.cells[y * CHUNK_SIZE + x];
+    
+    if (!(chunk.occupancy[y] & (1u << x))) {
+        chunk.occupancy[y] |= 1u << x;
+        chunk.count++;
+        m_wireCount++;
+        markGeometryDirty(chunk);
+        
+        cell = CellWire{};
+        cell.cellPos = Vec2{static_cast<float>(gridPos.x), static_cast<float>(gridPos.y)};
+        cell.exists = true;
+    }
+    
+    return cell;
+}
+
+bool CellWireManager::eraseCell(const glm::ivec2& gridPos) {
+    auto it = m_chunks.find(gridToKey(toChunkCoord(gridPos)));
+    if (it == m_chunks.end()) {
+        return false;
+    }
+    
+    WireChunk& chunk = it->second;
+    int x = gridPos.x & CHUNK_MASK;
+    int y = gridPos.y & CHUNK_MASK;
+    if (!(chunk.occupancy[y] & (1u << x))) {
+        return false;
+    }
+    
+    // 상하좌우 인접 와이어들의 연결 정보 제거
+    const CellWire& wire = chunk.cells[y * CHUNK_SIZE + x];
+    if (wire.hasConnection(WireDirection::Up)) {
+        if (CellWire* upWire = getWireAt(gridPos + glm::ivec2(0, -1))) {
+            upWire->removeConnection(WireDirection::Down);
+            markGeometryDirty(gridPos + glm::ivec2(0, -1));
+        }
+    }
+    if (wire.hasConnection(WireDirection::Down)) {
+        if (CellWire* downWire = getWireAt(gridPos + glm::ivec2(0, 1))) {
+            downWire->removeConnection(WireDirection::Up);
+            markGeometryDirty(gridPos + glm::ivec2(0, 1));
+        }
+    }
+    if (wire.hasConnection(WireDirection::Left)) {
+        if (CellWire* leftWire = getWireAt(gridPos + glm::ivec2(-1, 0))) {
+            leftWire->removeConnection(WireDirection::Right);
+            markGeometryDirty(gridPos + glm::ivec2(-1, 0));
+        }
+    }
+    if (wire.hasConnection(WireDirection::Right)) {
+        if (CellWire* rightWire = getWireAt(gridPos + glm::ivec2(1, 0))) {
+            rightWire->removeConnection(WireDirection::Left);
+            markGeometryDirty(gridPos + glm::ivec2(1, 0));
+        }
+    }
+    
+    chunk.occupancy[y] &= ~(1u << x);
+    chunk.count--;
+    m_wireCount--;
+    
+    if (chunk.count == 0) {
+        eraseChunk(it);
+    } else {
+        markGeometryDirty(chunk);
+    }
+    
+    return true;
+}
+
+std::vector<glm::ivec2> CellWireManager::findChunksInRect(const glm::ivec2& min, 
+                                                          const glm::ivec2& max) const {
+    std::vector<glm::ivec2> result;
+    glm::ivec2 minChunk = toChunkCoord(min);
+    glm::ivec2 maxChunk = toChunkCoord(max);
+    
+    uint64_t rectChunks = static_cast<uint64_t>(maxChunk.x - minChunk.x + 1) * 
+                          static_cast<uint64_t>(maxChunk.y - minChunk.y + 1);
+    
+    // 영역이 기존 청크 수보다 작으면 좌표를 직접 조회, 아니면 기존 청크만 순회
+    if (rectChunks <= m_chunks.size()) {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                if (findChunk(glm::ivec2(cx, cy))) {
+                    result.emplace_back(cx, cy);
+                }
+            }
+        }
+    } else {
+        for (const auto& [key, chunk] : m_chunks) {
+            if (chunk.coord.x >= minChunk.x && chunk.coord.x <= maxChunk.x &&
+                chunk.coord.y >= minChunk.y && chunk.coord.y <= maxChunk.y) {
+                result.push_back(chunk.coord);
+            }
+        }
+    }
+    
+    return result;
+}
+
+void CellWireManager::repairBorder(const glm::ivec2& min, const glm::ivec2& max) {
+    for (int y = min.y; y <= max.y; ++y) {
+        if (CellWire* left = getWireAt(glm::ivec2(min.x - 1, y))) {
+            left->removeConnection(WireDirection::Right);
+            markGeometryDirty(glm::ivec2(min.x - 1, y));
+        }
+        if (CellWire* right = getWireAt(glm::ivec2(max.x + 1, y))) {
+            right->removeConnection(WireDirection::Left);
+            markGeometryDirty(glm::ivec2(max.x + 1, y));
+        }
+    }
+    
+    for (int x = min.x; x <= max.x; ++x) {
+        if (CellWire* up = getWireAt(glm::ivec2(x, min.y - 1))) {
+            up->removeConnection(WireDirection::Down);
+            markGeometryDirty(glm::ivec2(x, min.y - 1));
+        }
+        if (CellWire* down = getWireAt(glm::ivec2(x, max.y + 1))) {
+            down->removeConnection(WireDirection::Up);
+            markGeometryDirty(glm::ivec2(x, max.y + 1));
+        }
+    }
+}
+
+std::vector<glm::ivec2> CellWireManager::collectGateCells(const glm::ivec2& min, 
+                                                          const glm::ivec2& max) const {
+    std::vector<glm::ivec2> result;
+    if (max.x < min.x || max.y < min.y || m_gateCells.empty()) {
+        return result;
+    }
+    
+    auto collect = [&](const GateCellChunk& chunk) {
+        glm::ivec2 base(chunk.coord.x << CHUNK_SHIFT, chunk.coord.y << CHUNK_SHIFT);
+        int x0 = std::max(min.x, base.x) - base.x;
+        int x1 = std::min(max.x, base.x + CHUNK_MASK) - base.x;
+        int y0 = std::max(min.y, base.y) - base.y;
+        int y1 = std::min(max.y, base.y + CHUNK_MASK) - base.y;
+        uint32_t mask = rowMask(x0, x1);
+        
+        for (int y = y0; y <= y1; ++y) {
+            uint32_t bits = chunk.occupancy[y] & mask;
+            while (bits) {
+                int x = std::countr_zero(bits);
+                bits &= bits - 1;
+                result.emplace_back(base.x + x, base.y + y);
+            }
+        }
+    };
+    
+    glm::ivec2 minChunk = toChunkCoord(min);
+    glm::ivec2 maxChunk = toChunkCoord(max);
+    uint64_t rectChunks = static_cast<uint64_t>(maxChunk.x - minChunk.x + 1) * 
+                          static_cast<uint64_t>(maxChunk.y - minChunk.y + 1);
+    
+    // findChunksInRect와 같은 선택: 영역 청크 수와 색인된 청크 수 중 작은 쪽을 순회
+    if (rectChunks <= m_gateCells.size()) {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                auto it = m_gateCells.find(gridToKey(glm::ivec2(cx, cy)));
+                if (it != m_gateCells.end()) {
+                    collect(it->second);
+                }
+            }
+        }
+    } else {
+        for (const auto& [key, chunk] : m_gateCells) {
+            if (chunk.coord.x >= minChunk.x && chunk.coord.x <= maxChunk.x &&
+                chunk.coord.y >= minChunk.y && chunk.coord.y <= maxChunk.y) {
+                collect(chunk);
+            }
+        }
+    }
+    
+    return result;
+}
+
+void CellWireManager::addGateCell(const glm::ivec2& cell) {
+    glm::ivec2 coord = toChunkCoord(cell);
+    auto [it, inserted] = m_gateCells.try_emplace(gridToKey(coord));
+    GateCellChunk& chunk = it->second;
+    if (inserted) {
+        chunk.coord = coord;
+    }
+    
+    uint32_t bit = 1u << (cell.x & CHUNK_MASK);
+    uint32_t& row = chunk.occupancy[cell.y & CHUNK_MASK];
+    if (!(row & bit)) {
+        row |= bit;
+        chunk.count++;
+    }
+}
+
+void CellWireManager::removeGateCell(const glm::ivec2& cell) {
+    auto it = m_gateCells.find(gridToKey(toChunkCoord(cell)));
+    if (it == m_gateCells.end()) {
+        return;
+    }
+    
+    GateCellChunk& chunk = it->second;
+    uint32_t bit = 1u << (cell.x & CHUNK_MASK);
+    uint32_t& row = chunk.occupancy[cell.y & CHUNK_MASK];
+    if (row & bit) {
+        row &= ~bit;
+        if (--chunk.count == 0) {
+            m_gateCells.erase(it);
+        }
+    }
 }
\ No newline at end of file
@@ -1,22 +1,64 @@
 #pragma once
 #include "CellWire.h"
+#include "Circuit.h"
 #include "Types.h"
+#include "../utils/MemoryStats.h"
+#include <array>
+#include <bit>
+#include <cmath>
 #include <unordered_map>
 #include <set>
 #include <vector>
 #include <glm/glm.hpp>
 #include <SDL.h>
 
-class Circuit;
-
-class CellWireManager {
+// 게이트가 차지한 셀은 Circuit 편집 통지(ICircuitListener)로 따로 색인해
+// 사각형 일괄 연산이 전체 게이트가 아니라 영역 안의 셀만 보도록 함
+class CellWireManager : public ICircuitListener {
 public:
+    static constexpr int CHUNK_SHIFT = 5;
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT;  // 32x32 셀
+    static constexpr int CHUNK_MASK = CHUNK_SIZE - 1;
+    
+    // 청크 단위 저장소: 행마다 32비트 존재 마스크를 두고 사각형 연산을 비트 연산으로 처리
+    struct WireChunk {
+        glm::ivec2 coord{0, 0};
+        std::array<uint32_t, CHUNK_SIZE> occupancy{};
+        std::array<CellWire, CHUNK_SIZE * CHUNK_SIZE> cells{};
+        uint32_t count{0};
+        
+        // 렌더 캐시 갱신용: 배선(셀/연결)이나 신호가 바뀔 때마다 새 리비전을 받음
+        uint64_t geometryRevision{0};
+        uint64_t signalRevision{0};
+        std::array<uint32_t, CHUNK_SIZE> signalBits{};   // 행별 HIGH 셀 비트
+    };
+    
+    // 스탬프용 사각형 패턴: cells[y * size.x + x] = PATTERN_PRESENT | 연결 방향 비트 (0이면 빈 셀)
+    static constexpr uint8_t PATTERN_PRESENT = 0x80;
+    struct WirePattern {
+        glm::ivec2 size{0, 0};
+        std::vector<uint8_t> cells;
+    };
+    
     CellWireManager(Circuit* circuit);
-    ~CellWireManager();
+    ~CellWireManager() override;
+    
+    CellWireManager(const CellWireManager&) = delete;
+    CellWireManager& operator=(const CellWireManager&) = delete;
+    
+    // ICircuitListener: 게이트 셀 색인 갱신 (와이어 통지는 쓰지 않음)
+    void onGateAdded(const Gate& gate) noexcept override;
+    void onGateRemoved(const Gate& gate) noexcept override;
+    void onGateMoved(const Gate& gate, Vec2 oldPosition) noexcept override;
+    void onWireAdded(const Wire&) noexcept override {}
+    void onWireRemoved(const Wire&) noexcept override {}
+    void onCircuitDestroyed(Circuit& circuit) noexcept override;
     
     // 드래그 이벤트 처리
     void onDragStart(const glm::vec2& worldPos);
     void onDragMove(const glm::vec2& worldPos);
+    // 한 프레임에 모인 마우스 경로 (입력 병합 시). 점마다 onDragMove와 같음
+    void onDragPath(const glm::vec2* points, size_t count);
     void onDragEnd(const glm::vec2& worldPos);
     
     // 셀에 와이어 설치/제거
@@ -24,6 +66,20 @@ public:
     void removeWireAt(const glm::ivec2& gridPos);
     void removeWiresInArea(const glm::ivec2& min, const glm::ivec2& max);  // 영역 내 와이어 제거
     
+    // 사각형 일괄 연산 (min/max 포함). 영역 경계에서만 바깥 이웃의 연결 비트를 정리
+    size_t clearRect(const glm::ivec2& min, const glm::ivec2& max);
+    void fillRect(const glm::ivec2& min, const glm::ivec2& max, WireDirection connections);
+    void moveRect(const glm::ivec2& min, const glm::ivec2& max, const glm::ivec2& offset);
+    void stampPattern(const glm::ivec2& origin, const WirePattern& pattern);
+    WirePattern capturePattern(const glm::ivec2& min, const glm::ivec2& max) const;
+    
+    // 일괄 처리 (클립보드 붙여넣기 등): 셀별 로그 없이 기존 와이어와 연결을 병합
+    // 병합 후 병합한 셀과 이웃 사이에 한쪽만 있는 연결 비트는 지움
+    size_t mergeWires(const std::vector<CellWire>& wires);
+    // 여러 셀을 한 번에 제거: 점유를 먼저 모두 지운 뒤 남은 이웃의 연결을 한 번에 정리
+    size_t eraseCells(const std::vector<glm::ivec2>& cells);
+    std::vector<CellWire> getWiresInArea(const glm::ivec2& min, const glm::ivec2& max) const;
+    
     // 두 셀 사이 연결
     void connectCells(const glm::ivec2& from, const glm::ivec2& to);
     
@@ -31,8 +87,29 @@ public:
     CellWire* getWireAt(const glm::ivec2& gridPos);
     const CellWire* getWireAt(const glm::ivec2& gridPos) const;
     
-    // 모든 와이어 가져오기 (렌더링용)
-    const std::unordered_map<uint64_t, CellWire>& getAllWires() const { return m_cellWires; }
+    // 모든 와이어 순회 (렌더링용)
+    template<typename Fn>
+    void forEachWire(Fn&& fn) const {
+        for (const auto& [key, chunk] : m_chunks) {
+            for (int y = 0; y < CHUNK_SIZE; ++y) {
+                uint32_t bits = chunk.occupancy[y];
+                while (bits) {
+                    int x = std::countr_zero(bits);
+                    bits &= bits - 1;
+                    fn(chunk.cells[y * CHUNK_SIZE + x]);
+                }
+            }
+        }
+    }
+    
+    const std::unordered_map<uint64_t, WireChunk>& getChunks() const { return m_chunks; }
+    // 청크 좌표로 조회 (없으면 nullptr). 가시 영역만 순회하는 렌더러용
+    const WireChunk* getChunk(const glm::ivec2& chunkCoord) const { return findChunk(chunkCoord); }
+    size_t getWireCount() const { return m_wireCount; }
+    // 청크 맵 (청크마다 셀 배열 전체를 노드에 담음)
+    MemoryUsage getMemoryUsage() const;
+    // 청크가 생성/제거될 때마다 증가 (렌더 캐시가 사라진 청크를 정리할 시점)
+    uint64_t getChunkSetRevision() const { return m_chunkSetRevision; }
     
     // 신호 업데이트
     void updateSignals();
@@ -40,22 +117,77 @@ public:
 private:
     Circuit* m_circuit;
     
-    // 그리드 좌표를 키로 사용하는 와이어 맵
-    std::unordered_map<uint64_t, CellWire> m_cellWires;
+    // 청크 좌표를 키로 사용하는 와이어 청크 맵
+    std::unordered_map<uint64_t, WireChunk> m_chunks;
+    size_t m_wireCount{0};
+    
+    // 게이트가 있는 셀 (와이어 청크와 같은 격자의 행 비트마스크). 게이트끼리 셀을 공유하지 않는다고 가정
+    struct GateCellChunk {
+        glm::ivec2 coord{0, 0};
+        std::array<uint32_t, CHUNK_SIZE> occupancy{};
+        uint32_t count{0};
+    };
+    std::unordered_map<uint64_t, GateCellChunk> m_gateCells;
+    uint64_t m_revision{0};
+    uint64_t m_chunkSetRevision{0};
     
     // 드래그 상태
     bool m_isDragging{false};
     glm::ivec2 m_lastGridPos;
+    glm::vec2 m_lastDragPos{0.0f, 0.0f};    // m_lastGridPos 셀 안의 마지막 월드 좌표
     glm::ivec2 m_dragStartPos;
     
+    // 마지막 드래그 위치에서 worldPos까지 선분이 지나는 셀을 상하좌우로 이어 설치
+    void dragTo(const glm::vec2& worldPos);
+    
     // 그리드 좌표를 해시키로 변환
     uint64_t gridToKey(const glm::ivec2& gridPos) const {
         // 32비트씩 나눠서 64비트 키 생성
-        uint32_t x = static_cast<uint32_t>(gridPos.x + 0x7FFFFFFF);
-        uint32_t y = static_cast<uint32_t>(gridPos.y + 0x7FFFFFFF);
+        // 부호 있는 덧셈은 양수 좌표에서 오버플로(UB)가 나므로 부호 없는 값으로 계산
+        uint32_t x = static_cast<uint32_t>(gridPos.x) + 0x7FFFFFFFu;
+        uint32_t y = static_cast<uint32_t>(gridPos.y) + 0x7FFFFFFFu;
         return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
     }
     
+    static glm::ivec2 toChunkCoord(const glm::ivec2& gridPos) {
+        return glm::ivec2(gridPos.x >> CHUNK_SHIFT, gridPos.y >> CHUNK_SHIFT);
+    }
+    
+    // 로컬 x 범위 [x0, x1]의 행 마스크
+    static uint32_t rowMask(int x0, int x1) {
+        int width = x1 - x0 + 1;
+        return (width >= 32 ? 0xFFFFFFFFu : ((1u << width) - 1u)) << x0;
+    }
+    
+    WireChunk* findChunk(const glm::ivec2& chunkCoord);
+    const WireChunk* findChunk(const glm::ivec2& chunkCoord) const;
+    WireChunk& getOrCreateChunk(const glm::ivec2& chunkCoord);
+    void eraseChunk(std::unordered_map<uint64_t, WireChunk>::iterator it);
+    
+    // 배선이 바뀐 청크 표시 (렌더 캐시 재구축 대상)
+    void markGeometryDirty(WireChunk& chunk) { chunk.geometryRevision = ++m_revision; }
+    void markGeometryDirty(const glm::ivec2& gridPos);
+    
+    // 단일 셀 삽입 (게이트 검사/로그 없음). 이미 있으면 기존 셀 반환
+    CellWire& insertCell(WireChunk& chunk, const glm::ivec2& gridPos);
+    
+    // 단일 셀 제거 + 인접 셀 연결 정리 (로그 없음)
+    bool eraseCell(const glm::ivec2& gridPos);
+    
+    // 사각형과 겹치는 기존 청크 좌표
+    std::vector<glm::ivec2> findChunksInRect(const glm::ivec2& min, const glm::ivec2& max) const;
+    
+    // 영역 바깥 바로 옆 셀들이 영역 안을 가리키는 연결 제거
+    void repairBorder(const glm::ivec2& min, const glm::ivec2& max);
+    
+    // 영역 내 게이트가 차지한 셀 (bulk 연산에서 와이어 배치 제외). 게이트 셀 색인에서 영역의 청크만 조회
+    std::vector<glm::ivec2> collectGateCells(const glm::ivec2& min, const glm::ivec2& max) const;
+    static glm::ivec2 gateCellOf(Vec2 position) {
+        return glm::ivec2(static_cast<int>(std::floor(position.x)), static_cast<int>(std::floor(position.y)));
+    }
+    void addGateCell(const glm::ivec2& cell);
+    void removeGateCell(const glm::ivec2& cell);
+    
     // 두 셀 사이의 방향 계산
     WireDirection getDirection(const glm::ivec2& from, const glm::ivec2& to) const;
     WireDirection getOppositeDirection(WireDirection dir) const;
@@ -3,6 +3,15 @@
 #include <queue>
 #include <unordered_set>
 
+Circuit::~Circuit() {
+    // 통지 중 리스너가 removeListener를 불러도 되도록 목록을 비운 뒤 돔
+    std::vector<ICircuitListener*> toNotify;
+    toNotify.swap(listeners);
+    for (ICircuitListener* listener : toNotify) {
+        listener->onCircuitDestroyed(*this);
+    }
+}
+
 Result<GateId> Circuit::addGate(Vec2 position) noexcept {
     if (!canPlaceGate(position)) {
         return {Constants::INVALID_GATE_ID, ErrorCode::POSITION_OCCUPIED};
@@ -14,10 +23,15 @@ Result<GateId> Circuit::addGate(Vec2 position) noexcept {
     gate.position = position;
     gate.currentOutput = SignalState::HIGH;  // NOT 게이트 기본 출력은 HIGH
     
-    gates[gate.id] = std::move(gate);
+    GateId id = gate.id;
+    const Gate& added = gates[id] = std::move(gate);
     needsPropagation = true;
+    markGateChanged(id);
+    for (ICircuitListener* listener : listeners) {
+        listener->onGateAdded(added);
+    }
     
-    return {gate.id, ErrorCode::SUCCESS};
+    return {id, ErrorCode::SUCCESS};
 }
 
 ErrorCode Circuit::removeGate(GateId id) noexcept {
@@ -27,7 +41,11 @@ ErrorCode Circuit::removeGate(GateId id) noexcept {
     }
     
     removeGateConnections(id);
+    for (ICircuitListener* listener : listeners) {
+        listener->onGateRemoved(it->second);
+    }
     gates.erase(it);
+    markGateChanged(id);
     updateTopologicalOrder();
     
     return ErrorCode::SUCCESS;
@@ -43,6 +61,22 @@ const Gate* Circuit::getGate(GateId id) const noexcept {
     return it != gates.end() ? &it->second : nullptr;
 }
 
+ErrorCode Circuit::moveGate(GateId id, Vec2 position) noexcept {
+    auto it = gates.find(id);
+    if (it == gates.end()) {
+        return ErrorCode::INVALID_ID;
+    }
+    
+    Vec2 oldPosition = it->second.position;
+    it->second.position = position;
+    markGateChanged(id);
+    for (ICircuitListener* listener : listeners) {
+        listener->onGateMoved(it->second, oldPosition);
+    }
+    
+    return ErrorCode::SUCCESS;
+}
+
 GateId Circuit::getGateAt(Vec2 position, float tolerance) const noexcept {
     for (const auto& [id, gate] : gates) {
         if (gate.position.distance(position) <= tolerance) {
@@ -52,8 +86,108 @@ GateId Circuit::getGateAt(Vec2 position, float tolerance) const noexcept {
     return Constants::INVALID_GATE_ID;
 }
 
+ErrorCode Circuit::addGatesBatch(const std::vector<Vec2>& positions,
+                                 std::vector<GateId>& outIds) noexcept {
+    outIds.clear();
+    outIds.reserve(positions.size());
+    gates.reserve(gates.size() + positions.size());
+    
+    for (const Vec2& position : positions) {
+        Gate gate;
+        gate.id = nextGateId++;
+        gate.type = GateType::NOT;
+        gate.position = position;
+        gate.currentOutput = SignalState::HIGH;
+        
+        outIds.push_back(gate.id);
+        const Gate& added = gates.emplace(gate.id, gate).first->second;
+        markGateChanged(gate.id);
+        for (ICircuitListener* listener : listeners) {
+            listener->onGateAdded(added);
+        }
+    }
+    
+    needsPropagation = true;
+    updateTopologicalOrder();
+    
+    return ErrorCode::SUCCESS;
+}
+
+size_t Circuit::connectGatesBatch(const std::vector<GateConnection>& connections) noexcept {
+    size_t connected = 0;
+    wires.reserve(wires.size() + connections.size());
+    
+    for (const GateConnection& conn : connections) {
+        // 순환 검사는 생략: 비순환 회로에서 복사한 부분 그래프는 새 게이트끼리만 연결되므로 순환이 생기지 않음
+        if (!canConnect(conn.fromId, conn.toId, conn.toPort)) {
+            continue;
+        }
+        
+        Wire wire;
+        wire.id = nextWireId++;
+        wire.fromGateId = conn.fromId;
+        wire.toGateId = conn.toId;
+        wire.fromPort = Constants::OUTPUT_PORT;
+        wire.toPort = conn.toPort;
+        
+        Gate& fromGate = gates[conn.fromId];
+        Gate& toGate = gates[conn.toId];
+        fromGate.connectOutput(wire.id);
+        toGate.connectInput(conn.toPort, wire.id);
+        setInputPortUsed(conn.toId, conn.toPort, true);
+        wire.calculatePath(fromGate.getOutputPortPosition(),
+                           toGate.getInputPortPosition(conn.toPort));
+        
+        insertWire(std::move(wire));
+        markGateDirty(conn.toId);
+        ++connected;
+    }
+    
+    if (connected > 0) {
+        updateTopologicalOrder();
+    }
+    
+    return connected;
+}
+
+ErrorCode Circuit::removeGates(const std::vector<GateId>& ids) noexcept {
+    bool removedAny = false;
+    
+    for (GateId id : ids) {
+        auto it = gates.find(id);
+        if (it == gates.end()) {
+            continue;
+        }
+        
+        Gate& gate = it->second;
+        for (int i = 0; i < Constants::MAX_INPUT_PORTS; ++i) {
+            if (gate.inputWires[i] != Constants::INVALID_WIRE_ID) {
+                detachWire(gate.inputWires[i]);
+            }
+        }
+        if (gate.outputWire != Constants::INVALID_WIRE_ID) {
+            detachWire(gate.outputWire);
+        }
+        
+        for (ICircuitListener* listener : listeners) {
+            listener->onGateRemoved(gate);
+        }
+        gates.erase(it);
+        markGateChanged(id);
+        removedAny = true;
+    }
+    
+    if (!removedAny) {
+        return ErrorCode::INVALID_ID;
+    }
+    
+    updateTopologicalOrder();
+    return ErrorCode::SUCCESS;
+}
+
 Result<WireId> Circuit::connectGates(
-    GateId fromId, GateId toId, PortIndex toPort) noexcept {
+    GateId fromId, GateId toId, PortIndex toPort,
+    const std::vector<Vec2>* path) noexcept {
     
     if (!canConnect(fromId, toId, toPort)) {
         return {Constants::INVALID_WIRE_ID, ErrorCode::PORT_ALREADY_CONNECTED};
@@ -72,27 +206,34 @@ Result<WireId> Circuit::connectGates(
     
     gates[fromId].connectOutput(wire.id);
     gates[toId].connectInput(toPort, wire.id);
+    setInputPortUsed(toId, toPort, true);
+    
+    if (path && path->size() >= 2) {
+        wire.pathPoints = *path;
+    } else {
+        Vec2 fromPos = gates[fromId].getOutputPortPosition();
+        Vec2 toPos = gates[toId].getInputPortPosition(toPort);
+        wire.calculatePath(fromPos, toPos);
+    }
     
-    Vec2 fromPos = gates[fromId].getOutputPortPosition();
-    Vec2 toPos = gates[toId].getInputPortPosition(toPort);
-    wire.calculatePath(fromPos, toPos);
-    
-    wires[wire.id] = std::move(wire);
+    WireId id = wire.id;
+    insertWire(std::move(wire));
     
     markGateDirty(toId);
     updateTopologicalOrder();
     
-    return {wire.id, ErrorCode::SUCCESS};
+    return {id, ErrorCode::SUCCESS};
 }
 
 ErrorCode Circuit::addWire(const Wire& wire) noexcept {
     // Add wire directly without gate validation (for cell-to-cell wires)
-    wires[wire.id] = wire;
+    insertWire(Wire(wire));
     
     // If connected to gates, update their connections
     if (wire.toGateId != Constants::INVALID_GATE_ID) {
         if (auto* toGate = getGate(wire.toGateId)) {
             toGate->inputWires[wire.toPort] = wire.id;
+            setInputPortUsed(wire.toGateId, wire.toPort, true);
             markGateDirty(wire.toGateId);
         }
     }
@@ -102,22 +243,10 @@ ErrorCode Circuit::addWire(const Wire& wire) noexcept {
 }
 
 ErrorCode Circuit::removeWire(WireId id) noexcept {
-    auto it = wires.find(id);
-    if (it == wires.end()) {
+    if (!detachWire(id)) {
         return ErrorCode::INVALID_ID;
     }
     
-    Wire& wire = it->second;
-    
-    if (auto* fromGate = getGate(wire.fromGateId)) {
-        fromGate->disconnectOutput();
-    }
-    if (auto* toGate = getGate(wire.toGateId)) {
-        toGate->disconnectInput(wire.toPort);
-        markGateDirty(wire.toGateId);
-    }
-    
-    wires.erase(it);
     updateTopologicalOrder();
     
     return ErrorCode::SUCCESS;
@@ -159,6 +288,7 @@ void Circuit::reset() noexcept {
         gate.delayTimer = 0.0f;
         gate.isDelayActive = false;
         gate.isDirty = true;
+        markGateChanged(id);
     }
     
     for (auto& [id, wire] : wires) {
@@ -169,6 +299,51 @@ void Circuit::reset() noexcept {
     needsPropagation = true;
 }
 
+void Circuit::markGateChanged(GateId id) noexcept {
+    size_t word = static_cast<size_t>(id) >> 6;
+    if (word >= changedGateBits.size()) {
+        changedGateBits.resize(std::max(word + 1, changedGateBits.size() * 2), 0);
+    }
+    uint64_t mask = 1ULL << (id & 63);
+    if (changedGateBits[word] & mask) {
+        return;
+    }
+    changedGateBits[word] |= mask;
+    changedGates.push_back(id);
+}
+
+void Circuit::addListener(ICircuitListener* listener) noexcept {
+    if (listener && std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) {
+        listeners.push_back(listener);
+    }
+}
+
+void Circuit::removeListener(ICircuitListener* listener) noexcept {
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+}
+
+void Circuit::takeChangedGates(std::vector<GateId>& out) noexcept {
+    out.clear();
+    out.swap(changedGates);
+    for (GateId id : out) {
+        changedGateBits[static_cast<size_t>(id) >> 6] &= ~(1ULL << (id & 63));
+    }
+}
+
+MemoryUsage Circuit::getMemoryUsage() const noexcept {
+    MemoryUsage usage = MemoryStats::Measure(gates);
+    usage += MemoryStats::Measure(wires);
+    for (const auto& [id, wire] : wires) {
+        usage += MemoryStats::Measure(wire.pathPoints);
+    }
+    usage += MemoryStats::Measure(dirtyGates);
+    usage += MemoryStats::Measure(updateOrder);
+    usage += MemoryStats::Measure(inputPortBits);
+    usage += MemoryStats::Measure(changedGates);
+    usage += MemoryStats::Measure(changedGateBits);
+    return usage;
+}
+
 bool Circuit::canPlaceGate(Vec2 position) const noexcept {
     constexpr float MIN_DISTANCE = 1.0f;
     
@@ -304,6 +479,63 @@ void Circuit::markGateDirty(GateId id) noexcept {
     }
 }
 
+bool Circuit::detachWire(WireId id) noexcept {
+    auto it = wires.find(id);
+    if (it == wires.end()) {
+        return false;
+    }
+    
+    Wire& wire = it->second;
+    
+    if (auto* fromGate = getGate(wire.fromGateId)) {
+        fromGate->disconnectOutput();
+    }
+    if (auto* toGate = getGate(wire.toGateId)) {
+        toGate->disconnectInput(wire.toPort);
+        setInputPortUsed(wire.toGateId, wire.toPort, false);
+        markGateDirty(wire.toGateId);
+    }
+    
+    for (ICircuitListener* listener : listeners) {
+        listener->onWireRemoved(wire);
+    }
+    wires.erase(it);
+    return true;
+}
+
+void Circuit::insertWire(Wire&& wire) noexcept {
+    auto it = wires.find(wire.id);
+    if (it != wires.end()) {
+        // 같은 ID로 다시 넣으면 덮어쓰므로 이전 경로를 먼저 빼게 함
+        for (ICircuitListener* listener : listeners) {
+            listener->onWireRemoved(it->second);
+        }
+        it->second = std::move(wire);
+    } else {
+        it = wires.emplace(wire.id, std::move(wire)).first;
+    }
+    for (ICircuitListener* listener : listeners) {
+        listener->onWireAdded(it->second);
+    }
+}
+
+void Circuit::setInputPortUsed(GateId id, PortIndex port, bool used) noexcept {
+    if (port < 0 || port >= Constants::MAX_INPUT_PORTS) return;
+    
+    size_t bit = static_cast<size_t>(id) * Constants::MAX_INPUT_PORTS + port;
+    size_t word = bit >> 6;
+    if (word >= inputPortBits.size()) {
+        if (!used) return;
+        inputPortBits.resize(std::max(word + 1, inputPortBits.size() * 2), 0);
+    }
+    
+    if (used) {
+        inputPortBits[word] |= 1ULL << (bit & 63);
+    } else {
+        inputPortBits[word] &= ~(1ULL << (bit & 63));
+    }
+}
+
 void Circuit::removeGateConnections(GateId id) noexcept {
     Gate* gate = getGate(id);
     if (!gate) return;
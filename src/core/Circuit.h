@@ -4,10 +4,36 @@
 #include "Wire.h"
 #include "GatePool.h"
 #include "GridMap.h"
+#include "../utils/MemoryStats.h"
 #include <unordered_map>
 #include <vector>
 #include <memory>
 
+// 일괄 연결용 (붙여넣기 등)
+struct GateConnection {
+    GateId fromId{Constants::INVALID_GATE_ID};
+    GateId toId{Constants::INVALID_GATE_ID};
+    PortIndex toPort{Constants::INVALID_PORT};
+};
+
+class Circuit;
+
+// 회로 편집 통지 (히트 검사 공간 색인처럼 게이트/와이어 배치를 따라가는 쪽이 구현)
+// - 추가는 맵에 넣은 뒤, 제거는 맵에서 지우기 직전에 호출
+// - 리스너는 Circuit보다 먼저 사라지면 removeListener로 빠져야 하고,
+//   Circuit이 먼저 사라지면 onCircuitDestroyed를 받은 뒤 그 Circuit을 더 쓰지 않아야 함
+class ICircuitListener {
+public:
+    virtual ~ICircuitListener() = default;
+    
+    virtual void onGateAdded(const Gate& gate) noexcept = 0;
+    virtual void onGateRemoved(const Gate& gate) noexcept = 0;
+    virtual void onGateMoved(const Gate& gate, Vec2 oldPosition) noexcept = 0;
+    virtual void onWireAdded(const Wire& wire) noexcept = 0;
+    virtual void onWireRemoved(const Wire& wire) noexcept = 0;
+    virtual void onCircuitDestroyed(Circuit& circuit) noexcept = 0;
+};
+
 class Circuit {
 private:
     std::unordered_map<GateId, Gate> gates;
@@ -23,23 +49,43 @@ private:
     std::vector<GateId> dirtyGates;
     std::vector<GateId> updateOrder;
     
+    // 입력 포트 사용 비트셋: 비트 (gateId * MAX_INPUT_PORTS + port)가 1이면 연결됨
+    std::vector<uint64_t> inputPortBits;
+    
+    // 렌더 캐시 동기화용 변경 기록: 추가/제거/위치/선택/출력이 바뀐 게이트 (ID당 한 번)
+    std::vector<GateId> changedGates;
+    std::vector<uint64_t> changedGateBits;
+    
+    std::vector<ICircuitListener*> listeners;
+    
 public:
     Circuit() = default;
-    ~Circuit() = default;
+    ~Circuit();
     
     Circuit(const Circuit&) = delete;
     Circuit& operator=(const Circuit&) = delete;
-    Circuit(Circuit&&) = default;
-    Circuit& operator=(Circuit&&) = default;
+    // 리스너는 Circuit 주소를 들고 있으므로 이동도 금지 (옮기면 통지가 옛 주소로 감)
+    Circuit(Circuit&&) = delete;
+    Circuit& operator=(Circuit&&) = delete;
     
     [[nodiscard]] Result<GateId> addGate(Vec2 position) noexcept;
     ErrorCode removeGate(GateId id) noexcept;
     [[nodiscard]] Gate* getGate(GateId id) noexcept;
     [[nodiscard]] const Gate* getGate(GateId id) const noexcept;
     [[nodiscard]] GateId getGateAt(Vec2 position, float tolerance = 0.5f) const noexcept;
+    // 게이트 위치 변경 (GridMap 갱신과 겹침 검사는 호출자 몫)
+    ErrorCode moveGate(GateId id, Vec2 position) noexcept;
+    
+    // 일괄 추가/제거: 위치 충돌 검사는 호출자가 GridMap으로 미리 수행
+    ErrorCode addGatesBatch(const std::vector<Vec2>& positions,
+                            std::vector<GateId>& outIds) noexcept;
+    size_t connectGatesBatch(const std::vector<GateConnection>& connections) noexcept;
+    ErrorCode removeGates(const std::vector<GateId>& ids) noexcept;
     
+    // path가 두 점 이상이면 그 경로를, 아니면 포트 사이 기본 경로를 씀 (통지 전에 확정)
     [[nodiscard]] Result<WireId> connectGates(
-        GateId fromId, GateId toId, PortIndex toPort) noexcept;
+        GateId fromId, GateId toId, PortIndex toPort,
+        const std::vector<Vec2>* path = nullptr) noexcept;
     ErrorCode addWire(const Wire& wire) noexcept;
     [[nodiscard]] WireId getNextWireId() noexcept { return nextWireId++; }
     ErrorCode removeWire(WireId id) noexcept;
@@ -58,9 +104,29 @@ public:
     [[nodiscard]] bool hasCircularDependency(
         GateId fromId, GateId toId) const noexcept;
     
+    [[nodiscard]] bool isInputPortFree(GateId id, PortIndex port) const noexcept {
+        if (port < 0 || port >= Constants::MAX_INPUT_PORTS) return false;
+        size_t bit = static_cast<size_t>(id) * Constants::MAX_INPUT_PORTS + port;
+        size_t word = bit >> 6;
+        return word >= inputPortBits.size() || !((inputPortBits[word] >> (bit & 63)) & 1ULL);
+    }
+    // 지금까지 발급된 게이트 ID 상한 (ID별 비트셋 크기 계산용)
+    [[nodiscard]] GateId getGateIdLimit() const noexcept { return nextGateId; }
+    
+    // 게이트의 위치/선택 상태/출력을 직접 바꾼 쪽에서 호출 (추가/제거는 Circuit이 기록)
+    void markGateChanged(GateId id) noexcept;
+    // 마지막 호출 이후 바뀐 게이트 ID를 out으로 넘기고 기록을 비움
+    // getGate()가 nullptr인 ID는 그 사이 제거된 게이트
+    void takeChangedGates(std::vector<GateId>& out) noexcept;
+    
+    void addListener(ICircuitListener* listener) noexcept;
+    void removeListener(ICircuitListener* listener) noexcept;
+    
     [[nodiscard]] size_t getGateCount() const noexcept { return gates.size(); }
     [[nodiscard]] size_t getWireCount() const noexcept { return wires.size(); }
     [[nodiscard]] float getSimulationTime() const noexcept { return simulationTime; }
+    // 게이트/와이어 맵과 와이어 경로, 포트 비트셋 등 회로가 잡고 있는 힙
+    [[nodiscard]] MemoryUsage getMemoryUsage() const noexcept;
     [[nodiscard]] bool isRunning() const noexcept { return !isPaused; }
     
     auto gatesBegin() noexcept { return gates.begin(); }
@@ -79,4 +145,7 @@ private:
     void updateTopologicalOrder() noexcept;
     void markGateDirty(GateId id) noexcept;
     void removeGateConnections(GateId id) noexcept;
+    bool detachWire(WireId id) noexcept;
+    void setInputPortUsed(GateId id, PortIndex port, bool used) noexcept;
+    void insertWire(Wire&& wire) noexcept;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "GridMap.h"
+#include <algorithm>
 
 uint32_t GridMap::getCell(Vec2i pos) const noexcept {
     if (!isInBounds(pos)) {
@@ -41,6 +42,89 @@ void GridMap::clearCell(Vec2i pos) noexcept {
     setCell(pos, INVALID_ID);
 }
 
+bool GridMap::areAllFree(const std::vector<Vec2i>& positions) const noexcept {
+    const Chunk* chunk = nullptr;
+    Vec2i cachedCoord{0, 0};
+    bool hasCached = false;
+    
+    for (const Vec2i& pos : positions) {
+        if (!isInBounds(pos)) {
+            return false;
+        }
+        
+        Vec2i chunkCoord = worldToChunk(pos);
+        if (!hasCached || chunkCoord != cachedCoord) {
+            chunk = getChunk(chunkCoord);
+            cachedCoord = chunkCoord;
+            hasCached = true;
+        }
+        
+        if (!chunk) {
+            continue;
+        }
+        
+        Vec2i localPos = worldToLocal(pos);
+        if (chunk->cells[localPos.y * CHUNK_SIZE + localPos.x] != INVALID_ID) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+void GridMap::setCells(const std::vector<Vec2i>& positions,
+                       const std::vector<uint32_t>& ids) noexcept {
+    Chunk* chunk = nullptr;
+    Vec2i cachedCoord{0, 0};
+    bool hasCached = false;
+    size_t count = std::min(positions.size(), ids.size());
+    
+    for (size_t i = 0; i < count; ++i) {
+        const Vec2i& pos = positions[i];
+        if (!isInBounds(pos)) {
+            continue;
+        }
+        
+        Vec2i chunkCoord = worldToChunk(pos);
+        if (!hasCached || chunkCoord != cachedCoord) {
+            chunk = getOrCreateChunk(chunkCoord);
+            cachedCoord = chunkCoord;
+            hasCached = true;
+        }
+        
+        Vec2i localPos = worldToLocal(pos);
+        chunk->cells[localPos.y * CHUNK_SIZE + localPos.x] = ids[i];
+        chunk->isDirty = true;
+    }
+}
+
+void GridMap::clearCells(const std::vector<Vec2i>& positions) noexcept {
+    Chunk* chunk = nullptr;
+    Vec2i cachedCoord{0, 0};
+    bool hasCached = false;
+    
+    for (const Vec2i& pos : positions) {
+        if (!isInBounds(pos)) {
+            continue;
+        }
+        
+        Vec2i chunkCoord = worldToChunk(pos);
+        if (!hasCached || chunkCoord != cachedCoord) {
+            chunk = getChunk(chunkCoord);
+            cachedCoord = chunkCoord;
+            hasCached = true;
+        }
+        
+        if (!chunk) {
+            continue;
+        }
+        
+        Vec2i localPos = worldToLocal(pos);
+        chunk->cells[localPos.y * CHUNK_SIZE + localPos.x] = INVALID_ID;
+        chunk->isDirty = true;
+    }
+}
+
 void GridMap::markChunkDirty(Vec2i chunkCoord) noexcept {
     Chunk* chunk = getChunk(chunkCoord);
     if (chunk) {
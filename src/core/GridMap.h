@@ -13,8 +13,10 @@ struct Vec2iHash {
 };
 
 class GridMap {
-private:
+public:
     static constexpr int CHUNK_SIZE = 32;
+    
+private:
     static constexpr uint32_t INVALID_ID = 0;
     
     struct Chunk {
@@ -38,6 +40,11 @@ public:
     void setCell(Vec2i pos, uint32_t id) noexcept;
     void clearCell(Vec2i pos) noexcept;
     
+    // 일괄 처리: 연속된 좌표가 같은 청크에 있으면 청크 조회를 재사용
+    [[nodiscard]] bool areAllFree(const std::vector<Vec2i>& positions) const noexcept;
+    void setCells(const std::vector<Vec2i>& positions, const std::vector<uint32_t>& ids) noexcept;
+    void clearCells(const std::vector<Vec2i>& positions) noexcept;
+    
     [[nodiscard]] bool isOccupied(Vec2i pos) const noexcept {
         return getCell(pos) != INVALID_ID;
     }
@@ -58,6 +65,12 @@ public:
     
     [[nodiscard]] std::vector<Vec2i> getDirtyChunks() const noexcept;
     
+    // 청크의 셀 배열 (CHUNK_SIZE * CHUNK_SIZE, 행 우선). 청크가 없으면 nullptr
+    [[nodiscard]] const uint32_t* getChunkCells(Vec2i chunkCoord) const noexcept {
+        const Chunk* chunk = getChunk(chunkCoord);
+        return chunk ? chunk->cells.data() : nullptr;
+    }
+    
     void clear() noexcept;
     
     [[nodiscard]] Vec2i worldToChunk(Vec2i worldPos) const noexcept {
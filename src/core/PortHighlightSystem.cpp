@@ -1,6 +1,7 @@
 #include "PortHighlightSystem.h"
 #include "core/Circuit.h"
 #include "core/Gate.h"
+#include "core/GridMap.h"
 #include <algorithm>
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -31,6 +32,19 @@ void PortHighlightSystem::stopHighlighting() noexcept {
     clearAllHighlights();
 }
 
+void PortHighlightSystem::setVisibleRegion(Vec2 min, Vec2 max) noexcept {
+    m_visibleMin = min;
+    m_visibleMax = max;
+    m_hasVisibleRegion = true;
+    
+    // 하이라이트를 만든 영역을 벗어날 때만 다시 만듦
+    if (m_isHighlighting && m_gridMap &&
+        (min.x < m_builtMin.x || min.y < m_builtMin.y ||
+         max.x > m_builtMax.x || max.y > m_builtMax.y)) {
+        updateCompatibility();
+    }
+}
+
 void PortHighlightSystem::highlightPort(GateId gateId, PortIndex port, HighlightType type) noexcept {
     if (!m_circuit) return;
     
@@ -85,6 +99,9 @@ void PortHighlightSystem::clearPortHighlight(GateId gateId, PortIndex port) noex
 void PortHighlightSystem::clearAllHighlights() noexcept {
     m_activeHighlights.clear();
     m_highlightMap.clear();
+    m_hovered.clear();
+    m_bucketCols = 0;
+    m_bucketRows = 0;
 }
 
 bool PortHighlightSystem::isHighlighted(GateId gateId, PortIndex port) const noexcept {
@@ -112,48 +129,208 @@ void PortHighlightSystem::update(float deltaTime) noexcept {
 void PortHighlightSystem::updateCompatibility() noexcept {
     if (!m_circuit) return;
     
-    bool isSourceOutput = (m_sourcePort == Constants::OUTPUT_PORT);
+    clearAllHighlights();
+    collectCycleTargets();
     
-    for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
-        GateId gateId = it->first;
-        if (gateId == m_sourceGate) continue;
+    if (m_gridMap && m_hasVisibleRegion) {
+        // 보이는 영역 + 여유 안의 게이트만 GridMap 청크에서 찾음
+        Vec2 pad = (m_visibleMax - m_visibleMin) * 0.25f + Vec2(1.0f, 1.0f);
+        m_builtMin = m_visibleMin - pad;
+        m_builtMax = m_visibleMax + pad;
+        
+        Vec2i minCell(static_cast<int32_t>(std::floor(m_builtMin.x)),
+                      static_cast<int32_t>(std::floor(m_builtMin.y)));
+        Vec2i maxCell(static_cast<int32_t>(std::floor(m_builtMax.x)),
+                      static_cast<int32_t>(std::floor(m_builtMax.y)));
+        Vec2i minChunk = m_gridMap->worldToChunk(minCell);
+        Vec2i maxChunk = m_gridMap->worldToChunk(maxCell);
         
-        if (isSourceOutput) {
-            for (PortIndex i = 0; i < Constants::MAX_INPUT_PORTS; ++i) {
-                if (isPortCompatible(gateId, i)) {
-                    highlightPort(gateId, i, HighlightType::Compatible);
+        constexpr int CHUNK = GridMap::CHUNK_SIZE;
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                const uint32_t* cells = m_gridMap->getChunkCells(Vec2i(cx, cy));
+                if (!cells) continue;
+                
+                int x0 = std::max(minCell.x - cx * CHUNK, 0);
+                int x1 = std::min(maxCell.x - cx * CHUNK, CHUNK - 1);
+                int y0 = std::max(minCell.y - cy * CHUNK, 0);
+                int y1 = std::min(maxCell.y - cy * CHUNK, CHUNK - 1);
+                
+                for (int y = y0; y <= y1; ++y) {
+                    for (int x = x0; x <= x1; ++x) {
+                        GateId gateId = cells[y * CHUNK + x];
+                        if (gateId != Constants::INVALID_GATE_ID) {
+                            addCompatiblePorts(gateId);
+                        }
+                    }
                 }
             }
-        } else {
-            if (isPortCompatible(gateId, Constants::OUTPUT_PORT)) {
-                highlightPort(gateId, Constants::OUTPUT_PORT, HighlightType::Compatible);
+        }
+    } else {
+        for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
+            addCompatiblePorts(it->first);
+        }
+    }
+    
+    rebuildIndex();
+}
+
+void PortHighlightSystem::collectCycleTargets() noexcept {
+    // 출발 게이트로 신호가 흘러 들어오는 상류 게이트는 연결하면 순환이 생김
+    // (드래그 시작 때 한 번만 계산해 게이트마다 hasCircularDependency를 부르지 않음)
+    m_cycleTargets.assign((static_cast<size_t>(m_circuit->getGateIdLimit()) >> 6) + 1, 0);
+    
+    auto mark = [this](GateId id) {
+        size_t word = static_cast<size_t>(id) >> 6;
+        uint64_t bit = 1ULL << (id & 63);
+        if (word >= m_cycleTargets.size() || (m_cycleTargets[word] & bit)) {
+            return false;
+        }
+        m_cycleTargets[word] |= bit;
+        return true;
+    };
+    
+    std::vector<GateId> stack;
+    if (mark(m_sourceGate)) {
+        stack.push_back(m_sourceGate);
+    }
+    
+    while (!stack.empty()) {
+        const Gate* gate = m_circuit->getGate(stack.back());
+        stack.pop_back();
+        if (!gate) continue;
+        
+        for (WireId wireId : gate->inputWires) {
+            if (wireId == Constants::INVALID_WIRE_ID) continue;
+            
+            const Wire* wire = m_circuit->getWire(wireId);
+            if (wire && wire->fromGateId != Constants::INVALID_GATE_ID && mark(wire->fromGateId)) {
+                stack.push_back(wire->fromGateId);
             }
         }
     }
 }
 
+void PortHighlightSystem::addCompatiblePorts(GateId gateId) noexcept {
+    if (gateId == m_sourceGate) return;
+    
+    const Gate* gate = m_circuit->getGate(gateId);
+    if (!gate) return;
+    
+    auto add = [&](PortIndex port, Vec2 position) {
+        PortHighlight highlight;
+        highlight.gateId = gateId;
+        highlight.portIndex = port;
+        highlight.position = position;
+        highlight.type = HighlightType::Compatible;
+        highlight.intensity = 1.0f;
+        
+        m_highlightMap[std::make_pair(gateId, port)] = m_activeHighlights.size();
+        m_activeHighlights.push_back(highlight);
+    };
+    
+    if (m_sourcePort == Constants::OUTPUT_PORT) {
+        for (PortIndex i = 0; i < Constants::MAX_INPUT_PORTS; ++i) {
+            if (isPortCompatible(gateId, i)) {
+                add(i, gate->getInputPortPosition(i));
+            }
+        }
+    } else if (isPortCompatible(gateId, Constants::OUTPUT_PORT)) {
+        add(Constants::OUTPUT_PORT, gate->getOutputPortPosition());
+    }
+}
+
+void PortHighlightSystem::rebuildIndex() noexcept {
+    m_hovered.clear();
+    m_bucketCols = 0;
+    m_bucketRows = 0;
+    if (m_activeHighlights.empty()) return;
+    
+    Vec2 min = m_activeHighlights.front().position;
+    Vec2 max = min;
+    for (const auto& highlight : m_activeHighlights) {
+        min.x = std::min(min.x, highlight.position.x);
+        min.y = std::min(min.y, highlight.position.y);
+        max.x = std::max(max.x, highlight.position.x);
+        max.y = std::max(max.y, highlight.position.y);
+    }
+    
+    // 버킷 하나가 반경 이상이면 마우스 주변 3x3 버킷만 보면 됨 (버킷 수는 하이라이트 수에 비례하게 제한)
+    m_bucketSize = std::max(m_highlightRadius, 1.0f);
+    const size_t maxBuckets = m_activeHighlights.size() * 4 + 16;
+    while (true) {
+        m_bucketOrigin = Vec2i(static_cast<int32_t>(std::floor(min.x / m_bucketSize)),
+                               static_cast<int32_t>(std::floor(min.y / m_bucketSize)));
+        m_bucketCols = static_cast<int>(std::floor(max.x / m_bucketSize)) - m_bucketOrigin.x + 1;
+        m_bucketRows = static_cast<int>(std::floor(max.y / m_bucketSize)) - m_bucketOrigin.y + 1;
+        if (static_cast<size_t>(m_bucketCols) * m_bucketRows <= maxBuckets) break;
+        m_bucketSize *= 2.0f;
+    }
+    
+    auto bucketOf = [this](Vec2 pos) {
+        int bx = static_cast<int>(std::floor(pos.x / m_bucketSize)) - m_bucketOrigin.x;
+        int by = static_cast<int>(std::floor(pos.y / m_bucketSize)) - m_bucketOrigin.y;
+        return static_cast<size_t>(by) * m_bucketCols + bx;
+    };
+    
+    const size_t bucketCount = static_cast<size_t>(m_bucketCols) * m_bucketRows;
+    m_bucketStart.assign(bucketCount + 1, 0);
+    for (const auto& highlight : m_activeHighlights) {
+        ++m_bucketStart[bucketOf(highlight.position) + 1];
+    }
+    for (size_t i = 1; i <= bucketCount; ++i) {
+        m_bucketStart[i] += m_bucketStart[i - 1];
+    }
+    
+    m_bucketItems.resize(m_activeHighlights.size());
+    std::vector<uint32_t> fill(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (size_t i = 0; i < m_activeHighlights.size(); ++i) {
+        m_bucketItems[fill[bucketOf(m_activeHighlights[i].position)]++] = static_cast<uint32_t>(i);
+    }
+}
+
 void PortHighlightSystem::updateProximity(Vec2 mousePos) noexcept {
     if (!m_circuit) return;
     
+    // 이전 이동에서 Hover였던 하이라이트만 되돌림
+    for (size_t index : m_hovered) {
+        if (index < m_activeHighlights.size() &&
+            m_activeHighlights[index].type == HighlightType::Hover) {
+            m_activeHighlights[index].type = HighlightType::Compatible;
+            m_activeHighlights[index].intensity = 0.7f;
+        }
+    }
+    m_hovered.clear();
+    
+    if (m_bucketCols == 0 || m_bucketRows == 0) return;
+    
     GateId closestGate = Constants::INVALID_GATE_ID;
     PortIndex closestPort = Constants::INVALID_PORT;
     float closestDistance = m_highlightRadius;
     
-    for (auto& highlight : m_activeHighlights) {
-        float distance = calculateDistance(mousePos, highlight.gateId, highlight.portIndex);
-        
-        if (distance < closestDistance) {
-            closestDistance = distance;
-            closestGate = highlight.gateId;
-            closestPort = highlight.portIndex;
-        }
-        
-        if (distance < m_highlightRadius * 0.5f) {
-            highlight.type = HighlightType::Hover;
-            highlight.intensity = 1.0f;
-        } else if (highlight.type == HighlightType::Hover) {
-            highlight.type = HighlightType::Compatible;
-            highlight.intensity = 0.7f;
+    int bx = static_cast<int>(std::floor(mousePos.x / m_bucketSize)) - m_bucketOrigin.x;
+    int by = static_cast<int>(std::floor(mousePos.y / m_bucketSize)) - m_bucketOrigin.y;
+    
+    for (int y = std::max(by - 1, 0); y <= std::min(by + 1, m_bucketRows - 1); ++y) {
+        for (int x = std::max(bx - 1, 0); x <= std::min(bx + 1, m_bucketCols - 1); ++x) {
+            size_t bucket = static_cast<size_t>(y) * m_bucketCols + x;
+            for (uint32_t i = m_bucketStart[bucket]; i < m_bucketStart[bucket + 1]; ++i) {
+                size_t index = m_bucketItems[i];
+                PortHighlight& highlight = m_activeHighlights[index];
+                float distance = (highlight.position - mousePos).length();
+                
+                if (distance < closestDistance) {
+                    closestDistance = distance;
+                    closestGate = highlight.gateId;
+                    closestPort = highlight.portIndex;
+                }
+                
+                if (distance < m_highlightRadius * 0.5f) {
+                    highlight.type = HighlightType::Hover;
+                    highlight.intensity = 1.0f;
+                    m_hovered.push_back(index);
+                }
+            }
         }
     }
     
@@ -182,47 +359,38 @@ void PortHighlightSystem::updateAnimations(float deltaTime) noexcept {
         }
     }
     
-    m_activeHighlights.erase(
-        std::remove_if(m_activeHighlights.begin(), m_activeHighlights.end(),
-            [](const PortHighlight& h) { return h.intensity <= 0.0f; }),
-        m_activeHighlights.end()
-    );
+    auto removed = std::remove_if(m_activeHighlights.begin(), m_activeHighlights.end(),
+        [](const PortHighlight& h) { return h.intensity <= 0.0f; });
+    if (removed != m_activeHighlights.end()) {
+        m_activeHighlights.erase(removed, m_activeHighlights.end());
+        
+        // 인덱스가 바뀌었으므로 맵과 버킷을 다시 만듦
+        m_highlightMap.clear();
+        for (size_t i = 0; i < m_activeHighlights.size(); ++i) {
+            m_highlightMap[std::make_pair(m_activeHighlights[i].gateId,
+                                          m_activeHighlights[i].portIndex)] = i;
+        }
+        rebuildIndex();
+    }
 }
 
 bool PortHighlightSystem::isPortCompatible(GateId gateId, PortIndex port) const noexcept {
     if (!m_circuit) return false;
     
-    const Gate* gate = m_circuit->getGate(gateId);
-    if (!gate) return false;
-    
     bool isSourceOutput = (m_sourcePort == Constants::OUTPUT_PORT);
     bool isTargetInput = (port >= 0 && port < Constants::MAX_INPUT_PORTS);
     
     if (isSourceOutput && !isTargetInput) return false;
     if (!isSourceOutput && isTargetInput) return false;
     
-    if (isTargetInput && !gate->canConnectInput(port)) {
+    if (isTargetInput && !m_circuit->isInputPortFree(gateId, port)) {
         return false;
     }
     
-    if (m_circuit->hasCircularDependency(m_sourceGate, gateId)) {
+    size_t word = static_cast<size_t>(gateId) >> 6;
+    if (word < m_cycleTargets.size() && ((m_cycleTargets[word] >> (gateId & 63)) & 1ULL)) {
         return false;
     }
     
     return true;
 }
-
-float PortHighlightSystem::calculateDistance(Vec2 mousePos, GateId gateId, PortIndex port) const noexcept {
-    if (!m_circuit) return FLT_MAX;
-    
-    const Gate* gate = m_circuit->getGate(gateId);
-    if (!gate) return FLT_MAX;
-    
-    Vec2 portPos;
-    if (port == Constants::OUTPUT_PORT) {
-        portPos = gate->getOutputPortPosition();
-    } else {
-        portPos = gate->getInputPortPosition(port);
-    }
-    return (portPos - mousePos).length();
-}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <functional>
 
 class Circuit;
+class GridMap;
 
 enum class HighlightType {
     None,
@@ -50,6 +51,10 @@ public:
     void setPulseSpeed(float speed) noexcept { m_pulseSpeed = speed; }
     void setFadeSpeed(float speed) noexcept { m_fadeSpeed = speed; }
     
+    // 하이라이트는 보이는 영역의 게이트만 GridMap에서 찾아 만듦 (GridMap이 없으면 전체 게이트)
+    void setGridMap(const GridMap* gridMap) noexcept { m_gridMap = gridMap; }
+    void setVisibleRegion(Vec2 min, Vec2 max) noexcept;
+    
     void update(float deltaTime) noexcept;
     
     using PortHoverCallback = std::function<void(GateId, PortIndex)>;
@@ -60,8 +65,11 @@ private:
     void updateProximity(Vec2 mousePos) noexcept;
     void updateAnimations(float deltaTime) noexcept;
     
+    void collectCycleTargets() noexcept;
+    void addCompatiblePorts(GateId gateId) noexcept;
+    void rebuildIndex() noexcept;
+    
     [[nodiscard]] bool isPortCompatible(GateId gateId, PortIndex port) const noexcept;
-    [[nodiscard]] float calculateDistance(Vec2 mousePos, GateId gateId, PortIndex port) const noexcept;
     
     Circuit* m_circuit;
     std::vector<PortHighlight> m_activeHighlights;
@@ -73,6 +81,27 @@ private:
     
     std::unordered_map<std::pair<GateId, PortIndex>, size_t, PairHash> m_highlightMap;
     
+    const GridMap* m_gridMap{nullptr};
+    
+    // 보이는 영역과 하이라이트를 만든 영역 (여유를 둬서 조금 움직여도 다시 만들지 않음)
+    Vec2 m_visibleMin{0, 0};
+    Vec2 m_visibleMax{0, 0};
+    bool m_hasVisibleRegion{false};
+    Vec2 m_builtMin{0, 0};
+    Vec2 m_builtMax{0, 0};
+    
+    // 출발 게이트의 상류 게이트 (연결하면 순환이 생김), 게이트 ID 비트셋
+    std::vector<uint64_t> m_cycleTargets;
+    
+    // 근접 검색용 버킷 격자 (CSR): 버킷 크기 = 하이라이트 반경
+    float m_bucketSize{1.0f};
+    Vec2i m_bucketOrigin;
+    int m_bucketCols{0};
+    int m_bucketRows{0};
+    std::vector<uint32_t> m_bucketStart;
+    std::vector<uint32_t> m_bucketItems;
+    std::vector<size_t> m_hovered;
+    
     GateId m_sourceGate{Constants::INVALID_GATE_ID};
     PortIndex m_sourcePort{Constants::INVALID_PORT};
     bool m_isHighlighting{false};
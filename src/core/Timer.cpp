@@ -1,7 +1,19 @@
 #include "Timer.h"
 #include <SDL.h>
 #include <algorithm>
+#include <cmath>
 #include <thread>
+#ifdef __linux__
+#include <cerrno>
+#include <time.h>
+#endif
+
+namespace {
+    // 스핀 구간 범위: 너무 짧으면 늦잠에 마감을 놓치고, 길면 CPU를 태움
+    constexpr float MIN_SPIN_MARGIN = 0.00005f;
+    constexpr float MAX_SPIN_MARGIN = 0.002f;
+    constexpr float OVERSLEEP_SMOOTHING = 0.1f;
+}
 
 Timer::Timer(uint32_t targetFPS)
     : m_targetFPS(targetFPS)
@@ -14,9 +26,12 @@ Timer::Timer(uint32_t targetFPS)
     , m_maxFrameTime(0.0f)
     , m_minFrameTime(1000.0f)
     , m_frameTimeAccumulator(0.0f)
-    , m_statFrameCount(0) {
+    , m_statFrameCount(0)
+    , m_oversleepDeviation(0.0f) {
     m_startTime = Clock::now();
     m_lastFrameTime = m_startTime;
+    m_nextDeadline = m_startTime;
+    m_pacing.spinMargin = 0.001f;
 }
 
 Timer::~Timer() = default;
@@ -59,32 +74,81 @@ void Timer::endFrame() {
 }
 
 void Timer::waitForTargetFPS() {
-    TimePoint currentTime = Clock::now();
-    Duration elapsedTime = currentTime - m_frameStartTime;
-    float elapsed = elapsedTime.count();
+    // 마감 시각을 프레임 길이씩 전진 (상대 대기의 오차가 프레임마다 쌓이지 않게)
+    auto frameDuration = std::chrono::duration_cast<Clock::duration>(Duration(m_targetFrameTime));
+    m_nextDeadline += frameDuration;
+    m_pacing.idleWorkTime = 0.0f;
     
-    if (elapsed < m_targetFrameTime) {
-        float sleepTime = m_targetFrameTime - elapsed;
-        
-        if (sleepTime > 0.002f) {
-            SDL_Delay(static_cast<uint32_t>((sleepTime - 0.001f) * 1000));
-        }
-        
-        while (true) {
-            currentTime = Clock::now();
-            elapsedTime = currentTime - m_frameStartTime;
-            if (elapsedTime.count() >= m_targetFrameTime) {
+    TimePoint now = Clock::now();
+    if (m_nextDeadline <= now) {
+        // 이미 늦었으면 따라잡으려 하지 않고 지금을 새 기준으로
+        m_pacing.missedDeadlines++;
+        m_nextDeadline = now;
+        return;
+    }
+    
+    const auto margin = std::chrono::duration_cast<Clock::duration>(Duration(m_pacing.spinMargin));
+    
+    // 남는 시간을 잠 대신 idle 작업에 (작업이 없다고 하거나 시간이 스핀 구간만 남으면 중단)
+    if (m_idleWork) {
+        TimePoint idleStart = now;
+        while (now + margin < m_nextDeadline) {
+            if (!m_idleWork(Duration(m_nextDeadline - margin - now).count())) {
                 break;
             }
+            now = Clock::now();
         }
+        m_pacing.idleWorkTime = Duration(now - idleStart).count();
+    }
+    
+    TimePoint wakeTarget = m_nextDeadline - margin;
+    if (now < wakeTarget) {
+        sleepUntil(wakeTarget);
+        recordOversleep(Duration(Clock::now() - wakeTarget).count());
+    }
+    
+    // 마지막 구간만 스핀
+    while (Clock::now() < m_nextDeadline) {
     }
 }
 
+void Timer::sleepUntil(TimePoint deadline) {
+#ifdef __linux__
+    // libstdc++/libc++의 steady_clock 기준점은 CLOCK_MONOTONIC과 같음
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(sinceEpoch / 1000000000);
+    ts.tv_nsec = static_cast<long>(sinceEpoch % 1000000000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+void Timer::recordOversleep(float oversleep) {
+    oversleep = std::max(0.0f, oversleep);
+    m_pacing.lastOversleep = oversleep;
+    m_pacing.maxOversleep = std::max(m_pacing.maxOversleep, oversleep);
+    
+    // 평균 + 편차의 3배를 스핀 구간으로 (드물게 긴 늦잠까지 대부분 흡수)
+    float error = oversleep - m_pacing.averageOversleep;
+    m_pacing.averageOversleep += OVERSLEEP_SMOOTHING * error;
+    m_oversleepDeviation += OVERSLEEP_SMOOTHING * (std::fabs(error) - m_oversleepDeviation);
+    m_pacing.spinMargin = std::clamp(m_pacing.averageOversleep + 3.0f * m_oversleepDeviation,
+                                     MIN_SPIN_MARGIN, MAX_SPIN_MARGIN);
+}
+
 void Timer::setTargetFPS(uint32_t fps) {
     m_targetFPS = fps;
     m_targetFrameTime = 1.0f / fps;
 }
 
+float Timer::getFrameElapsed() const {
+    Duration elapsed = Clock::now() - m_frameStartTime;
+    return elapsed.count();
+}
+
 float Timer::getTimeSinceStart() const {
     TimePoint currentTime = Clock::now();
     Duration elapsed = currentTime - m_startTime;
@@ -101,4 +165,6 @@ void Timer::resetStats() {
     m_minFrameTime = 1000.0f;
     m_frameTimeAccumulator = 0.0f;
     m_statFrameCount = 0;
+    m_pacing.maxOversleep = 0.0f;
+    m_pacing.missedDeadlines = 0;
 }
\ No newline at end of file
@@ -2,18 +2,37 @@
 
 #include <cstdint>
 #include <chrono>
+#include <functional>
 
 class Timer {
 public:
+    // 프레임 제한 대기 통계 (초)
+    struct PacingStats {
+        float lastOversleep = 0.0f;     // 잠에서 깬 시각 - 요청한 시각
+        float averageOversleep = 0.0f;
+        float maxOversleep = 0.0f;
+        float spinMargin = 0.0f;        // 마감 직전 스핀 구간 (늦잠 통계로 보정)
+        float idleWorkTime = 0.0f;      // 직전 대기 중 idle 작업에 쓴 시간
+        uint32_t missedDeadlines = 0;   // 대기 시작 전에 이미 마감이 지난 프레임 수
+    };
+    
+    // 남은 대기 시간(초) 안에 끝낼 작업을 하나 하고 true, 할 일이 없으면 false (나머지는 잠)
+    using IdleWork = std::function<bool(float remainingSeconds)>;
+    
     explicit Timer(uint32_t targetFPS = 60);
     ~Timer();
     
     void beginFrame();
     void endFrame();
+    // 다음 프레임 마감 시각(절대)까지 대기: 잠으로 대부분을 보내고 마지막 짧은 구간만 스핀
     void waitForTargetFPS();
+    void setIdleWork(IdleWork work) { m_idleWork = std::move(work); }
+    const PacingStats& getPacingStats() const { return m_pacing; }
     
     float getDeltaTime() const { return m_deltaTime; }
     float getTimeSinceStart() const;
+    // beginFrame 이후 지난 시간 (초). 스왑/프레임 제한 대기 전의 작업 시간 측정용
+    float getFrameElapsed() const;
     uint32_t getCurrentTicks() const;
     
     float getCurrentFPS() const { return m_currentFPS; }
@@ -26,7 +45,8 @@ public:
     void resetStats();
     
 private:
-    using Clock = std::chrono::high_resolution_clock;
+    // 절대 시각 대기(CLOCK_MONOTONIC)와 같은 시계를 쓰도록 steady_clock
+    using Clock = std::chrono::steady_clock;
     using TimePoint = std::chrono::time_point<Clock>;
     using Duration = std::chrono::duration<float>;
     
@@ -47,4 +67,12 @@ private:
     float m_minFrameTime;
     float m_frameTimeAccumulator;
     uint32_t m_statFrameCount;
+    
+    TimePoint m_nextDeadline;
+    IdleWork m_idleWork;
+    PacingStats m_pacing;
+    float m_oversleepDeviation;
+    
+    void sleepUntil(TimePoint deadline);
+    void recordOversleep(float oversleep);
 };
\ No newline at end of file
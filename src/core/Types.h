@@ -41,7 +41,8 @@ enum class ErrorCode : int32_t {
     OUT_OF_BOUNDS = -5,
     OUT_OF_MEMORY = -6,
     NOT_INITIALIZED = -7,
-    INVALID_POSITION = -8
+    INVALID_POSITION = -8,
+    INVALID_FORMAT = -9
 };
 
 enum class MouseButton : uint8_t {
@@ -19,6 +19,20 @@ WireManager::WireManager(Circuit* circuit)
 
 WireManager::~WireManager() = default;
 
+void WireManager::setGridMap(const GridMap* gridMap) noexcept {
+    m_gridMap = gridMap;
+    m_pathCalculator->setGridMap(gridMap);
+    m_highlightSystem->setGridMap(gridMap);
+    if (gridMap) {
+        // GridMap 셀은 월드 좌표 1 단위
+        m_pathCalculator->setGridSize(1.0f);
+    }
+}
+
+void WireManager::setVisibleRegion(Vec2 min, Vec2 max) noexcept {
+    m_highlightSystem->setVisibleRegion(min, max);
+}
+
 void WireManager::initialize() noexcept {
     m_previewSystem->setSnapEnabled(true);
     m_previewSystem->setSnapDistance(m_snapDistance);
@@ -83,29 +97,40 @@ void WireManager::onDragMove(const Input::DragEvent& event) noexcept {
     if (!isConnecting()) return;
     
     Vec2 currentPos{event.currentWorld.x, event.currentWorld.y};
-    glm::ivec2 currentGridPos(std::floor(currentPos.x), std::floor(currentPos.y));
     
-    // Check if we moved to a new grid cell
-    if (currentGridPos != m_lastGridPos) {
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[WireManager] Moved to new cell: (%d, %d)", 
-                    currentGridPos.x, currentGridPos.y);
-        
-        // Add intermediate cells if we skipped any
-        std::vector<glm::ivec2> cellPath = bresenhamLine(m_lastGridPos, currentGridPos);
-        
-        for (const auto& gridPos : cellPath) {
-            if (gridPos != m_lastGridPos) {  // Skip the starting cell as it's already in the path
-                Vec2 cellCenter{gridPos.x + 0.5f, gridPos.y + 0.5f};
-                m_dragPath.push_back(cellCenter);
-            }
+    // 병합된 이동이면 프레임 동안 지나온 점을 모두 따라가 경로가 칸을 건너뛰지 않게 함
+    if (event.path && event.pathLength > 0) {
+        for (uint32_t i = 0; i < event.pathLength; ++i) {
+            extendDragPath(glm::ivec2(std::floor(event.path[i].x), std::floor(event.path[i].y)));
         }
-        
-        m_lastGridPos = currentGridPos;
+    } else {
+        extendDragPath(glm::ivec2(std::floor(currentPos.x), std::floor(currentPos.y)));
     }
     
+    // 미리보기는 마지막 위치로 한 번만 갱신
     updateWirePreview(currentPos);
 }
 
+void WireManager::extendDragPath(const glm::ivec2& currentGridPos) noexcept {
+    // Check if we moved to a new grid cell
+    if (currentGridPos == m_lastGridPos) return;
+    
+    SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, "[WireManager] Moved to new cell: (%d, %d)", 
+                   currentGridPos.x, currentGridPos.y);
+    
+    // Add intermediate cells if we skipped any
+    std::vector<glm::ivec2> cellPath = bresenhamLine(m_lastGridPos, currentGridPos);
+    
+    for (const auto& gridPos : cellPath) {
+        if (gridPos != m_lastGridPos) {  // Skip the starting cell as it's already in the path
+            Vec2 cellCenter{gridPos.x + 0.5f, gridPos.y + 0.5f};
+            m_dragPath.push_back(cellCenter);
+        }
+    }
+    
+    m_lastGridPos = currentGridPos;
+}
+
 void WireManager::onDragEnd(const Input::DragEvent& event) noexcept {
     if (!isConnecting()) return;
     if (!m_circuit) return;
@@ -156,7 +181,8 @@ void WireManager::onClick(const Input::ClickEvent& event) noexcept {
 
 Result<WireId> WireManager::createWire(
     GateId fromGate, PortIndex fromPort,
-    GateId toGate, PortIndex toPort) noexcept {
+    GateId toGate, PortIndex toPort,
+    const std::vector<Vec2>* path) noexcept {
     
     if (!m_circuit) {
         return Result<WireId>{Constants::INVALID_WIRE_ID, ErrorCode::NOT_INITIALIZED};
@@ -167,7 +193,7 @@ Result<WireId> WireManager::createWire(
         return Result<WireId>{Constants::INVALID_WIRE_ID, validation.errorCode};
     }
     
-    auto result = m_circuit->connectGates(fromGate, toGate, toPort);
+    auto result = m_circuit->connectGates(fromGate, toGate, toPort, path);
     
     if (result.success() && m_onWireCreated) {
         m_onWireCreated(result.value);
@@ -312,17 +338,15 @@ void WireManager::completeWireConnection(GateId targetGate, PortIndex targetPort
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[WireManager] Completing wire connection to gate %d port %d", 
                 targetGate, targetPort);
     
+    // 미리보기 경로를 생성 시점에 넘겨 리스너(HitDetector 등)가 최종 경로로 색인하게 함
     auto result = createWire(
         m_context.sourceGateId, m_context.sourcePort,
-        targetGate, targetPort
+        targetGate, targetPort,
+        &m_context.previewPath
     );
     
     if (result.success()) {
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[WireManager] Wire created successfully with ID: %d", result.value);
-        Wire* wire = m_circuit->getWire(result.value);
-        if (wire) {
-            wire->pathPoints = m_context.previewPath;
-        }
     } else {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[WireManager] Failed to create wire, error code: %d", 
                      static_cast<int>(result.error));
@@ -398,7 +422,7 @@ void WireManager::calculatePreviewPath() noexcept {
     
     m_context.previewPath = m_pathCalculator->calculatePath(
         start, end, 
-        PathStyle::Manhattan, 
+        m_gridMap ? PathStyle::Smart : PathStyle::Manhattan, 
         constraints
     );
 }
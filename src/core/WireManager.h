@@ -15,6 +15,7 @@ class WirePreviewSystem;
 class PortHighlightSystem;
 class WirePathCalculator;
 class ConnectionValidator;
+class GridMap;
 
 enum class WireConnectionState {
     Idle,
@@ -62,7 +63,8 @@ public:
     
     [[nodiscard]] Result<WireId> createWire(
         GateId fromGate, PortIndex fromPort,
-        GateId toGate, PortIndex toPort) noexcept;
+        GateId toGate, PortIndex toPort,
+        const std::vector<Vec2>* path = nullptr) noexcept;
     
     ErrorCode deleteWire(WireId wireId) noexcept;
     ErrorCode deleteWiresAt(Vec2 position, float tolerance = 0.1f) noexcept;
@@ -96,6 +98,11 @@ public:
     void setSnapDistance(float distance) noexcept { m_snapDistance = distance; }
     void setPathSmoothing(bool enable) noexcept { m_enablePathSmoothing = enable; }
     
+    // GridMap이 연결되면 미리보기 경로를 게이트 회피 라우터로 계산하고,
+    // 포트 하이라이트도 보이는 영역의 게이트만 GridMap에서 찾음
+    void setGridMap(const GridMap* gridMap) noexcept;
+    void setVisibleRegion(Vec2 min, Vec2 max) noexcept;
+    
     using WireCreatedCallback = std::function<void(WireId)>;
     using WireDeletedCallback = std::function<void(WireId)>;
     using ConnectionStateChangedCallback = std::function<void(WireConnectionState)>;
@@ -122,8 +129,11 @@ private:
     void createCellToCellWire(Vec2 startPos, Vec2 endPos) noexcept;
     void createPathWire(const std::vector<Vec2>& path) noexcept;
     std::vector<glm::ivec2> bresenhamLine(glm::ivec2 start, glm::ivec2 end) const noexcept;
+    // 드래그 경로에 m_lastGridPos부터 currentGridPos까지의 셀 중심을 추가
+    void extendDragPath(const glm::ivec2& currentGridPos) noexcept;
     
     Circuit* m_circuit;
+    const GridMap* m_gridMap{nullptr};
     WireConnectionContext m_context;
     
     std::unique_ptr<WirePreviewSystem> m_previewSystem;
@@ -1,17 +1,14 @@
 #include "WirePathCalculator.h"
 #include "core/Circuit.h"
 #include "core/Gate.h"
+#include "core/GridMap.h"
 #include <algorithm>
+#include <bit>
 #include <cmath>
-#include <queue>
-#include <unordered_map>
 
 WirePathCalculator::WirePathCalculator(Circuit* circuit)
     : m_circuit(circuit) {
-    m_nodePool.reserve(1000);
-    for (size_t i = 0; i < 1000; ++i) {
-        m_nodePool.push_back(std::make_unique<PathNode>());
-    }
+    m_openHeap.reserve(256);
 }
 
 std::vector<Vec2> WirePathCalculator::calculatePath(
@@ -84,70 +81,121 @@ std::vector<Vec2> WirePathCalculator::calculateSmartPath(
     Vec2 start, Vec2 end,
     const PathConstraints& constraints) noexcept {
     
-    resetNodePool();
+    m_lastStats = PathSearchStats{};
     
-    if (m_gridSnapping) {
-        start = snapToGrid(start);
-        end = snapToGrid(end);
+    // 피할 대상이 없으면 탐색할 필요가 없음
+    if (!constraints.avoidGates) {
+        return calculateManhattanPath(start, end);
     }
     
-    auto cmp = [](const PathNode* a, const PathNode* b) {
-        return a->fCost() > b->fCost();
+    Vec2i startCell{
+        static_cast<int32_t>(std::lround(start.x / m_gridSize)),
+        static_cast<int32_t>(std::lround(start.y / m_gridSize))
     };
-    std::priority_queue<PathNode*, std::vector<PathNode*>, decltype(cmp)> openSet(cmp);
-    std::unordered_map<uint64_t, PathNode*> closedSet;
-    
-    auto posToKey = [this](Vec2 pos) -> uint64_t {
-        int gridX = static_cast<int>(pos.x / m_gridSize);
-        int gridY = static_cast<int>(pos.y / m_gridSize);
-        return (static_cast<uint64_t>(gridX) << 32) | static_cast<uint64_t>(gridY);
+    Vec2i goalCell{
+        static_cast<int32_t>(std::lround(end.x / m_gridSize)),
+        static_cast<int32_t>(std::lround(end.y / m_gridSize))
     };
     
-    PathNode* startNode = getNode();
-    startNode->position = start;
-    startNode->gCost = 0;
-    startNode->hCost = heuristic(start, end);
-    startNode->parent = nullptr;
+    if (!beginSearch(startCell, goalCell, std::max(1, constraints.searchMargin))) {
+        return calculateManhattanPath(start, end);
+    }
+    
+    const int32_t startIndex = cellIndex(startCell.x, startCell.y);
+    const int32_t goalIndex = cellIndex(goalCell.x, goalCell.y);
     
-    openSet.push(startNode);
+    m_parent[startIndex] = -1;
+    pushOpen(startIndex, 0, startCell.x, startCell.y);
     
-    while (!openSet.empty()) {
-        PathNode* current = openSet.top();
-        openSet.pop();
+    auto cmp = [](const OpenEntry& a, const OpenEntry& b) {
+        return a.f > b.f || (a.f == b.f && a.h > b.h);
+    };
+    
+    while (!m_openHeap.empty()) {
+        std::pop_heap(m_openHeap.begin(), m_openHeap.end(), cmp);
+        const int32_t current = m_openHeap.back().cell;
+        m_openHeap.pop_back();
         
-        if ((current->position - end).length() < m_gridSize * 0.5f) {
-            return reconstructPath(current);
+        if (m_closedStamp[current] == m_generation) {
+            continue;  // 더 짧은 경로로 이미 확장된 오래된 항목
         }
+        m_closedStamp[current] = m_generation;
         
-        uint64_t currentKey = posToKey(current->position);
-        if (closedSet.find(currentKey) != closedSet.end()) {
-            continue;
+        if (current == goalIndex) {
+            m_lastStats.found = true;
+            break;
         }
-        closedSet[currentKey] = current;
         
-        auto neighbors = getNeighbors(current, end);
-        for (PathNode* neighbor : neighbors) {
-            uint64_t neighborKey = posToKey(neighbor->position);
-            if (closedSet.find(neighborKey) != closedSet.end()) {
-                continue;
+        if (++m_lastStats.expandedNodes > constraints.maxExpansions) {
+            break;
+        }
+        
+        const int x = current % m_window.width + m_window.x0;
+        const int y = current / m_window.width + m_window.y0;
+        const uint32_t g = m_gCost[current];
+        
+        // 진행 방향에 따라 가지치기한 이웃 방향 (시작점은 4방향 모두)
+        int dirs[4][2];
+        int dirCount = 0;
+        const int32_t parent = m_parent[current];
+        if (parent < 0) {
+            const int all[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            for (const auto& d : all) {
+                dirs[dirCount][0] = d[0];
+                dirs[dirCount][1] = d[1];
+                ++dirCount;
             }
-            
-            if (constraints.avoidGates && isPositionBlocked(neighbor->position)) {
+        } else {
+            const int px = parent % m_window.width + m_window.x0;
+            const int py = parent / m_window.width + m_window.y0;
+            const int dx = (x > px) - (x < px);
+            const int dy = (y > py) - (y < py);
+            if (dx != 0) {
+                dirs[0][0] = 0;  dirs[0][1] = -1;
+                dirs[1][0] = 0;  dirs[1][1] = 1;
+                dirs[2][0] = dx; dirs[2][1] = 0;
+            } else {
+                dirs[0][0] = -1; dirs[0][1] = 0;
+                dirs[1][0] = 1;  dirs[1][1] = 0;
+                dirs[2][0] = 0;  dirs[2][1] = dy;
+            }
+            dirCount = 3;
+        }
+        
+        for (int i = 0; i < dirCount; ++i) {
+            const int32_t jumpPoint = jump(x + dirs[i][0], y + dirs[i][1], dirs[i][0], dirs[i][1]);
+            if (jumpPoint < 0 || m_closedStamp[jumpPoint] == m_generation) {
                 continue;
             }
             
-            float newGCost = current->gCost + (neighbor->position - current->position).length();
+            const int jx = jumpPoint % m_window.width + m_window.x0;
+            const int jy = jumpPoint / m_window.width + m_window.y0;
+            const uint32_t newG = g + static_cast<uint32_t>(std::abs(jx - x) + std::abs(jy - y));
             
-            if (newGCost < neighbor->gCost) {
-                neighbor->parent = current;
-                neighbor->gCost = newGCost;
-                neighbor->hCost = heuristic(neighbor->position, end);
-                openSet.push(neighbor);
+            if (m_openStamp[jumpPoint] != m_generation || newG < m_gCost[jumpPoint]) {
+                m_parent[jumpPoint] = current;
+                pushOpen(jumpPoint, newG, jx, jy);
+                ++m_lastStats.jumpPoints;
             }
         }
     }
     
-    return calculateManhattanPath(start, end);
+    m_openHeap.clear();
+    
+    if (!m_lastStats.found) {
+        return calculateManhattanPath(start, end);
+    }
+    
+    auto path = reconstructPath(goalIndex);
+    if (!m_gridSnapping) {
+        path.front() = start;
+        path.back() = end;
+    }
+    
+    if (m_optimizePath) {
+        return optimizePath(path);
+    }
+    return path;
 }
 
 std::vector<Vec2> WirePathCalculator::smoothPath(
@@ -232,42 +280,277 @@ bool WirePathCalculator::isPathClear(
     return true;
 }
 
-std::vector<Vec2> WirePathCalculator::reconstructPath(PathNode* endNode) const noexcept {
-    std::vector<Vec2> path;
-    PathNode* current = endNode;
+bool WirePathCalculator::beginSearch(Vec2i start, Vec2i goal, int margin) noexcept {
+    // 시작/끝 경계 상자에 여유를 둔 창 안에서만 탐색 (창 밖은 막힌 칸으로 취급)
+    constexpr int64_t MAX_WINDOW_CELLS = 1 << 22;
+    
+    const int x0 = std::min(start.x, goal.x) - margin;
+    const int y0 = std::min(start.y, goal.y) - margin;
+    const int x1 = std::max(start.x, goal.x) + margin;
+    const int y1 = std::max(start.y, goal.y) + margin;
+    
+    const int64_t width = static_cast<int64_t>(x1) - x0 + 1;
+    const int64_t height = static_cast<int64_t>(y1) - y0 + 1;
+    if (width * height > MAX_WINDOW_CELLS) {
+        return false;
+    }
     
-    while (current != nullptr) {
-        path.push_back(current->position);
-        current = current->parent;
+    m_window = SearchWindow{x0, y0, static_cast<int>(width), static_cast<int>(height)};
+    m_start = start;
+    m_goal = goal;
+    m_rowWords = static_cast<int>((width + 63) / 64);
+    
+    const size_t cellCount = static_cast<size_t>(width * height);
+    m_lastStats.windowCells = cellCount;
+    if (m_openStamp.size() < cellCount) {
+        m_openStamp.resize(cellCount, 0);
+        m_closedStamp.resize(cellCount, 0);
+        m_gCost.resize(cellCount, 0);
+        m_parent.resize(cellCount, -1);
+    }
+    if (m_rowStamp.size() < static_cast<size_t>(height)) {
+        m_rowStamp.resize(static_cast<size_t>(height), 0);
+    }
+    const size_t bitWords = static_cast<size_t>(height) * m_rowWords;
+    if (m_blockedBits.size() < bitWords) {
+        m_blockedBits.resize(bitWords, 0);
+    }
+    if (m_solidRow.size() < static_cast<size_t>(m_rowWords)) {
+        m_solidRow.resize(static_cast<size_t>(m_rowWords), ~0ULL);
     }
     
-    std::reverse(path.begin(), path.end());
-    return path;
+    if (m_gridMap) {
+        auto toWorldCell = [this](int x, int y) {
+            return Vec2i{
+                static_cast<int32_t>(std::floor(x * m_gridSize)),
+                static_cast<int32_t>(std::floor(y * m_gridSize))
+            };
+        };
+        const Vec2i minChunk = m_gridMap->worldToChunk(toWorldCell(x0, y0));
+        const Vec2i maxChunk = m_gridMap->worldToChunk(toWorldCell(x1, y1));
+        m_chunkOrigin = minChunk;
+        m_chunkCols = maxChunk.x - minChunk.x + 1;
+        m_chunkRows = maxChunk.y - minChunk.y + 1;
+        
+        const size_t chunkCount = static_cast<size_t>(m_chunkCols) * m_chunkRows;
+        if (m_chunkCells.size() < chunkCount) {
+            m_chunkCells.resize(chunkCount, nullptr);
+            m_chunkStamp.resize(chunkCount, 0);
+        }
+    }
+    
+    // 세대가 한 바퀴 돌면 스탬프를 한 번 비워 오래된 값과 구분
+    if (++m_generation == 0) {
+        std::fill(m_openStamp.begin(), m_openStamp.end(), 0);
+        std::fill(m_closedStamp.begin(), m_closedStamp.end(), 0);
+        std::fill(m_rowStamp.begin(), m_rowStamp.end(), 0);
+        std::fill(m_chunkStamp.begin(), m_chunkStamp.end(), 0);
+        m_generation = 1;
+    }
+    
+    m_openHeap.clear();
+    return true;
 }
 
-std::vector<WirePathCalculator::PathNode*> WirePathCalculator::getNeighbors(
-    PathNode* node, Vec2 target) noexcept {
+const uint64_t* WirePathCalculator::getBlockedRow(int localY) noexcept {
+    if (localY < 0 || localY >= m_window.height) {
+        return m_solidRow.data();
+    }
     
-    std::vector<PathNode*> neighbors;
+    uint64_t* row = m_blockedBits.data() + static_cast<size_t>(localY) * m_rowWords;
+    if (m_rowStamp[localY] != m_generation) {
+        m_rowStamp[localY] = m_generation;
+        fillBlockedRow(localY, row);
+    }
+    return row;
+}
+
+void WirePathCalculator::fillBlockedRow(int localY, uint64_t* row) noexcept {
+    std::fill(row, row + m_rowWords, 0ULL);
+    
+    const int y = m_window.y0 + localY;
+    const int width = m_window.width;
+    
+    if (m_gridMap && m_gridSize == 1.0f) {
+        // 격자 칸과 GridMap 셀이 일치하면 청크 행을 통째로 읽음
+        int lx = 0;
+        while (lx < width) {
+            const Vec2i worldCell{m_window.x0 + lx, y};
+            const Vec2i local = m_gridMap->worldToLocal(worldCell);
+            const int span = std::min(GridMap::CHUNK_SIZE - local.x, width - lx);
+            
+            if (const uint32_t* cells = getChunkCells(m_gridMap->worldToChunk(worldCell))) {
+                const uint32_t* cellRow = cells + local.y * GridMap::CHUNK_SIZE + local.x;
+                for (int i = 0; i < span; ++i) {
+                    if (cellRow[i] != Constants::INVALID_GATE_ID) {
+                        row[(lx + i) >> 6] |= 1ULL << ((lx + i) & 63);
+                    }
+                }
+            }
+            lx += span;
+        }
+    } else {
+        for (int lx = 0; lx < width; ++lx) {
+            if (queryBlocked(m_window.x0 + lx, y)) {
+                row[lx >> 6] |= 1ULL << (lx & 63);
+            }
+        }
+    }
     
-    const float step = m_gridSize;
-    const Vec2 offsets[] = {
-        {step, 0}, {-step, 0}, {0, step}, {0, -step}
+    // 창 오른쪽 여분 비트는 막힌 칸
+    if (width & 63) {
+        row[m_rowWords - 1] |= ~0ULL << (width & 63);
+    }
+    
+    // 포트가 놓인 끝점은 항상 통과
+    if (y == m_start.y) {
+        const int lx = m_start.x - m_window.x0;
+        row[lx >> 6] &= ~(1ULL << (lx & 63));
+    }
+    if (y == m_goal.y) {
+        const int lx = m_goal.x - m_window.x0;
+        row[lx >> 6] &= ~(1ULL << (lx & 63));
+    }
+}
+
+bool WirePathCalculator::isCellBlocked(int x, int y) noexcept {
+    const int lx = x - m_window.x0;
+    if (lx < 0 || lx >= m_window.width) {
+        return true;
+    }
+    const uint64_t* row = getBlockedRow(y - m_window.y0);
+    return (row[lx >> 6] >> (lx & 63)) & 1ULL;
+}
+
+const uint32_t* WirePathCalculator::getChunkCells(Vec2i chunk) noexcept {
+    const size_t slot = static_cast<size_t>(chunk.y - m_chunkOrigin.y) * m_chunkCols +
+                        static_cast<size_t>(chunk.x - m_chunkOrigin.x);
+    if (m_chunkStamp[slot] != m_generation) {
+        m_chunkStamp[slot] = m_generation;
+        m_chunkCells[slot] = m_gridMap->getChunkCells(chunk);
+    }
+    return m_chunkCells[slot];
+}
+
+bool WirePathCalculator::queryBlocked(int x, int y) noexcept {
+    if (!m_gridMap) {
+        return isPositionBlocked(Vec2{x * m_gridSize, y * m_gridSize});
+    }
+    
+    const Vec2i worldCell{
+        static_cast<int32_t>(std::floor(x * m_gridSize)),
+        static_cast<int32_t>(std::floor(y * m_gridSize))
     };
+    const uint32_t* cells = getChunkCells(m_gridMap->worldToChunk(worldCell));
+    if (!cells) {
+        return false;
+    }
+    const Vec2i local = m_gridMap->worldToLocal(worldCell);
+    return cells[local.y * GridMap::CHUNK_SIZE + local.x] != Constants::INVALID_GATE_ID;
+}
+
+int32_t WirePathCalculator::jump(int x, int y, int dx, int dy) noexcept {
+    if (dx != 0) {
+        return jumpHorizontal(x, y, dx);
+    }
     
-    for (const auto& offset : offsets) {
-        Vec2 newPos = node->position + offset;
-        
-        PathNode* neighbor = getNode();
-        neighbor->position = newPos;
-        neighbor->gCost = FLT_MAX;
-        neighbor->hCost = 0;
-        neighbor->parent = nullptr;
-        
-        neighbors.push_back(neighbor);
+    // 세로 점프: 강제 이웃, 목표 행, 목표 칸, 가로 방향 점프점이 있는 칸에서 멈춤
+    while (true) {
+        if (isCellBlocked(x, y)) {
+            return -1;
+        }
+        if (y == m_goal.y) {
+            return cellIndex(x, y);
+        }
+        if ((!isCellBlocked(x - 1, y) && isCellBlocked(x - 1, y - dy)) ||
+            (!isCellBlocked(x + 1, y) && isCellBlocked(x + 1, y - dy))) {
+            return cellIndex(x, y);
+        }
+        if (jumpHorizontal(x + 1, y, 1) >= 0 || jumpHorizontal(x - 1, y, -1) >= 0) {
+            return cellIndex(x, y);
+        }
+        y += dy;
+    }
+}
+
+int32_t WirePathCalculator::jumpHorizontal(int x, int y, int dx) noexcept {
+    // 가로 점프는 행 비트셋을 64칸씩 훑음: 막힌 칸, 강제 이웃, 목표 열 중 처음 나오는 칸
+    const int lx = x - m_window.x0;
+    if (lx < 0 || lx >= m_window.width) {
+        return -1;
     }
     
-    return neighbors;
+    const int ly = y - m_window.y0;
+    const uint64_t* row = getBlockedRow(ly);
+    const uint64_t* up = getBlockedRow(ly - 1);
+    const uint64_t* down = getBlockedRow(ly + 1);
+    const int goalX = m_goal.x - m_window.x0;
+    const int words = m_rowWords;
+    
+    int stop = -1;
+    if (dx > 0) {
+        for (int k = lx >> 6; k < words; ++k) {
+            const uint64_t upBehind = (up[k] << 1) | (k == 0 ? 1ULL : up[k - 1] >> 63);
+            const uint64_t downBehind = (down[k] << 1) | (k == 0 ? 1ULL : down[k - 1] >> 63);
+            uint64_t mask = row[k] | (~up[k] & upBehind) | (~down[k] & downBehind);
+            if ((goalX >> 6) == k) {
+                mask |= 1ULL << (goalX & 63);
+            }
+            if (k == (lx >> 6)) {
+                mask &= ~0ULL << (lx & 63);
+            }
+            if (mask) {
+                stop = (k << 6) + std::countr_zero(mask);
+                break;
+            }
+        }
+    } else {
+        for (int k = lx >> 6; k >= 0; --k) {
+            const uint64_t upBehind = (up[k] >> 1) | (k + 1 >= words ? 1ULL : up[k + 1] & 1ULL) << 63;
+            const uint64_t downBehind = (down[k] >> 1) | (k + 1 >= words ? 1ULL : down[k + 1] & 1ULL) << 63;
+            uint64_t mask = row[k] | (~up[k] & upBehind) | (~down[k] & downBehind);
+            if ((goalX >> 6) == k) {
+                mask |= 1ULL << (goalX & 63);
+            }
+            if (k == (lx >> 6) && (lx & 63) != 63) {
+                mask &= (1ULL << ((lx & 63) + 1)) - 1;
+            }
+            if (mask) {
+                stop = (k << 6) + 63 - std::countl_zero(mask);
+                break;
+            }
+        }
+    }
+    
+    if (stop < 0 || stop >= m_window.width || ((row[stop >> 6] >> (stop & 63)) & 1ULL)) {
+        return -1;
+    }
+    return ly * m_window.width + stop;
+}
+
+void WirePathCalculator::pushOpen(int32_t cell, uint32_t g, int x, int y) noexcept {
+    const uint32_t h = static_cast<uint32_t>(std::abs(x - m_goal.x) + std::abs(y - m_goal.y));
+    m_gCost[cell] = g;
+    m_openStamp[cell] = m_generation;
+    
+    m_openHeap.push_back(OpenEntry{g + h, h, cell});
+    std::push_heap(m_openHeap.begin(), m_openHeap.end(),
+        [](const OpenEntry& a, const OpenEntry& b) {
+            return a.f > b.f || (a.f == b.f && a.h > b.h);
+        });
+}
+
+std::vector<Vec2> WirePathCalculator::reconstructPath(int32_t goalCell) const noexcept {
+    std::vector<Vec2> path;
+    
+    for (int32_t cell = goalCell; cell >= 0; cell = m_parent[cell]) {
+        const int x = cell % m_window.width + m_window.x0;
+        const int y = cell / m_window.width + m_window.y0;
+        path.push_back(Vec2{x * m_gridSize, y * m_gridSize});
+    }
+    
+    std::reverse(path.begin(), path.end());
+    return path;
 }
 
 float WirePathCalculator::heuristic(Vec2 a, Vec2 b) const noexcept {
@@ -311,14 +594,3 @@ std::vector<Vec2> WirePathCalculator::optimizePath(const std::vector<Vec2>& path
     optimized.push_back(path.back());
     return optimized;
 }
-
-WirePathCalculator::PathNode* WirePathCalculator::getNode() noexcept {
-    if (m_nextNodeIndex >= m_nodePool.size()) {
-        m_nodePool.push_back(std::make_unique<PathNode>());
-    }
-    return m_nodePool[m_nextNodeIndex++].get();
-}
-
-void WirePathCalculator::resetNodePool() noexcept {
-    m_nextNodeIndex = 0;
-}
\ No newline at end of file
@@ -3,9 +3,10 @@
 #include "core/Types.h"
 #include "core/Vec2.h"
 #include <vector>
-#include <memory>
+#include <cstdint>
 
 class Circuit;
+class GridMap;
 
 enum class PathStyle {
     Direct,
@@ -20,6 +21,15 @@ struct PathConstraints {
     float minSegmentLength{5.0f};
     float cornerRadius{0.0f};
     int maxSegments{10};
+    int searchMargin{16};           // 시작/끝 경계 상자 바깥으로 허용할 탐색 여유 (격자 칸)
+    size_t maxExpansions{20000};    // 이 이상 확장하면 맨해튼 경로로 대체
+};
+
+struct PathSearchStats {
+    size_t expandedNodes{0};
+    size_t jumpPoints{0};
+    size_t windowCells{0};
+    bool found{false};
 };
 
 class WirePathCalculator {
@@ -57,18 +67,40 @@ public:
     void setGridSize(float size) noexcept { m_gridSize = size; }
     void setOptimizePath(bool enable) noexcept { m_optimizePath = enable; }
     
+    // 게이트 점유 조회를 GridMap 청크로 처리 (nullptr이면 Circuit 조회)
+    void setGridMap(const GridMap* gridMap) noexcept { m_gridMap = gridMap; }
+    
+    [[nodiscard]] const PathSearchStats& getLastSearchStats() const noexcept { return m_lastStats; }
+    
 private:
-    struct PathNode {
-        Vec2 position;
-        float gCost;
-        float hCost;
-        float fCost() const { return gCost + hCost; }
-        PathNode* parent;
+    // 열린 목록 항목 (평탄한 이진 힙)
+    struct OpenEntry {
+        uint32_t f;
+        uint32_t h;
+        int32_t cell;
     };
     
-    [[nodiscard]] std::vector<Vec2> reconstructPath(PathNode* endNode) const noexcept;
-    [[nodiscard]] std::vector<PathNode*> getNeighbors(
-        PathNode* node, Vec2 target) noexcept;
+    // 탐색 창: 격자 좌표 (x0, y0)부터 width x height 칸
+    struct SearchWindow {
+        int x0{0};
+        int y0{0};
+        int width{0};
+        int height{0};
+    };
+    
+    bool beginSearch(Vec2i start, Vec2i goal, int margin) noexcept;
+    [[nodiscard]] int32_t cellIndex(int x, int y) const noexcept {
+        return (y - m_window.y0) * m_window.width + (x - m_window.x0);
+    }
+    [[nodiscard]] const uint64_t* getBlockedRow(int localY) noexcept;
+    void fillBlockedRow(int localY, uint64_t* row) noexcept;
+    [[nodiscard]] bool isCellBlocked(int x, int y) noexcept;
+    [[nodiscard]] bool queryBlocked(int x, int y) noexcept;
+    [[nodiscard]] const uint32_t* getChunkCells(Vec2i chunk) noexcept;
+    [[nodiscard]] int32_t jump(int x, int y, int dx, int dy) noexcept;
+    [[nodiscard]] int32_t jumpHorizontal(int x, int y, int dx) noexcept;
+    void pushOpen(int32_t cell, uint32_t g, int x, int y) noexcept;
+    [[nodiscard]] std::vector<Vec2> reconstructPath(int32_t goalCell) const noexcept;
     [[nodiscard]] float heuristic(Vec2 a, Vec2 b) const noexcept;
     [[nodiscard]] bool isPositionBlocked(Vec2 pos) const noexcept;
     
@@ -80,10 +112,31 @@ private:
     bool m_gridSnapping{true};
     float m_gridSize{Constants::GRID_CELL_SIZE};
     bool m_optimizePath{true};
+    const GridMap* m_gridMap{nullptr};
+    
+    // 탐색 버퍼: 세대 스탬프로 유효성을 판단하므로 호출마다 초기화하지 않고 재사용
+    SearchWindow m_window;
+    Vec2i m_start;
+    Vec2i m_goal;
+    uint32_t m_generation{0};
+    std::vector<uint32_t> m_openStamp;
+    std::vector<uint32_t> m_closedStamp;
+    
+    // 막힌 칸 비트셋 (행마다 m_rowWords 워드, 처음 접근할 때 채움)
+    int m_rowWords{0};
+    std::vector<uint32_t> m_rowStamp;
+    std::vector<uint64_t> m_blockedBits;
+    std::vector<uint64_t> m_solidRow;
+    std::vector<uint32_t> m_gCost;
+    std::vector<int32_t> m_parent;
+    std::vector<OpenEntry> m_openHeap;
     
-    std::vector<std::unique_ptr<PathNode>> m_nodePool;
-    size_t m_nextNodeIndex{0};
+    // 탐색 창이 걸친 GridMap 청크의 셀 포인터 캐시
+    Vec2i m_chunkOrigin;
+    int m_chunkCols{0};
+    int m_chunkRows{0};
+    std::vector<const uint32_t*> m_chunkCells;
+    std::vector<uint32_t> m_chunkStamp;
     
-    PathNode* getNode() noexcept;
-    void resetNodePool() noexcept;
+    PathSearchStats m_lastStats;
 };
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "ClipboardBlock.h"
+#include "../core/CellWire.h"
+#include <cstring>
+
+namespace {
+    constexpr uint32_t BLOCK_MAGIC = 0x4B4C4243;  // "CBLK"
+    constexpr uint32_t BLOCK_VERSION = 2;         // 2: 필드 단위 리틀 엔디언 (1은 구조체를 패딩째 복사)
+    
+    // 필드를 하나씩 고정 폭 리틀 엔디언으로 기록 (구조체 패딩/호스트 엔디언이 바이트에 섞이지 않음)
+    constexpr size_t HEADER_BYTES = 7 * sizeof(uint32_t);
+    constexpr size_t GATE_ENTRY_BYTES = 2 * sizeof(int32_t) + sizeof(uint8_t);
+    constexpr size_t CONNECTION_ENTRY_BYTES = 2 * sizeof(uint32_t) + sizeof(int8_t);
+    constexpr size_t CELL_ENTRY_BYTES = 2 * sizeof(int32_t) + sizeof(uint8_t);
+    
+    constexpr uint8_t MAX_GATE_TYPE = static_cast<uint8_t>(GateType::NOT);
+    constexpr uint8_t VALID_DIRECTIONS = static_cast<uint8_t>(WireDirection::All);
+    
+    bool insideBlock(Vec2i offset, Vec2i size) noexcept {
+        return offset.x >= 0 && offset.y >= 0 && offset.x < size.x && offset.y < size.y;
+    }
+    
+    constexpr char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    
+    int base64Value(char c) noexcept {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+') return 62;
+        if (c == '/') return 63;
+        return -1;
+    }
+    
+    class ByteWriter {
+    public:
+        explicit ByteWriter(std::vector<uint8_t>& out) noexcept : m_out(out) {}
+        
+        void u8(uint8_t value) { m_out.push_back(value); }
+        void u32(uint32_t value) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                m_out.push_back(static_cast<uint8_t>(value >> shift));
+            }
+        }
+        void i32(int32_t value) { u32(static_cast<uint32_t>(value)); }
+        
+    private:
+        std::vector<uint8_t>& m_out;
+    };
+    
+    // 범위를 넘는 읽기는 0을 돌려주고 실패로 기록 (호출 측은 ok()만 확인)
+    class ByteReader {
+    public:
+        explicit ByteReader(const std::vector<uint8_t>& data) noexcept : m_data(data) {}
+        
+        uint8_t u8() noexcept {
+            if (!require(1)) return 0;
+            return m_data[m_cursor++];
+        }
+        uint32_t u32() noexcept {
+            if (!require(4)) return 0;
+            uint32_t value = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                value |= static_cast<uint32_t>(m_data[m_cursor++]) << shift;
+            }
+            return value;
+        }
+        int32_t i32() noexcept { return static_cast<int32_t>(u32()); }
+        
+        // count개 항목이 남은 바이트에 들어가는지 (손상된 개수로 큰 할당을 하지 않도록 미리 확인)
+        [[nodiscard]] bool fits(uint32_t count, size_t entryBytes) const noexcept {
+            return static_cast<uint64_t>(count) * entryBytes <= m_data.size() - m_cursor;
+        }
+        [[nodiscard]] bool ok() const noexcept { return m_ok; }
+        
+    private:
+        bool require(size_t bytes) noexcept {
+            if (!m_ok || m_data.size() - m_cursor < bytes) {
+                m_ok = false;
+                return false;
+            }
+            return true;
+        }
+        
+        const std::vector<uint8_t>& m_data;
+        size_t m_cursor = 0;
+        bool m_ok = true;
+    };
+}
+
+std::vector<uint8_t> ClipboardBlock::serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(HEADER_BYTES +
+                gates.size() * GATE_ENTRY_BYTES +
+                connections.size() * CONNECTION_ENTRY_BYTES +
+                cells.size() * CELL_ENTRY_BYTES);
+    
+    ByteWriter writer(out);
+    writer.u32(BLOCK_MAGIC);
+    writer.u32(BLOCK_VERSION);
+    writer.i32(size.x);
+    writer.i32(size.y);
+    writer.u32(static_cast<uint32_t>(gates.size()));
+    writer.u32(static_cast<uint32_t>(connections.size()));
+    writer.u32(static_cast<uint32_t>(cells.size()));
+    
+    for (const GateEntry& gate : gates) {
+        writer.i32(gate.offset.x);
+        writer.i32(gate.offset.y);
+        writer.u8(static_cast<uint8_t>(gate.type));
+    }
+    for (const ConnectionEntry& conn : connections) {
+        writer.u32(conn.fromIndex);
+        writer.u32(conn.toIndex);
+        writer.u8(static_cast<uint8_t>(conn.toPort));
+    }
+    for (const CellEntry& cell : cells) {
+        writer.i32(cell.offset.x);
+        writer.i32(cell.offset.y);
+        writer.u8(cell.connections);
+    }
+    
+    return out;
+}
+
+Result<ClipboardBlock> ClipboardBlock::deserialize(const std::vector<uint8_t>& data) {
+    const Result<ClipboardBlock> invalid{ClipboardBlock{}, ErrorCode::INVALID_FORMAT};
+    
+    ByteReader reader(data);
+    uint32_t magic = reader.u32();
+    uint32_t version = reader.u32();
+    if (!reader.ok() || magic != BLOCK_MAGIC || version != BLOCK_VERSION) {
+        return invalid;
+    }
+    
+    ClipboardBlock block;
+    block.size.x = reader.i32();
+    block.size.y = reader.i32();
+    uint32_t gateCount = reader.u32();
+    uint32_t connectionCount = reader.u32();
+    uint32_t cellCount = reader.u32();
+    if (!reader.ok() || block.size.x < 0 || block.size.y < 0 ||
+        !reader.fits(gateCount, GATE_ENTRY_BYTES)) {
+        return invalid;
+    }
+    
+    block.gates.resize(gateCount);
+    for (GateEntry& gate : block.gates) {
+        gate.offset.x = reader.i32();
+        gate.offset.y = reader.i32();
+        uint8_t type = reader.u8();
+        if (type > MAX_GATE_TYPE || !insideBlock(gate.offset, block.size)) {
+            return invalid;
+        }
+        gate.type = static_cast<GateType>(type);
+    }
+    
+    if (!reader.fits(connectionCount, CONNECTION_ENTRY_BYTES)) {
+        return invalid;
+    }
+    block.connections.resize(connectionCount);
+    for (ConnectionEntry& conn : block.connections) {
+        conn.fromIndex = reader.u32();
+        conn.toIndex = reader.u32();
+        conn.toPort = static_cast<PortIndex>(reader.u8());
+        if (conn.fromIndex >= gateCount || conn.toIndex >= gateCount ||
+            conn.toPort < 0 || conn.toPort >= Constants::MAX_INPUT_PORTS) {
+            return invalid;
+        }
+    }
+    
+    if (!reader.fits(cellCount, CELL_ENTRY_BYTES)) {
+        return invalid;
+    }
+    block.cells.resize(cellCount);
+    for (CellEntry& cell : block.cells) {
+        cell.offset.x = reader.i32();
+        cell.offset.y = reader.i32();
+        cell.connections = reader.u8();
+        if ((cell.connections & ~VALID_DIRECTIONS) != 0 || !insideBlock(cell.offset, block.size)) {
+            return invalid;
+        }
+    }
+    
+    if (!reader.ok()) {
+        return invalid;
+    }
+    return {std::move(block), ErrorCode::SUCCESS};
+}
+
+std::string ClipboardBlock::toText() const {
+    std::vector<uint8_t> bytes = serialize();
+    
+    std::string text(TEXT_PREFIX);
+    text.reserve(text.size() + (bytes.size() + 2) / 3 * 4);
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        if (i + 2 < bytes.size()) chunk |= bytes[i + 2];
+        
+        text.push_back(BASE64_CHARS[(chunk >> 18) & 63]);
+        text.push_back(BASE64_CHARS[(chunk >> 12) & 63]);
+        text.push_back(i + 1 < bytes.size() ? BASE64_CHARS[(chunk >> 6) & 63] : '=');
+        text.push_back(i + 2 < bytes.size() ? BASE64_CHARS[chunk & 63] : '=');
+    }
+    return text;
+}
+
+Result<ClipboardBlock> ClipboardBlock::fromText(const std::string& text) {
+    const Result<ClipboardBlock> invalid{ClipboardBlock{}, ErrorCode::INVALID_FORMAT};
+    
+    const size_t prefixLength = std::strlen(TEXT_PREFIX);
+    if (text.compare(0, prefixLength, TEXT_PREFIX) != 0 || (text.size() - prefixLength) % 4 != 0) {
+        return invalid;
+    }
+    
+    std::vector<uint8_t> bytes;
+    bytes.reserve((text.size() - prefixLength) / 4 * 3);
+    for (size_t i = prefixLength; i < text.size(); i += 4) {
+        // 패딩 '='은 마지막 묶음의 끝 두 자리에만 올 수 있음
+        const bool last = i + 4 == text.size();
+        const int padding = (last && text[i + 3] == '=') ? (text[i + 2] == '=' ? 2 : 1) : 0;
+        
+        uint32_t chunk = 0;
+        for (int j = 0; j < 4 - padding; ++j) {
+            int value = base64Value(text[i + j]);
+            if (value < 0) {
+                return invalid;
+            }
+            chunk |= static_cast<uint32_t>(value) << (18 - 6 * j);
+        }
+        
+        bytes.push_back(static_cast<uint8_t>(chunk >> 16));
+        if (padding < 2) bytes.push_back(static_cast<uint8_t>(chunk >> 8));
+        if (padding < 1) bytes.push_back(static_cast<uint8_t>(chunk));
+    }
+    
+    return deserialize(bytes);
+}
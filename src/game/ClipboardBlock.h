@@ -0,0 +1,52 @@
+#pragma once
+#include "../core/Types.h"
+#include "../core/Vec2.h"
+#include <string>
+#include <vector>
+
+// 선택 영역을 원점 기준 오프셋으로 저장한 재배치 가능한 블록
+struct ClipboardBlock {
+    struct GateEntry {
+        Vec2i offset;
+        GateType type{GateType::NOT};
+    };
+    
+    // 블록 내부 게이트끼리의 연결 (gates 배열 인덱스)
+    struct ConnectionEntry {
+        uint32_t fromIndex{0};
+        uint32_t toIndex{0};
+        PortIndex toPort{Constants::INVALID_PORT};
+    };
+    
+    // CellWire 셀 (블록 밖을 향하는 연결은 복사 시 제거됨)
+    struct CellEntry {
+        Vec2i offset;
+        uint8_t connections{0};
+    };
+    
+    Vec2i size{0, 0};
+    std::vector<GateEntry> gates;
+    std::vector<ConnectionEntry> connections;
+    std::vector<CellEntry> cells;
+    
+    [[nodiscard]] bool empty() const noexcept {
+        return gates.empty() && cells.empty();
+    }
+    
+    void clear() noexcept {
+        size = Vec2i{0, 0};
+        gates.clear();
+        connections.clear();
+        cells.clear();
+    }
+    
+    // 바이트 직렬화 (파일/시스템 클립보드 저장용)
+    // 잘리거나 범위를 벗어난 값(게이트 타입, 포트, 연결 비트, 오프셋)이 있으면 INVALID_FORMAT
+    [[nodiscard]] std::vector<uint8_t> serialize() const;
+    [[nodiscard]] static Result<ClipboardBlock> deserialize(const std::vector<uint8_t>& data);
+    
+    // 시스템 클립보드용 텍스트 (TEXT_PREFIX + base64). 블록이 아닌 텍스트면 INVALID_FORMAT
+    static constexpr const char* TEXT_PREFIX = "notgate-block:";
+    [[nodiscard]] std::string toText() const;
+    [[nodiscard]] static Result<ClipboardBlock> fromText(const std::string& text);
+};
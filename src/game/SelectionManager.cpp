@@ -3,7 +3,9 @@
 #include "../core/GridMap.h"
 #include "../core/Grid.h"
 #include "../core/Gate.h"
+#include "../core/CellWireManager.h"
 #include <algorithm>
+#include <unordered_map>
 #include <SDL.h>
 
 void SelectionManager::selectGate(GateId gateId) noexcept {
@@ -75,21 +77,23 @@ void SelectionManager::deleteSelected() noexcept {
     
     std::vector<GateId> toDelete(selectedGates.begin(), selectedGates.end());
     
-    for (GateId id : toDelete) {
-        Gate* gate = circuit->getGate(id);
-        if (gate) {
-            Vec2i gridPos(static_cast<int>(gate->position.x), 
-                         static_cast<int>(gate->position.y));
-            
-            if (gridMap) {
-                gridMap->clearCell(gridPos);
+    if (gridMap) {
+        std::vector<Vec2i> cells;
+        cells.reserve(toDelete.size());
+        for (GateId id : toDelete) {
+            if (const Gate* gate = circuit->getGate(id)) {
+                cells.emplace_back(static_cast<int>(gate->position.x), 
+                                   static_cast<int>(gate->position.y));
             }
-            
-            circuit->removeGate(id);
         }
+        gridMap->clearCells(cells);
     }
     
-    clearSelection();
+    circuit->removeGates(toDelete);
+    
+    // 게이트가 이미 삭제되었으므로 선택 상태만 초기화
+    selectedGates.clear();
+    lastSelectedGate = Constants::INVALID_GATE_ID;
 }
 
 void SelectionManager::moveSelected(Vec2i delta) noexcept {
@@ -121,10 +125,221 @@ void SelectionManager::moveSelected(Vec2i delta) noexcept {
             gridMap->clearCell(oldPos);
             gridMap->setCell(newPos, static_cast<uint32_t>(id));
             
-            gate->position = Vec2(static_cast<float>(newPos.x), 
-                                 static_cast<float>(newPos.y));
+            circuit->moveGate(id, Vec2(static_cast<float>(newPos.x), 
+                                       static_cast<float>(newPos.y)));
+        }
+    }
+}
+
+void SelectionManager::copySelected() noexcept {
+    if (!circuit || selectedGates.empty()) {
+        return;
+    }
+    
+    Vec2i minPos, maxPos;
+    if (!getSelectionBounds(minPos, maxPos)) {
+        return;
+    }
+    
+    clipboard.clear();
+    clipboard.size = Vec2i(maxPos.x - minPos.x + 1, maxPos.y - minPos.y + 1);
+    
+    // 행 우선 정렬: 붙여넣기 시 GridMap 청크 조회가 연속되도록
+    std::vector<std::pair<Vec2i, GateId>> ordered;
+    ordered.reserve(selectedGates.size());
+    for (GateId id : selectedGates) {
+        if (const Gate* gate = circuit->getGate(id)) {
+            ordered.push_back({Vec2i(static_cast<int>(gate->position.x), 
+                                     static_cast<int>(gate->position.y)), id});
+        }
+    }
+    std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+        return a.first.y != b.first.y ? a.first.y < b.first.y : a.first.x < b.first.x;
+    });
+    
+    std::unordered_map<GateId, uint32_t> indexOf;
+    indexOf.reserve(ordered.size());
+    clipboard.gates.reserve(ordered.size());
+    for (const auto& [pos, id] : ordered) {
+        indexOf[id] = static_cast<uint32_t>(clipboard.gates.size());
+        clipboard.gates.push_back({pos - minPos, circuit->getGate(id)->type});
+    }
+    
+    // 양 끝이 모두 선택된 게이트 간 와이어만 복사
+    for (const auto& [pos, id] : ordered) {
+        const Gate* gate = circuit->getGate(id);
+        for (int port = 0; port < Constants::MAX_INPUT_PORTS; ++port) {
+            const Wire* wire = circuit->getWire(gate->inputWires[port]);
+            if (!wire) {
+                continue;
+            }
+            auto fromIt = indexOf.find(wire->fromGateId);
+            if (fromIt != indexOf.end()) {
+                clipboard.connections.push_back({fromIt->second, indexOf[id], 
+                                                 static_cast<PortIndex>(port)});
+            }
+        }
+    }
+    
+    if (cellWireManager) {
+        std::vector<CellWire> wires = cellWireManager->getWiresInArea(
+            glm::ivec2(minPos.x, minPos.y), glm::ivec2(maxPos.x, maxPos.y));
+        clipboard.cells.reserve(wires.size());
+        
+        for (const CellWire& wire : wires) {
+            Vec2i pos(static_cast<int>(wire.cellPos.x), static_cast<int>(wire.cellPos.y));
+            
+            // 블록 밖을 향하는 연결은 제거 (붙여넣기 위치의 이웃과 어긋나지 않도록)
+            uint8_t mask = static_cast<uint8_t>(wire.connections);
+            if (pos.y == minPos.y) mask &= ~static_cast<uint8_t>(WireDirection::Up);
+            if (pos.y == maxPos.y) mask &= ~static_cast<uint8_t>(WireDirection::Down);
+            if (pos.x == minPos.x) mask &= ~static_cast<uint8_t>(WireDirection::Left);
+            if (pos.x == maxPos.x) mask &= ~static_cast<uint8_t>(WireDirection::Right);
+            
+            clipboard.cells.push_back({pos - minPos, mask});
+        }
+    }
+    
+    publishClipboard();
+    
+    SDL_Log("[SelectionManager] Copied %zu gates, %zu connections, %zu wire cells (%dx%d)", 
+            clipboard.gates.size(), clipboard.connections.size(), clipboard.cells.size(),
+            clipboard.size.x, clipboard.size.y);
+}
+
+void SelectionManager::publishClipboard() noexcept {
+    clipboardText = clipboard.toText();
+    if (SDL_SetClipboardText(clipboardText.c_str()) != 0) {
+        SDL_Log("[SelectionManager] Failed to set system clipboard: %s", SDL_GetError());
+    }
+}
+
+// 시스템 클립보드에 다른 블록이 올라와 있으면 그것으로 교체 (블록이 아닌 텍스트는 무시)
+void SelectionManager::syncClipboardFromSystem() noexcept {
+    if (!SDL_HasClipboardText()) {
+        return;
+    }
+    
+    char* text = SDL_GetClipboardText();
+    if (text && clipboardText != text) {
+        Result<ClipboardBlock> block = ClipboardBlock::fromText(text);
+        if (block.success()) {
+            clipboard = std::move(block.value);
+            clipboardText = text;
+        }
+    }
+    SDL_free(text);
+}
+
+void SelectionManager::cutSelected() noexcept {
+    if (!circuit || selectedGates.empty()) {
+        return;
+    }
+    
+    Vec2i minPos, maxPos;
+    if (!getSelectionBounds(minPos, maxPos)) {
+        return;
+    }
+    
+    copySelected();
+    deleteSelected();
+    
+    if (cellWireManager && !clipboard.cells.empty()) {
+        cellWireManager->removeWiresInArea(glm::ivec2(minPos.x, minPos.y), 
+                                           glm::ivec2(maxPos.x, maxPos.y));
+    }
+}
+
+Result<size_t> SelectionManager::paste(Vec2i origin) noexcept {
+    if (!circuit || !gridMap) {
+        return {0, ErrorCode::NOT_INITIALIZED};
+    }
+    
+    syncClipboardFromSystem();
+    if (clipboard.empty()) {
+        return {0, ErrorCode::SUCCESS};
+    }
+    
+    std::vector<Vec2i> gateCells;
+    gateCells.reserve(clipboard.gates.size());
+    for (const auto& entry : clipboard.gates) {
+        gateCells.push_back(origin + entry.offset);
+    }
+    
+    std::vector<Vec2i> wireCells;
+    wireCells.reserve(clipboard.cells.size());
+    for (const auto& entry : clipboard.cells) {
+        wireCells.push_back(origin + entry.offset);
+    }
+    
+    // 전체 블록을 한 번에 검사: 하나라도 겹치면 아무것도 배치하지 않음
+    if (!gridMap->areAllFree(gateCells) || !gridMap->areAllFree(wireCells)) {
+        SDL_Log("[SelectionManager] Paste at (%d, %d) blocked by existing gates", 
+                origin.x, origin.y);
+        return {0, ErrorCode::POSITION_OCCUPIED};
+    }
+    
+    std::vector<Vec2> positions;
+    positions.reserve(gateCells.size());
+    for (const Vec2i& cell : gateCells) {
+        positions.emplace_back(static_cast<float>(cell.x), static_cast<float>(cell.y));
+    }
+    
+    std::vector<GateId> newIds;
+    ErrorCode error = circuit->addGatesBatch(positions, newIds);
+    if (error != ErrorCode::SUCCESS) {
+        return {0, error};
+    }
+    gridMap->setCells(gateCells, newIds);
+    
+    if (!clipboard.connections.empty()) {
+        std::vector<GateConnection> connections;
+        connections.reserve(clipboard.connections.size());
+        for (const auto& conn : clipboard.connections) {
+            connections.push_back({newIds[conn.fromIndex], newIds[conn.toIndex], conn.toPort});
         }
+        circuit->connectGatesBatch(connections);
     }
+    
+    if (cellWireManager) {
+        if (!wireCells.empty()) {
+            std::vector<CellWire> wires;
+            wires.reserve(wireCells.size());
+            for (size_t i = 0; i < wireCells.size(); ++i) {
+                CellWire wire;
+                wire.cellPos = Vec2(static_cast<float>(wireCells[i].x), 
+                                    static_cast<float>(wireCells[i].y));
+                wire.connections = static_cast<WireDirection>(clipboard.cells[i].connections);
+                wire.exists = true;
+                wires.push_back(wire);
+            }
+            cellWireManager->mergeWires(wires);
+        }
+        
+        // 게이트 아래의 와이어 제거 (PlacementManager와 동일한 규칙): 한 번에 지우고 이웃 연결도 한 번에 정리
+        std::vector<glm::ivec2> gateWireCells;
+        gateWireCells.reserve(gateCells.size());
+        for (const Vec2i& cell : gateCells) {
+            gateWireCells.emplace_back(cell.x, cell.y);
+        }
+        cellWireManager->eraseCells(gateWireCells);
+    }
+    
+    // 붙여넣은 게이트를 새 선택으로
+    clearSelection();
+    selectedGates.reserve(newIds.size());
+    for (GateId id : newIds) {
+        selectedGates.insert(id);
+        if (Gate* gate = circuit->getGate(id)) {
+            gate->isSelected = true;
+            circuit->markGateChanged(id);
+        }
+    }
+    lastSelectedGate = newIds.empty() ? Constants::INVALID_GATE_ID : newIds.back();
+    
+    SDL_Log("[SelectionManager] Pasted %zu gates, %zu wire cells at (%d, %d)", 
+            newIds.size(), wireCells.size(), origin.x, origin.y);
+    return {newIds.size(), ErrorCode::SUCCESS};
 }
 
 GateId SelectionManager::getGateAt(Vec2i gridPos) const noexcept {
@@ -205,9 +420,10 @@ void SelectionManager::updateGateSelectionState(GateId gateId, bool selected) no
     
     Gate* gate = circuit->getGate(gateId);
     if (gate) {
-        gate->isSelected = selected;
-        SDL_Log("[SelectionManager] Gate %u selection state updated to %s", 
-                gateId, selected ? "SELECTED" : "DESELECTED");
+        if (gate->isSelected != selected) {
+            gate->isSelected = selected;
+            circuit->markGateChanged(gateId);
+        }
     } else {
         SDL_Log("[SelectionManager] ERROR: Gate %u not found in circuit", gateId);
     }
@@ -236,4 +452,32 @@ std::vector<GateId> SelectionManager::getGatesInRect(Vec2i start, Vec2i end) con
     }
     
     return gatesInRect;
+}
+
+bool SelectionManager::getSelectionBounds(Vec2i& outMin, Vec2i& outMax) const noexcept {
+    if (!circuit) {
+        return false;
+    }
+    
+    bool found = false;
+    for (GateId id : selectedGates) {
+        const Gate* gate = circuit->getGate(id);
+        if (!gate) {
+            continue;
+        }
+        
+        Vec2i pos(static_cast<int>(gate->position.x), static_cast<int>(gate->position.y));
+        if (!found) {
+            outMin = pos;
+            outMax = pos;
+            found = true;
+        } else {
+            outMin.x = std::min(outMin.x, pos.x);
+            outMin.y = std::min(outMin.y, pos.y);
+            outMax.x = std::max(outMax.x, pos.x);
+            outMax.y = std::max(outMax.y, pos.y);
+        }
+    }
+    
+    return found;
 }
\ No newline at end of file
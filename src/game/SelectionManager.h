@@ -1,12 +1,15 @@
 #pragma once
 #include "../core/Types.h"
 #include "../core/Vec2.h"
+#include "ClipboardBlock.h"
+#include <string>
 #include <unordered_set>
 #include <vector>
 
 class Circuit;
 class GridMap;
 class Grid;
+class CellWireManager;
 
 class SelectionManager {
 private:
@@ -18,15 +21,20 @@ private:
     Circuit* circuit{nullptr};
     GridMap* gridMap{nullptr};
     Grid* grid{nullptr};
+    CellWireManager* cellWireManager{nullptr};
+    
+    ClipboardBlock clipboard;
+    std::string clipboardText;      // 마지막으로 시스템 클립보드와 주고받은 블록 텍스트
     
 public:
     SelectionManager() = default;
     ~SelectionManager() = default;
     
-    void initialize(Circuit* circ, GridMap* gMap, Grid* g) noexcept {
+    void initialize(Circuit* circ, GridMap* gMap, Grid* g, CellWireManager* cwm = nullptr) noexcept {
         circuit = circ;
         gridMap = gMap;
         grid = g;
+        cellWireManager = cwm;
     }
     
     void selectGate(GateId gateId) noexcept;
@@ -61,6 +69,16 @@ public:
     void deleteSelected() noexcept;
     void moveSelected(Vec2i delta) noexcept;
     
+    // 클립보드: 선택된 게이트와 그 영역의 CellWire를 블록으로 복사
+    // 복사한 블록은 텍스트로 직렬화해 시스템 클립보드에도 올림 (다른 인스턴스에서 붙여넣기 가능)
+    void copySelected() noexcept;
+    void cutSelected() noexcept;
+    Result<size_t> paste(Vec2i origin) noexcept;
+    
+    [[nodiscard]] bool hasClipboard() const noexcept { return !clipboard.empty(); }
+    [[nodiscard]] const ClipboardBlock& getClipboard() const noexcept { return clipboard; }
+    void setClipboard(ClipboardBlock block) noexcept { clipboard = std::move(block); }
+    
     [[nodiscard]] GateId getGateAt(Vec2i gridPos) const noexcept;
     
     void onMouseClick(MouseButton btn, Vec2 screenPos, bool ctrlHeld, bool shiftHeld) noexcept;
@@ -69,4 +87,7 @@ public:
 private:
     void updateGateSelectionState(GateId gateId, bool selected) noexcept;
     std::vector<GateId> getGatesInRect(Vec2i start, Vec2i end) const noexcept;
+    bool getSelectionBounds(Vec2i& outMin, Vec2i& outMax) const noexcept;
+    void publishClipboard() noexcept;
+    void syncClipboardFromSystem() noexcept;
 };
\ No newline at end of file
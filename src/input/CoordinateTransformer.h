@@ -1,12 +1,15 @@
 #pragma once
 
 #include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/matrix_inverse.hpp>
+#include <cmath>
+#include <cstddef>
 #include "../render/Camera.h"
 
 namespace Input {
 
+// 입력 쪽 좌표 변환: 카메라의 변환 스냅샷(ViewTransform)을 그대로 씀
+// - 카메라가 바뀌지 않은 동안은 행렬/배율을 다시 계산하지 않음
+// - 줌/팬이 같은 프레임 안에서 일어나도 다음 변환부터 바로 새 스냅샷을 봄
 class CoordinateTransformer {
 private:
     Camera* m_camera = nullptr;
@@ -15,24 +18,18 @@ private:
     float m_dpiScale = 1.0f;
     float m_pixelScale = 1.0f;
     
-    struct TransformCache {
-        glm::mat4 viewProj;
-        glm::mat4 invViewProj;
-        uint32_t frameNumber = 0;
-        bool valid = false;
-    } m_cache;
+    ViewTransform m_identity;   // 카메라가 없을 때 (화면 좌표 = 월드 좌표)
     
 public:
     CoordinateTransformer() = default;
     
     void setCamera(Camera* camera) { 
         m_camera = camera;
-        m_cache.valid = false;
     }
     
+    // 변환에 쓰는 화면 크기는 카메라 것 (창 크기 변경 시 Camera::SetScreenSize로 함께 바뀜)
     void setViewport(float width, float height) {
         m_viewportSize = glm::vec2(width, height);
-        m_cache.valid = false;
     }
     
     void setGridSize(float size) { 
@@ -47,38 +44,23 @@ public:
         m_pixelScale = scale; 
     }
     
-    void updateCache(uint32_t frameNumber) {
-        if (!m_camera || (m_cache.valid && m_cache.frameNumber == frameNumber)) {
-            return;
-        }
-        
-        m_cache.viewProj = m_camera->GetProjectionMatrix() * m_camera->GetViewMatrix();
-        m_cache.invViewProj = glm::inverse(m_cache.viewProj);
-        m_cache.frameNumber = frameNumber;
-        m_cache.valid = true;
+    const ViewTransform& getTransform() const {
+        return m_camera ? m_camera->GetTransform() : m_identity;
     }
     
-    glm::vec2 screenToNDC(const glm::vec2& screenPos) const {
-        glm::vec2 adjustedPos = screenPos * m_pixelScale;
-        return glm::vec2(
-            2.0f * adjustedPos.x / m_viewportSize.x - 1.0f,
-            1.0f - 2.0f * adjustedPos.y / m_viewportSize.y
-        );
+    glm::vec2 screenToWorld(const glm::vec2& screenPos) const {
+        return getTransform().ScreenToWorld(screenPos * m_pixelScale);
     }
     
-    glm::vec2 ndcToWorld(const glm::vec2& ndcPos) const {
-        if (!m_cache.valid) return ndcPos;
-        
-        glm::vec4 worldPos = m_cache.invViewProj * glm::vec4(ndcPos, 0.0f, 1.0f);
-        if (worldPos.w != 0) {
-            return glm::vec2(worldPos.x / worldPos.w, worldPos.y / worldPos.w);
+    // 드래그 경로 등 점 배열 변환 (입력과 출력이 같은 배열이어도 됨)
+    void screenToWorldBatch(const glm::vec2* screenPos, glm::vec2* worldPos, size_t count) const {
+        if (m_pixelScale != 1.0f) {
+            for (size_t i = 0; i < count; ++i) {
+                worldPos[i] = screenPos[i] * m_pixelScale;
+            }
+            screenPos = worldPos;
         }
-        return glm::vec2(worldPos.x, worldPos.y);
-    }
-    
-    glm::vec2 screenToWorld(const glm::vec2& screenPos) {
-        updateCache(0); 
-        return ndcToWorld(screenToNDC(screenPos));
+        getTransform().ScreenToWorldBatch(screenPos, worldPos, count);
     }
     
     glm::ivec2 worldToGrid(const glm::vec2& worldPos) const {
@@ -95,22 +77,17 @@ public:
         );
     }
     
-    glm::ivec2 screenToGrid(const glm::vec2& screenPos) {
+    glm::ivec2 screenToGrid(const glm::vec2& screenPos) const {
         return worldToGrid(screenToWorld(screenPos));
     }
     
     glm::vec2 worldToScreen(const glm::vec2& worldPos) const {
-        if (!m_cache.valid) return worldPos;
-        
-        glm::vec4 clipPos = m_cache.viewProj * glm::vec4(worldPos, 0.0f, 1.0f);
-        if (clipPos.w != 0) {
-            glm::vec2 ndcPos = glm::vec2(clipPos.x / clipPos.w, clipPos.y / clipPos.w);
-            return glm::vec2(
-                (ndcPos.x + 1.0f) * 0.5f * m_viewportSize.x,
-                (1.0f - ndcPos.y) * 0.5f * m_viewportSize.y
-            ) / m_pixelScale;
-        }
-        return worldPos;
+        return getTransform().WorldToScreen(worldPos) / m_pixelScale;
+    }
+    
+    // 화면 사각형(선택 영역) -> 월드 범위 (minX, minY, maxX, maxY)
+    glm::vec4 screenRectToWorld(const glm::vec2& cornerA, const glm::vec2& cornerB) const {
+        return getTransform().ScreenRectToWorld(cornerA * m_pixelScale, cornerB * m_pixelScale);
     }
     
     float getGridSize() const { return m_gridSize; }
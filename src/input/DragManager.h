@@ -75,7 +75,8 @@ public:
         }
     }
     
-    void onMouseMove(const MouseEvent& event) {
+    // 프레임당 한 번, 병합된 이동의 마지막 위치로 호출. path는 그 사이 지나온 월드 좌표
+    void onMouseMove(const MouseEvent& event, const glm::vec2* path = nullptr, uint32_t pathLength = 0) {
         if (m_dragInfo.state == Idle) return;
         
         m_dragInfo.lastScreenPos = m_dragInfo.currentScreenPos;
@@ -122,12 +123,17 @@ public:
                 dragEvent.distance = glm::length(event.screenPos - m_dragInfo.startScreenPos);
                 dragEvent.duration = (event.timestamp - m_dragInfo.startTime) / 1000.0f;
                 dragEvent.button = m_dragInfo.button;
+                dragEvent.path = path;
+                dragEvent.pathLength = pathLength;
                 
                 m_dispatcher->dispatch(dragEvent);
             }
         }
     }
     
+    // 눌린 버튼이 있어 이동 경로가 필요한 상태
+    bool isTracking() const { return m_dragInfo.state != Idle; }
+    
     void onMouseUp(const MouseEvent& event) {
         if (m_dragInfo.state == Idle) return;
         
@@ -1,100 +1,407 @@
 #pragma once
 
 #include "InputTypes.h"
-#include <typeindex>
-#include <unordered_map>
-#include <vector>
-#include <any>
-#include <queue>
-#include <mutex>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Input {
 
-class EventDispatcher {
+// 디스패처가 다루는 이벤트 타입 목록. 순서가 곧 컴파일 타임 타입 ID
+using DispatchedEvents = std::tuple<MouseEvent, ClickEvent, DragEvent, HoverEvent>;
+
+template<typename EventType, typename List = DispatchedEvents>
+struct EventTypeId;
+
+template<typename EventType, typename... Rest>
+struct EventTypeId<EventType, std::tuple<EventType, Rest...>> {
+    static constexpr uint32_t value = 0;
+};
+
+template<typename EventType, typename First, typename... Rest>
+struct EventTypeId<EventType, std::tuple<First, Rest...>> {
+    static constexpr uint32_t value = 1 + EventTypeId<EventType, std::tuple<Rest...>>::value;
+};
+
+template<typename List>
+struct MaxEventSize;
+
+template<typename... Events>
+struct MaxEventSize<std::tuple<Events...>> {
+    static constexpr size_t value = std::max({sizeof(Events)...});
+};
+
+// 큐에 넣을 수 없는 이벤트: 발행자 소유 데이터를 가리키는 포인터를 담고 있어 그 자리에서만 유효
+// DragEvent::path는 DragManager가 매 프레임 다시 채우는 경로 버퍼를 가리킴
+template<typename EventType>
+struct ImmediateOnlyEvent : std::false_type {};
+
+template<>
+struct ImmediateOnlyEvent<DragEvent> : std::true_type {};
+
+using SubscriptionId = uint32_t;
+constexpr SubscriptionId INVALID_SUBSCRIPTION = 0;
+
+// 캡처를 객체 안에 직접 담는 콜백 (std::function과 달리 힙 할당 없음)
+// 캡처가 STORAGE_SIZE를 넘으면 컴파일 오류
+// std::function 하나(또는 그것만 캡처한 람다)는 항상 들어가야 함: 크기가 표준 라이브러리마다 다름 (MSVC x64 64바이트)
+template<typename EventType>
+class InlineCallback {
+public:
+    static constexpr size_t STORAGE_SIZE = std::max<size_t>(48, sizeof(std::function<void(const EventType&)>));
+    static_assert(STORAGE_SIZE >= sizeof(std::function<void(const EventType&)>),
+                  "inline storage must hold a std::function callback");
+
+    InlineCallback() = default;
+
+    template<typename Fn, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, InlineCallback>>>
+    InlineCallback(Fn&& fn) {
+        using Stored = std::decay_t<Fn>;
+        static_assert(sizeof(Stored) <= STORAGE_SIZE, "callback capture too large for inline storage");
+        static_assert(alignof(Stored) <= alignof(std::max_align_t), "callback capture over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<Stored>, "callback must be nothrow movable");
+
+        new (m_storage) Stored(std::forward<Fn>(fn));
+        m_ops = &OPS<Stored>;
+    }
+
+    InlineCallback(InlineCallback&& other) noexcept { moveFrom(other); }
+
+    InlineCallback& operator=(InlineCallback&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineCallback(const InlineCallback&) = delete;
+    InlineCallback& operator=(const InlineCallback&) = delete;
+
+    ~InlineCallback() { reset(); }
+
+    void operator()(const EventType& event) { m_ops->invoke(m_storage, event); }
+    explicit operator bool() const { return m_ops != nullptr; }
+
 private:
-    std::unordered_map<std::type_index, std::vector<std::any>> m_callbacks;
-    std::queue<std::function<void()>> m_eventQueue;
-    std::mutex m_queueMutex;
-    bool m_processingEvents = false;
-    
+    struct Ops {
+        void (*invoke)(void*, const EventType&);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void*);
+    };
+
+    template<typename Stored>
+    static constexpr Ops OPS = {
+        [](void* self, const EventType& event) { (*static_cast<Stored*>(self))(event); },
+        [](void* dst, void* src) { new (dst) Stored(std::move(*static_cast<Stored*>(src))); },
+        [](void* self) { static_cast<Stored*>(self)->~Stored(); }
+    };
+
+    void moveFrom(InlineCallback& other) noexcept {
+        if (other.m_ops) {
+            other.m_ops->move(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.reset();
+        }
+    }
+
+    void reset() noexcept {
+        if (m_ops) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[STORAGE_SIZE];
+    const Ops* m_ops = nullptr;
+};
+
+// 이벤트 구독/발행
+// - 구독자는 이벤트 타입별 벡터에 인라인 콜백으로 보관 (dispatch에 any_cast/예외 처리 없음)
+// - enqueue는 고정 크기 락프리 MPSC 링 버퍼에 POD 이벤트를 복사 (어느 스레드에서나 호출 가능)
+// - processQueue는 입력 스레드(단일 소비자)에서만 호출
+// 구독 추가 외에는 힙 할당이 없어 마우스 이동/드래그가 많아도 할당이 생기지 않음
+class EventDispatcher {
 public:
-    EventDispatcher() = default;
-    
+    static constexpr size_t QUEUE_CAPACITY = 1024;   // 2의 거듭제곱
+
+    EventDispatcher()
+        : m_slots(std::make_unique<Slot[]>(QUEUE_CAPACITY)) {
+        for (size_t i = 0; i < QUEUE_CAPACITY; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    EventDispatcher(const EventDispatcher&) = delete;
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+
+    // EventType을 명시하고 임의의 호출 가능 객체로 구독
+    // 디스패치 중에 구독하면 실행 중인 콜백이 든 벡터가 재할당되지 않도록 대기 목록에 두었다가 끝난 뒤 추가
+    // (그 디스패치에서는 호출되지 않음)
+    template<typename EventType, typename Fn>
+    SubscriptionId subscribe(Fn&& callback) {
+        SubscriptionId id = ++m_lastSubscriptionId;
+        if (m_dispatchDepth > 0) {
+            pendingSubscribers<EventType>().push_back({id, InlineCallback<EventType>(std::forward<Fn>(callback))});
+            m_hasPending = true;
+        } else {
+            subscribers<EventType>().push_back({id, InlineCallback<EventType>(std::forward<Fn>(callback))});
+        }
+        return id;
+    }
+
     template<typename EventType>
-    void subscribe(EventCallback<EventType> callback) {
-        auto& callbacks = m_callbacks[std::type_index(typeid(EventType))];
-        callbacks.push_back(callback);
+    SubscriptionId subscribe(EventCallback<EventType> callback) {
+        return subscribe<EventType, EventCallback<EventType>>(std::move(callback));
+    }
+
+    template<typename EventType>
+    void unsubscribe(SubscriptionId id) {
+        // 아직 추가되지 않은 구독은 순회 대상이 아니므로 바로 지움
+        auto& pending = pendingSubscribers<EventType>();
+        for (size_t i = 0; i < pending.size(); ++i) {
+            if (pending[i].id == id) {
+                pending.erase(pending.begin() + i);
+                return;
+            }
+        }
+
+        auto& list = subscribers<EventType>();
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].id != id) {
+                continue;
+            }
+            // 디스패치 중이면 자리만 비우고 끝난 뒤 정리 (순회 중인 인덱스 보존)
+            if (m_dispatchDepth > 0) {
+                list[i].id = INVALID_SUBSCRIPTION;
+                m_needsCompact = true;
+            } else {
+                list.erase(list.begin() + i);
+            }
+            return;
+        }
     }
-    
+
     template<typename EventType>
     void unsubscribeAll() {
-        m_callbacks.erase(std::type_index(typeid(EventType)));
+        pendingSubscribers<EventType>().clear();
+        auto& list = subscribers<EventType>();
+        if (m_dispatchDepth > 0) {
+            for (auto& subscriber : list) {
+                subscriber.id = INVALID_SUBSCRIPTION;
+            }
+            m_needsCompact = true;
+        } else {
+            list.clear();
+        }
     }
-    
+
+    // 큐 처리 중 발행된 이벤트는 큐 뒤로 미룸. 단 ImmediateOnlyEvent는 항상 바로 전달
     template<typename EventType>
     void dispatch(const EventType& event) {
-        if (m_processingEvents) {
-            enqueue(event);
-            return;
+        if constexpr (!ImmediateOnlyEvent<EventType>::value) {
+            if (m_processingEvents) {
+                enqueue(event);
+                return;
+            }
         }
-        
-        auto it = m_callbacks.find(std::type_index(typeid(EventType)));
-        if (it != m_callbacks.end()) {
-            for (const auto& anyCallback : it->second) {
-                try {
-                    auto callback = std::any_cast<EventCallback<EventType>>(anyCallback);
-                    callback(event);
-                } catch (const std::bad_any_cast& e) {
-                    
+        invoke(event);
+    }
+
+    // 큐가 가득 차면 이벤트를 버리고 false (getDroppedCount로 확인)
+    template<typename EventType>
+    bool enqueue(const EventType& event) {
+        static_assert(std::is_trivially_copyable_v<EventType>, "queued events must be POD");
+        static_assert(!ImmediateOnlyEvent<EventType>::value, "event holds borrowed pointers and cannot be queued");
+        static_assert(sizeof(EventType) <= EVENT_STORAGE_SIZE, "event too large for queue slot");
+
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &m_slots[pos & (QUEUE_CAPACITY - 1)];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
                 }
+            } else if (diff < 0) {
+                m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
             }
         }
+
+        slot->type = EventTypeId<EventType>::value;
+        std::memcpy(slot->storage, &event, sizeof(EventType));
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
     }
-    
-    template<typename EventType>
-    void enqueue(const EventType& event) {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        auto eventCopy = std::make_shared<EventType>(event);
-        m_eventQueue.push([this, eventCopy]() { 
-            dispatch(*eventCopy); 
-        });
-    }
-    
+
     void processQueue() {
-        std::queue<std::function<void()>> localQueue;
-        
-        {
-            std::lock_guard<std::mutex> lock(m_queueMutex);
-            std::swap(localQueue, m_eventQueue);
-        }
-        
+        // 처리 중 다시 들어온 이벤트는 다음 호출로 미룸 (무한 루프 방지)
+        const size_t end = m_enqueuePos.load(std::memory_order_acquire);
+
         m_processingEvents = true;
-        
-        while (!localQueue.empty()) {
-            localQueue.front()();
-            localQueue.pop();
+        while (m_dequeuePos != end) {
+            Slot& slot = m_slots[m_dequeuePos & (QUEUE_CAPACITY - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+                break;      // 생산자가 아직 쓰는 중
+            }
+            dispatchStored(slot, std::make_index_sequence<std::tuple_size_v<DispatchedEvents>>{});
+            slot.sequence.store(m_dequeuePos + QUEUE_CAPACITY, std::memory_order_release);
+            ++m_dequeuePos;
         }
-        
         m_processingEvents = false;
     }
-    
+
     void clear() {
-        m_callbacks.clear();
-        std::queue<std::function<void()>> empty;
-        std::swap(m_eventQueue, empty);
+        std::apply([](auto&... lists) { (lists.clear(), ...); }, m_subscribers);
+        std::apply([](auto&... lists) { (lists.clear(), ...); }, m_pendingSubscribers);
+        m_processingEvents = true;      // 남은 이벤트는 꺼내기만 하고 버림
+        const size_t end = m_enqueuePos.load(std::memory_order_acquire);
+        while (m_dequeuePos != end) {
+            Slot& slot = m_slots[m_dequeuePos & (QUEUE_CAPACITY - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+                break;
+            }
+            slot.sequence.store(m_dequeuePos + QUEUE_CAPACITY, std::memory_order_release);
+            ++m_dequeuePos;
+        }
+        m_processingEvents = false;
     }
-    
+
+    // 근사값 (다른 스레드가 동시에 넣는 중일 수 있음)
     size_t getQueueSize() const {
-        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_queueMutex));
-        return m_eventQueue.size();
+        return m_enqueuePos.load(std::memory_order_acquire) - m_dequeuePos;
+    }
+
+    size_t getDroppedCount() const {
+        return m_droppedEvents.load(std::memory_order_relaxed);
     }
-    
+
     template<typename EventType>
     size_t getSubscriberCount() const {
-        auto it = m_callbacks.find(std::type_index(typeid(EventType)));
-        return (it != m_callbacks.end()) ? it->second.size() : 0;
+        size_t count = std::get<SubscriberList<EventType>>(m_pendingSubscribers).size();
+        for (const auto& subscriber : std::get<SubscriberList<EventType>>(m_subscribers)) {
+            if (subscriber.id != INVALID_SUBSCRIPTION) {
+                ++count;
+            }
+        }
+        return count;
     }
+
+private:
+    template<typename EventType>
+    struct Subscriber {
+        SubscriptionId id;
+        InlineCallback<EventType> callback;
+    };
+
+    template<typename EventType>
+    using SubscriberList = std::vector<Subscriber<EventType>>;
+
+    static constexpr size_t EVENT_STORAGE_SIZE = MaxEventSize<DispatchedEvents>::value;
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        uint32_t type = 0;
+        alignas(std::max_align_t) unsigned char storage[EVENT_STORAGE_SIZE];
+    };
+
+    template<typename... Events>
+    struct ListsOf;
+    template<typename... Events>
+    struct ListsOf<std::tuple<Events...>> {
+        using type = std::tuple<SubscriberList<Events>...>;
+    };
+
+    template<typename EventType>
+    SubscriberList<EventType>& subscribers() {
+        return std::get<SubscriberList<EventType>>(m_subscribers);
+    }
+
+    template<typename EventType>
+    SubscriberList<EventType>& pendingSubscribers() {
+        return std::get<SubscriberList<EventType>>(m_pendingSubscribers);
+    }
+
+    template<typename EventType>
+    void invoke(const EventType& event) {
+        auto& list = subscribers<EventType>();
+        // 디스패치 중에는 구독 추가/해제가 벡터 크기를 바꾸지 않음 (subscribe/unsubscribe 참고)
+        ++m_dispatchDepth;
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].id != INVALID_SUBSCRIPTION) {
+                list[i].callback(event);
+            }
+        }
+        if (--m_dispatchDepth == 0) {
+            if (m_needsCompact) {
+                compact();
+            }
+            if (m_hasPending) {
+                applyPending();
+            }
+        }
+    }
+
+    template<size_t... Index>
+    void dispatchStored(const Slot& slot, std::index_sequence<Index...>) {
+        ((slot.type == Index ? dispatchStoredAs<std::tuple_element_t<Index, DispatchedEvents>>(slot)
+                             : void()), ...);
+    }
+
+    template<typename EventType>
+    void dispatchStoredAs(const Slot& slot) {
+        EventType event;
+        std::memcpy(&event, slot.storage, sizeof(EventType));
+        invoke(event);
+    }
+
+    void compact() {
+        std::apply([](auto&... lists) {
+            ((lists.erase(std::remove_if(lists.begin(), lists.end(),
+                                         [](const auto& s) { return s.id == INVALID_SUBSCRIPTION; }),
+                          lists.end())), ...);
+        }, m_subscribers);
+        m_needsCompact = false;
+    }
+
+    void applyPending() {
+        std::apply([this](auto&... pendingLists) {
+            std::apply([&](auto&... lists) {
+                ((std::move(pendingLists.begin(), pendingLists.end(), std::back_inserter(lists)),
+                  pendingLists.clear()), ...);
+            }, m_subscribers);
+        }, m_pendingSubscribers);
+        m_hasPending = false;
+    }
+
+    typename ListsOf<DispatchedEvents>::type m_subscribers;
+    typename ListsOf<DispatchedEvents>::type m_pendingSubscribers;     // 디스패치 중에 들어온 구독
+    SubscriptionId m_lastSubscriptionId = 0;
+    uint32_t m_dispatchDepth = 0;
+    bool m_needsCompact = false;
+    bool m_hasPending = false;
+    bool m_processingEvents = false;
+
+    std::unique_ptr<Slot[]> m_slots;
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) size_t m_dequeuePos = 0;     // 소비자(processQueue) 전용
+    std::atomic<size_t> m_droppedEvents{0};
 };
 
-} // namespace Input
\ No newline at end of file
+} // namespace Input
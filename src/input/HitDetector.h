@@ -1,76 +1,52 @@
 #pragma once
 
 #include "InputTypes.h"
+#include "SpatialHash.h"
 #include "../core/Circuit.h"
 #include <glm/glm.hpp>
-#include <unordered_map>
 #include <vector>
 #include <algorithm>
 #include <SDL.h>
 
 namespace Input {
 
-class HitDetector {
+// 클릭/호버 대상 판정
+// - 게이트(몸체 1x1)와 와이어(경로 선분마다)를 공간 해시에 넣고 Circuit 편집 통지로 그때그때 갱신
+//   → 판정은 클릭 위치 주변 셀만 보고, 편집 후에도 전체 재구축이 없음
+// - Circuit이 먼저 사라지면 onCircuitDestroyed에서 포인터를 놓음 (Application 멤버 소멸 순서)
+class HitDetector : public ICircuitListener {
 private:
+    static constexpr float GATE_HALF_EXTENT = 0.5f;     // 게이트 몸체와 포트가 모두 위치 ±0.5 안에 있음
+    static constexpr float GATE_CELL_SIZE = 2.0f;
+    static constexpr float WIRE_CELL_SIZE = 2.0f;
+    
     Circuit* m_circuit = nullptr;
     float m_wireHitThreshold = 0.1f;
     float m_portHitRadius = 1.0f;  // Increased port hit radius to 1.0f
     
-    struct SpatialGrid {
-        static constexpr int CELL_SIZE = 10;
-        std::unordered_map<uint64_t, std::vector<uint32_t>> gateIndex;
-        std::unordered_map<uint64_t, std::vector<uint32_t>> wireIndex;
-        
-        uint64_t hashPosition(const glm::ivec2& pos) const {
-            int32_t cellX = pos.x / CELL_SIZE;
-            int32_t cellY = pos.y / CELL_SIZE;
-            uint32_t ux = static_cast<uint32_t>(cellX + 0x7FFFFFFF);
-            uint32_t uy = static_cast<uint32_t>(cellY + 0x7FFFFFFF);
-            return (static_cast<uint64_t>(ux) << 32) | static_cast<uint64_t>(uy);
-        }
-        
-        void clear() {
-            gateIndex.clear();
-            wireIndex.clear();
-        }
-        
-        void insertGate(uint32_t id, const glm::ivec2& pos) {
-            uint64_t hash = hashPosition(pos);
-            gateIndex[hash].push_back(id);
-        }
-        
-        void insertWire(uint32_t id, const std::vector<Vec2>& pathPoints) {
-            if (pathPoints.size() < 2) return;
-            
-            glm::vec2 start(pathPoints.front().x, pathPoints.front().y);
-            glm::vec2 end(pathPoints.back().x, pathPoints.back().y);
-            glm::ivec2 minGrid(
-                static_cast<int>(std::floor(std::min(start.x, end.x))),
-                static_cast<int>(std::floor(std::min(start.y, end.y)))
-            );
-            glm::ivec2 maxGrid(
-                static_cast<int>(std::ceil(std::max(start.x, end.x))),
-                static_cast<int>(std::ceil(std::max(start.y, end.y)))
-            );
-            
-            for (int y = minGrid.y; y <= maxGrid.y; y++) {
-                for (int x = minGrid.x; x <= maxGrid.x; x++) {
-                    uint64_t hash = hashPosition(glm::ivec2(x, y));
-                    wireIndex[hash].push_back(id);
-                }
-            }
-        }
-    };
-    
-    mutable SpatialGrid m_spatialGrid;
-    mutable bool m_gridDirty = true;
+    SpatialHash m_gateIndex{GATE_CELL_SIZE};
+    SpatialHash m_wireIndex{WIRE_CELL_SIZE};
     
 public:
     HitDetector() = default;
+    ~HitDetector() override {
+        if (m_circuit) {
+            m_circuit->removeListener(this);
+        }
+    }
+    
+    HitDetector(const HitDetector&) = delete;
+    HitDetector& operator=(const HitDetector&) = delete;
     
     void setCircuit(Circuit* circuit) {
+        if (m_circuit) {
+            m_circuit->removeListener(this);
+        }
         m_circuit = circuit;
-        m_gridDirty = true;
+        if (m_circuit) {
+            m_circuit->addListener(this);
+        }
+        rebuildIndex();
     }
     
     void setWireHitThreshold(float threshold) {
@@ -81,8 +57,48 @@ public:
         m_portHitRadius = radius;
     }
     
-    void invalidateGrid() {
-        m_gridDirty = true;
+    // 통지 없이 회로를 통째로 바꾼 경우에만 필요 (평소 편집은 통지로 반영됨)
+    void rebuildIndex() {
+        m_gateIndex.clear();
+        m_wireIndex.clear();
+        if (!m_circuit) return;
+        
+        for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
+            insertGate(it->second);
+        }
+        for (auto it = m_circuit->wiresBegin(); it != m_circuit->wiresEnd(); ++it) {
+            insertWire(it->second);
+        }
+    }
+    
+    // ICircuitListener
+    void onGateAdded(const Gate& gate) noexcept override {
+        insertGate(gate);
+    }
+    
+    void onGateRemoved(const Gate& gate) noexcept override {
+        m_gateIndex.remove(gate.id);
+    }
+    
+    void onGateMoved(const Gate& gate, Vec2 /*oldPosition*/) noexcept override {
+        m_gateIndex.remove(gate.id);
+        insertGate(gate);
+    }
+    
+    void onWireAdded(const Wire& wire) noexcept override {
+        insertWire(wire);
+    }
+    
+    void onWireRemoved(const Wire& wire) noexcept override {
+        m_wireIndex.remove(wire.id);
+    }
+    
+    void onCircuitDestroyed(Circuit& circuit) noexcept override {
+        if (m_circuit == &circuit) {
+            m_circuit = nullptr;
+            m_gateIndex.clear();
+            m_wireIndex.clear();
+        }
     }
     
     HitResult detectHit(const glm::vec2& worldPos) const {
@@ -91,24 +107,9 @@ public:
             return HitResult{ClickTarget::Empty, 0, 0, worldPos};
         }
         
-        rebuildGridIfNeeded();
-        
-        // Log number of gates (commented out to reduce spam)
-        // int gateCount = 0;
-        // for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
-        //     gateCount++;
-        // }
-        // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Checking hit at (%.2f, %.2f), %d gates in circuit", 
-        //             worldPos.x, worldPos.y, gateCount);
-        
         // Check port hit first (more specific than gate hit)
-        for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
-            const Gate& gate = it->second;
-            if (auto portHit = checkPortHit(worldPos, gate.id); portHit.type == ClickTarget::Port) {
-                // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Port hit! Gate: %d, Port: %d", 
-                //            gate.id, portHit.portIndex);
-                return portHit;
-            }
+        if (auto portHit = checkPortHitNearby(worldPos); portHit.type == ClickTarget::Port) {
+            return portHit;
         }
         
         if (auto gateHit = checkGateHit(worldPos); gateHit.type != ClickTarget::None) {
@@ -162,114 +163,79 @@ public:
     }
     
 private:
-    void rebuildGridIfNeeded() const {
-        if (!m_gridDirty || !m_circuit) return;
-        
-        // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Rebuilding spatial grid...");
-        
-        m_spatialGrid.clear();
-        
-        int gateCount = 0;
-        for (auto it = m_circuit->gatesBegin(); it != m_circuit->gatesEnd(); ++it) {
-            const Gate& gate = it->second;
-            glm::ivec2 gridPos(gate.position.x, gate.position.y);
-            // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Adding gate %d at grid (%d, %d)", 
-            //            gate.id, gridPos.x, gridPos.y);
-            m_spatialGrid.insertGate(gate.id, gridPos);
-            gateCount++;
-        }
-        
-        int wireCount = 0;
-        for (auto it = m_circuit->wiresBegin(); it != m_circuit->wiresEnd(); ++it) {
-            const Wire& wire = it->second;
-            m_spatialGrid.insertWire(wire.id, wire.pathPoints);
-            wireCount++;
+    void insertGate(const Gate& gate) {
+        glm::vec2 position(gate.position.x, gate.position.y);
+        m_gateIndex.insert(gate.id, position - glm::vec2(GATE_HALF_EXTENT), position + glm::vec2(GATE_HALF_EXTENT));
+    }
+    
+    void insertWire(const Wire& wire) {
+        const std::vector<Vec2>& points = wire.pathPoints;
+        for (size_t i = 1; i < points.size(); ++i) {
+            glm::vec2 a(points[i - 1].x, points[i - 1].y);
+            glm::vec2 b(points[i].x, points[i].y);
+            m_wireIndex.insert(wire.id, glm::min(a, b), glm::max(a, b));
         }
-        
-        // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Grid rebuilt with %d gates and %d wires", 
-        //            gateCount, wireCount);
-        
-        m_gridDirty = false;
+    }
+    
+    // 포트 반경 + 게이트 반 크기 안에 위치가 있는 게이트만 후보
+    HitResult checkPortHitNearby(const glm::vec2& worldPos) const {
+        HitResult closest{ClickTarget::None, 0, FLT_MAX, worldPos};
+        glm::vec2 reach(m_portHitRadius + GATE_HALF_EXTENT);
+        m_gateIndex.query(worldPos - reach, worldPos + reach, [&](uint32_t gateId) {
+            HitResult hit = checkPortHit(worldPos, gateId);
+            if (hit.type == ClickTarget::Port && hit.distance < closest.distance) {
+                closest = hit;
+            }
+        });
+        return closest;
     }
     
     HitResult checkGateHit(const glm::vec2& worldPos) const {
-        glm::ivec2 gridPos(std::floor(worldPos.x), std::floor(worldPos.y));
-        uint64_t cellHash = m_spatialGrid.hashPosition(gridPos);
-        
-        // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] checkGateHit at grid (%d, %d), hash: %llu", 
-        //             gridPos.x, gridPos.y, cellHash);
-        
-        auto it = m_spatialGrid.gateIndex.find(cellHash);
-        if (it == m_spatialGrid.gateIndex.end()) {
-            // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] No gates in this cell");
-            return HitResult{};
-        }
-        
-        // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Found %zu gates in cell", it->second.size());
-        
-        for (uint32_t gateId : it->second) {
+        HitResult result{};
+        m_gateIndex.query(worldPos, worldPos, [&](uint32_t gateId) {
+            if (result.type != ClickTarget::None) return;
+            
             const Gate* gate = m_circuit->getGate(gateId);
+            if (!gate) return;
             
-            if (gate) {
-                glm::vec2 gatePos(gate->position.x, gate->position.y);
-                glm::vec2 min = gatePos - glm::vec2(0.5f);
-                glm::vec2 max = gatePos + glm::vec2(0.5f);
-                
-                // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Gate %d at (%.2f, %.2f), bounds: (%.2f,%.2f)-(%.2f,%.2f)", 
-                //            gateId, gatePos.x, gatePos.y, min.x, min.y, max.x, max.y);
-                
-                if (worldPos.x >= min.x && worldPos.x <= max.x &&
-                    worldPos.y >= min.y && worldPos.y <= max.y) {
-                    // Only log actual hits
-                    // SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[HitDetector] Gate %d HIT!", gateId);
-                    return HitResult{ClickTarget::Gate, gateId, 0, gatePos};
-                }
+            glm::vec2 gatePos(gate->position.x, gate->position.y);
+            glm::vec2 min = gatePos - glm::vec2(GATE_HALF_EXTENT);
+            glm::vec2 max = gatePos + glm::vec2(GATE_HALF_EXTENT);
+            
+            if (worldPos.x >= min.x && worldPos.x <= max.x &&
+                worldPos.y >= min.y && worldPos.y <= max.y) {
+                result = HitResult{ClickTarget::Gate, gateId, 0, gatePos};
             }
-        }
-        
-        return HitResult{};
+        });
+        return result;
     }
     
     HitResult checkWireHit(const glm::vec2& worldPos) const {
         HitResult closest{ClickTarget::None, 0, FLT_MAX, worldPos};
+        glm::vec2 reach(m_wireHitThreshold);
         
-        glm::ivec2 gridPos(std::floor(worldPos.x), std::floor(worldPos.y));
-        
-        for (int dy = -1; dy <= 1; dy++) {
-            for (int dx = -1; dx <= 1; dx++) {
-                glm::ivec2 checkPos = gridPos + glm::ivec2(dx, dy);
-                uint64_t cellHash = m_spatialGrid.hashPosition(checkPos);
-                
-                auto it = m_spatialGrid.wireIndex.find(cellHash);
-                if (it == m_spatialGrid.wireIndex.end()) continue;
+        m_wireIndex.query(worldPos - reach, worldPos + reach, [&](uint32_t wireId) {
+            const Wire* wire = m_circuit->getWire(wireId);
+            if (!wire || wire->pathPoints.size() < 2) return;
+            
+            // Check distance to each segment of the wire path
+            for (size_t i = 0; i < wire->pathPoints.size() - 1; i++) {
+                glm::vec2 segStart(wire->pathPoints[i].x, wire->pathPoints[i].y);
+                glm::vec2 segEnd(wire->pathPoints[i + 1].x, wire->pathPoints[i + 1].y);
+                float dist = distanceToLineSegment(worldPos, segStart, segEnd);
                 
-                for (uint32_t wireId : it->second) {
-                    const Wire* wire = m_circuit->getWire(wireId);
+                if (dist < m_wireHitThreshold && dist < closest.distance) {
+                    closest.type = ClickTarget::Wire;
+                    closest.objectId = wireId;
+                    closest.distance = dist;
                     
-                    if (wire) {
-                        if (wire->pathPoints.size() >= 2) {
-                            // Check distance to each segment of the wire path
-                            for (size_t i = 0; i < wire->pathPoints.size() - 1; i++) {
-                                glm::vec2 segStart(wire->pathPoints[i].x, wire->pathPoints[i].y);
-                                glm::vec2 segEnd(wire->pathPoints[i + 1].x, wire->pathPoints[i + 1].y);
-                                float dist = distanceToLineSegment(worldPos, segStart, segEnd);
-                                
-                                if (dist < m_wireHitThreshold && dist < closest.distance) {
-                                    closest.type = ClickTarget::Wire;
-                                    closest.objectId = wireId;
-                                    closest.distance = dist;
-                                    
-                                    glm::vec2 ab = segEnd - segStart;
-                                    glm::vec2 ap = worldPos - segStart;
-                                    float t = glm::clamp(glm::dot(ap, ab) / glm::dot(ab, ab), 0.0f, 1.0f);
-                                    closest.hitPoint = segStart + t * ab;
-                                }
-                            }
-                        }
-                    }
+                    glm::vec2 ab = segEnd - segStart;
+                    glm::vec2 ap = worldPos - segStart;
+                    float t = glm::clamp(glm::dot(ap, ab) / glm::dot(ab, ab), 0.0f, 1.0f);
+                    closest.hitPoint = segStart + t * ab;
                 }
             }
-        }
+        });
         
         return closest;
     }
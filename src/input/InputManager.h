@@ -9,6 +9,7 @@
 #include "../core/Circuit.h"
 #include <SDL.h>
 #include <unordered_set>
+#include <vector>
 #include <imgui.h>
 
 namespace Input {
@@ -55,6 +56,11 @@ private:
         bool invertScroll = false;
     } m_settings;
     
+    // 한 프레임에 들어온 마우스 이동은 모아 두었다가 update(또는 버튼 이벤트 직전)에서 한 번 처리
+    std::vector<glm::vec2> m_motionPath;        // 화면 좌표
+    std::vector<glm::vec2> m_motionWorldPath;
+    uint32_t m_motionTimestamp = 0;
+    
     uint32_t m_frameNumber = 0;
     uint32_t m_lastClickTime = 0;
     glm::vec2 m_lastClickPos{0, 0};
@@ -107,8 +113,8 @@ public:
     
     void update(float deltaTime) {
         m_frameNumber++;
-        m_transformer.updateCache(m_frameNumber);
         
+        flushMouseMotion();
         updateMouseState();
         updateHover();
         
@@ -268,26 +274,46 @@ public:
     
 private:
     void handleMouseMove(const SDL_MouseMotionEvent& event) {
+        // 1000Hz 마우스는 프레임마다 수십 개가 오므로 위치만 쌓고 처리는 프레임당 한 번
+        m_motionPath.emplace_back(event.x, event.y);
+        m_motionTimestamp = event.timestamp;
+    }
+    
+    void flushMouseMotion() {
+        if (m_motionPath.empty()) return;
+        
         m_mouseState.lastPosition = m_mouseState.position;
-        m_mouseState.position = glm::vec2(event.x, event.y);
+        m_mouseState.position = m_motionPath.back();
         
         m_mouseState.worldPosition = m_transformer.screenToWorld(m_mouseState.position);
         m_mouseState.gridPosition = m_transformer.worldToGrid(m_mouseState.worldPosition);
         
+        // 드래그 중에만 와이어 설치가 칸을 건너뛰지 않도록 전체 경로를 월드 좌표로 넘김
+        m_motionWorldPath.clear();
+        if (m_dragManager.isTracking()) {
+            m_motionWorldPath.resize(m_motionPath.size());
+            m_transformer.screenToWorldBatch(m_motionPath.data(), m_motionWorldPath.data(), m_motionPath.size());
+        }
+        m_motionPath.clear();
+        
         MouseEvent mouseEvent;
         mouseEvent.type = MouseEvent::Move;
         mouseEvent.screenPos = m_mouseState.position;
         mouseEvent.worldPos = m_mouseState.worldPosition;
         mouseEvent.gridPos = m_mouseState.gridPosition;
-        mouseEvent.timestamp = SDL_GetTicks();
+        mouseEvent.timestamp = m_motionTimestamp;
         
-        m_dragManager.onMouseMove(mouseEvent);
+        m_dragManager.onMouseMove(mouseEvent, m_motionWorldPath.data(),
+                                  static_cast<uint32_t>(m_motionWorldPath.size()));
     }
     
     void handleMouseDown(const SDL_MouseButtonEvent& event) {
         int button = event.button - 1;
         if (button < 0 || button >= 3) return;
         
+        // 누르기 전까지의 이동을 먼저 반영해 이벤트 순서 유지
+        flushMouseMotion();
+        
         m_mouseState.buttons[button] = true;
         m_mouseState.buttonsPressed[button] = true;
         
@@ -335,6 +361,8 @@ private:
         int button = event.button - 1;
         if (button < 0 || button >= 3) return;
         
+        flushMouseMotion();
+        
         m_mouseState.buttons[button] = false;
         m_mouseState.buttonsReleased[button] = true;
         
@@ -354,6 +382,7 @@ private:
     }
     
     void handleMouseWheel(const SDL_MouseWheelEvent& event) {
+        flushMouseMotion();
         m_mouseState.scrollDelta = event.y * (m_settings.invertScroll ? -1 : 1);
         
         MouseEvent mouseEvent;
@@ -67,6 +67,11 @@ struct DragEvent {
     float distance = 0;
     float duration = 0;
     int button = 0;
+    // Move: 이번 프레임에 지나온 월드 좌표 (currentWorld로 끝남). 병합된 마우스 이동의 전체 경로로,
+    // 칸을 건너뛰지 않아야 하는 구독자가 사용. 디스패치 중에만 유효하므로 복사해 두지 말 것
+    // (EventDispatcher는 DragEvent를 큐에 넣지 않고 항상 바로 전달: ImmediateOnlyEvent)
+    const glm::vec2* path = nullptr;
+    uint32_t pathLength = 0;
 };
 
 struct HoverEvent {
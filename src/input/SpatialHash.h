@@ -0,0 +1,221 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Input {
+
+// 균일 격자 공간 해시: 셀마다 그 셀에 걸친 객체 ID 목록
+// - 셀 좌표는 floor(좌표 / 셀 크기)라서 음수 좌표도 올바른 셀로 감 (0 주변 셀이 겹치지 않음)
+// - 셀 표는 선형 탐사 개방 주소 배열, 셀 안 목록은 한 풀(m_nodes)의 연결 리스트 → 셀마다 vector를 두지 않음
+// - 삽입/제거는 객체가 덮는 셀 수에만 비례, 질의는 질의 상자가 덮는 셀 수 + 그 셀의 항목 수에 비례
+// - 한 객체가 질의 상자의 여러 셀에 걸치면 visit이 같은 ID로 여러 번 불릴 수 있음
+class SpatialHash {
+public:
+    explicit SpatialHash(float cellSize) : m_cellSize(cellSize), m_inverseCellSize(1.0f / cellSize) {}
+
+    // 객체가 덮는 상자 추가 (같은 ID로 여러 번 부르면 합쳐짐: 와이어의 선분마다 호출)
+    void insert(uint32_t id, const glm::vec2& min, const glm::vec2& max) {
+        glm::ivec2 minCell = cellOf(min);
+        glm::ivec2 maxCell = cellOf(max);
+        std::vector<uint64_t>& cells = m_objectCells[id];
+        for (int y = minCell.y; y <= maxCell.y; ++y) {
+            for (int x = minCell.x; x <= maxCell.x; ++x) {
+                uint64_t key = cellKey(x, y);
+                // 선분 상자끼리 겹치는 셀에 같은 ID를 두 번 넣지 않음 (객체당 셀 수는 작음)
+                if (std::find(cells.begin(), cells.end(), key) != cells.end()) {
+                    continue;
+                }
+                cells.push_back(key);
+                link(findOrCreateSlot(key), id);
+            }
+        }
+    }
+
+    void remove(uint32_t id) {
+        auto it = m_objectCells.find(id);
+        if (it == m_objectCells.end()) {
+            return;
+        }
+        for (uint64_t key : it->second) {
+            if (Slot* slot = findSlot(key)) {
+                unlink(*slot, id);
+            }
+        }
+        m_objectCells.erase(it);
+    }
+
+    void clear() {
+        m_slots.clear();
+        m_usedSlots = 0;
+        m_nodes.clear();
+        m_freeNode = NONE;
+        m_objectCells.clear();
+    }
+
+    bool contains(uint32_t id) const { return m_objectCells.count(id) > 0; }
+    size_t getObjectCount() const { return m_objectCells.size(); }
+    float getCellSize() const { return m_cellSize; }
+
+    template<typename Visitor>
+    void query(const glm::vec2& min, const glm::vec2& max, Visitor&& visit) const {
+        if (m_slots.empty()) {
+            return;
+        }
+        glm::ivec2 minCell = cellOf(min);
+        glm::ivec2 maxCell = cellOf(max);
+        for (int y = minCell.y; y <= maxCell.y; ++y) {
+            for (int x = minCell.x; x <= maxCell.x; ++x) {
+                const Slot* slot = findSlot(cellKey(x, y));
+                if (!slot) {
+                    continue;
+                }
+                for (uint32_t node = slot->head; node != NONE; node = m_nodes[node].next) {
+                    visit(m_nodes[node].id);
+                }
+            }
+        }
+    }
+
+    glm::ivec2 cellOf(const glm::vec2& position) const {
+        return glm::ivec2(static_cast<int>(std::floor(position.x * m_inverseCellSize)),
+                          static_cast<int>(std::floor(position.y * m_inverseCellSize)));
+    }
+
+private:
+    static constexpr uint32_t NONE = ~0u;
+    static constexpr uint64_t EMPTY_KEY = ~0ull;    // (-1, -1) 셀 키와 겹치지 않도록 cellKey가 이 값을 만들지 않음
+    static constexpr size_t MIN_SLOTS = 64;
+
+    struct Slot {
+        uint64_t key = EMPTY_KEY;
+        uint32_t head = NONE;       // 비어 있는 셀도 슬롯은 남김 (다음 재해시 때 정리)
+    };
+
+    struct Node {
+        uint32_t id;
+        uint32_t next;
+    };
+
+    float m_cellSize;
+    float m_inverseCellSize;
+    std::vector<Slot> m_slots;      // 크기는 2의 거듭제곱
+    size_t m_usedSlots = 0;
+    std::vector<Node> m_nodes;
+    uint32_t m_freeNode = NONE;
+    // 객체 ID -> 넣은 셀 키 (제거할 때 전체를 훑지 않기 위해)
+    std::unordered_map<uint32_t, std::vector<uint64_t>> m_objectCells;
+
+    static uint64_t cellKey(int x, int y) {
+        // 부호 비트를 뒤집어 (x, y) = (-1, -1)도 EMPTY_KEY가 되지 않게 함
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x) ^ 0x80000000u) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(y));
+    }
+
+    static size_t hashKey(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDull;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+    const Slot* findSlot(uint64_t key) const {
+        if (m_slots.empty()) {
+            return nullptr;
+        }
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = hashKey(key) & mask;; i = (i + 1) & mask) {
+            const Slot& slot = m_slots[i];
+            if (slot.key == key) {
+                return &slot;
+            }
+            if (slot.key == EMPTY_KEY) {
+                return nullptr;
+            }
+        }
+    }
+
+    Slot* findSlot(uint64_t key) {
+        return const_cast<Slot*>(static_cast<const SpatialHash*>(this)->findSlot(key));
+    }
+
+    Slot& findOrCreateSlot(uint64_t key) {
+        // 사용률 50%를 넘기 전에 늘림 (선형 탐사 길이를 짧게 유지)
+        if ((m_usedSlots + 1) * 2 > m_slots.size()) {
+            rehash(std::max(MIN_SLOTS, m_slots.size() * 2));
+        }
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = hashKey(key) & mask;; i = (i + 1) & mask) {
+            Slot& slot = m_slots[i];
+            if (slot.key == key) {
+                return slot;
+            }
+            if (slot.key == EMPTY_KEY) {
+                slot.key = key;
+                slot.head = NONE;
+                m_usedSlots++;
+                return slot;
+            }
+        }
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+        // 빈 셀을 버린 뒤 남은 수가 작으면 용량을 키우지 않음
+        size_t live = 0;
+        for (const Slot& slot : old) {
+            live += slot.key != EMPTY_KEY && slot.head != NONE;
+        }
+        while (capacity > MIN_SLOTS && (live + 1) * 4 <= capacity) {
+            capacity /= 2;
+        }
+        m_slots.assign(capacity, Slot{});
+        m_usedSlots = 0;
+        size_t mask = capacity - 1;
+        for (const Slot& slot : old) {
+            if (slot.key == EMPTY_KEY || slot.head == NONE) {
+                continue;
+            }
+            size_t i = hashKey(slot.key) & mask;
+            while (m_slots[i].key != EMPTY_KEY) {
+                i = (i + 1) & mask;
+            }
+            m_slots[i] = slot;
+            m_usedSlots++;
+        }
+    }
+
+    void link(Slot& slot, uint32_t id) {
+        uint32_t node;
+        if (m_freeNode != NONE) {
+            node = m_freeNode;
+            m_freeNode = m_nodes[node].next;
+        } else {
+            node = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.push_back(Node{});
+        }
+        m_nodes[node] = Node{id, slot.head};
+        slot.head = node;
+    }
+
+    void unlink(Slot& slot, uint32_t id) {
+        uint32_t* link = &slot.head;
+        while (*link != NONE) {
+            uint32_t node = *link;
+            if (m_nodes[node].id == id) {
+                *link = m_nodes[node].next;
+                m_nodes[node].next = m_freeNode;
+                m_freeNode = node;
+                return;
+            }
+            link = &m_nodes[node].next;
+        }
+    }
+};
+
+} // namespace Input
@@ -11,41 +11,35 @@ Camera::Camera(int screenWidth, int screenHeight)
     , m_maxGridBounds(100, 100) {
 }
 
+const ViewTransform& Camera::GetTransform() const {
+    if (m_transform.version != m_version) {
+        m_transform = ViewTransform::Build(m_position, GetPixelsPerGrid(), m_screenSize, m_version);
+    }
+    return m_transform;
+}
+
 glm::mat4 Camera::GetViewMatrix() const {
-    glm::mat4 view(1.0f);
-    view = glm::translate(view, glm::vec3(-m_position.x, -m_position.y, 0.0f));
-    return view;
+    return GetTransform().view;
 }
 
 glm::mat4 Camera::GetProjectionMatrix() const {
-    float halfWidth = m_screenSize.x * 0.5f / (DEFAULT_CELL_SIZE * m_zoom);
-    float halfHeight = m_screenSize.y * 0.5f / (DEFAULT_CELL_SIZE * m_zoom);
-    
-    return glm::ortho(-halfWidth, halfWidth, -halfHeight, halfHeight, -1.0f, 1.0f);
+    return GetTransform().projection;
 }
 
 glm::mat4 Camera::GetViewProjectionMatrix() const {
-    return GetProjectionMatrix() * GetViewMatrix();
+    return GetTransform().viewProjection;
 }
 
 glm::vec2 Camera::ScreenToWorld(const glm::vec2& screenPos) const {
-    // 스크린 좌표를 중심 기준으로 변환
-    glm::vec2 offset = screenPos - m_screenSize * 0.5f;
-    // Y축 반전 (스크린 Y는 아래로 증가, 월드 Y는 위로 증가)
-    offset.y = -offset.y;
-    return m_position + offset / (DEFAULT_CELL_SIZE * m_zoom);
+    return GetTransform().ScreenToWorld(screenPos);
 }
 
 glm::vec2 Camera::WorldToScreen(const glm::vec2& worldPos) const {
-    glm::vec2 offset = (worldPos - m_position) * (DEFAULT_CELL_SIZE * m_zoom);
-    // Y축 반전 (월드 Y는 위로 증가, 스크린 Y는 아래로 증가)
-    offset.y = -offset.y;
-    return offset + m_screenSize * 0.5f;
+    return GetTransform().WorldToScreen(worldPos);
 }
 
 glm::ivec2 Camera::ScreenToGrid(const glm::vec2& screenPos) const {
-    glm::vec2 worldPos = ScreenToWorld(screenPos);
-    return glm::ivec2(floor(worldPos.x), floor(worldPos.y));
+    return GetTransform().ScreenToGrid(screenPos);
 }
 
 glm::vec2 Camera::GridToScreen(const glm::ivec2& gridPos) const {
@@ -60,6 +54,7 @@ void Camera::Pan(const glm::vec2& delta) {
     worldDelta.y = -worldDelta.y;
     // 카메라를 반대 방향으로 이동 (끌어당기는 효과)
     m_position -= worldDelta;
+    MarkTransformDirty();
     
     if (!m_unlimitedGrid) {
         ClampCameraPosition();
@@ -70,10 +65,12 @@ void Camera::Zoom(float factor, const glm::vec2& screenPos) {
     glm::vec2 worldBeforeZoom = ScreenToWorld(screenPos);
     
     m_zoom = glm::clamp(m_zoom * factor, MIN_ZOOM, MAX_ZOOM);
+    MarkTransformDirty();
     
     glm::vec2 worldAfterZoom = ScreenToWorld(screenPos);
     
     m_position += worldBeforeZoom - worldAfterZoom;
+    MarkTransformDirty();
     
     if (!m_unlimitedGrid) {
         ClampCameraPosition();
@@ -83,6 +80,7 @@ void Camera::Zoom(float factor, const glm::vec2& screenPos) {
 void Camera::Reset() {
     m_position = glm::vec2(0.0f, 0.0f);
     m_zoom = 1.0f;
+    MarkTransformDirty();
     
     if (!m_unlimitedGrid) {
         ClampCameraPosition();
@@ -91,25 +89,17 @@ void Camera::Reset() {
 
 void Camera::SetZoom(float zoom) {
     m_zoom = glm::clamp(zoom, MIN_ZOOM, MAX_ZOOM);
+    MarkTransformDirty();
 }
 
 void Camera::SetScreenSize(int width, int height) {
     m_screenSize.x = static_cast<float>(width);
     m_screenSize.y = static_cast<float>(height);
+    MarkTransformDirty();
 }
 
 glm::vec4 Camera::GetVisibleBounds() const {
-    // 스크린의 네 모서리를 월드 좌표로 변환
-    glm::vec2 topLeft = ScreenToWorld(glm::vec2(0, 0));
-    glm::vec2 bottomRight = ScreenToWorld(m_screenSize);
-    
-    // Y축이 반전되므로 min/max를 올바르게 설정
-    float minX = std::min(topLeft.x, bottomRight.x);
-    float maxX = std::max(topLeft.x, bottomRight.x);
-    float minY = std::min(topLeft.y, bottomRight.y);
-    float maxY = std::max(topLeft.y, bottomRight.y);
-    
-    return glm::vec4(minX, minY, maxX, maxY);
+    return GetTransform().visibleBounds;
 }
 
 bool Camera::IsGridCellVisible(const glm::ivec2& gridPos) const {
@@ -161,4 +151,5 @@ void Camera::ClampCameraPosition() {
     } else {
         m_position.y = glm::clamp(m_position.y, minCamY, maxCamY);
     }
+    MarkTransformDirty();
 }
\ No newline at end of file
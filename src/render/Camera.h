@@ -3,11 +3,17 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include "render/ViewTransform.h"
 
 class Camera {
 public:
     Camera(int screenWidth, int screenHeight);
     
+    // 현재 카메라의 변환 스냅샷 (바뀐 뒤 처음 부를 때만 다시 계산)
+    // 참조는 다음 카메라 변경 전까지 유효하므로 오래 보관할 쪽은 복사해 둠
+    const ViewTransform& GetTransform() const;
+    uint32_t GetTransformVersion() const { return m_version; }
+    
     glm::mat4 GetViewMatrix() const;
     glm::mat4 GetProjectionMatrix() const;
     glm::mat4 GetViewProjectionMatrix() const;
@@ -21,7 +27,7 @@ public:
     void Zoom(float factor, const glm::vec2& screenPos);
     void Reset();
     
-    void SetPosition(const glm::vec2& position) { m_position = position; }
+    void SetPosition(const glm::vec2& position) { m_position = position; MarkTransformDirty(); }
     glm::vec2 GetPosition() const { return m_position; }
     
     void SetZoom(float zoom);
@@ -54,6 +60,12 @@ private:
     glm::ivec2 m_minGridBounds;
     glm::ivec2 m_maxGridBounds;
     
+    // 위치/줌/화면 크기가 바뀔 때마다 증가
+    uint32_t m_version = 1;
+    mutable ViewTransform m_transform;
+    
+    void MarkTransformDirty() { ++m_version; }
+    
     // Helper function to clamp camera position
     void ClampCameraPosition();
     
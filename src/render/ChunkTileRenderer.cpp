@@ -0,0 +1,152 @@
+#include "ChunkTileRenderer.h"
+#include "GLState.h"
+#include <iostream>
+#include <algorithm>
+
+namespace {
+
+// 셰이더 유니폼 (이름 등록은 정적 초기화 때 한 번)
+const UniformId U_VIEW_PROJECTION("uViewProjection");
+const UniformId U_CHUNK_WORLD_SIZE("uChunkWorldSize");
+const UniformId U_CELL_SIZE("uCellSize");
+const UniformId U_BASE_COLOR("uBaseColor");
+const UniformId U_ACTIVE_COLOR("uActiveColor");
+
+} // namespace
+
+ChunkTileRenderer::ChunkTileRenderer()
+    : m_vao(0)
+    , m_vboQuad(0)
+    , m_vboTiles(0)
+    , m_maxTiles(1024)
+    , m_cellSize(1.0f)
+    , m_initialized(false) {
+}
+
+ChunkTileRenderer::~ChunkTileRenderer() {
+    Cleanup();
+}
+
+bool ChunkTileRenderer::Initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    // 단위 사각형 (0~1), 셰이더에서 청크 크기만큼 늘림
+    const float quadVertices[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f
+    };
+
+    glGenVertexArrays(1, &m_vao);
+    glGenBuffers(1, &m_vboQuad);
+    glGenBuffers(1, &m_vboTiles);
+
+    GLState::BindVertexArray(m_vao);
+
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboQuad);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // 타일마다 (origin.xy, density, activity)
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboTiles);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(ChunkTile) * m_maxTiles, nullptr, GL_STREAM_DRAW);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ChunkTile), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    GLState::BindVertexArray(0);
+
+    SetupShaders();
+
+    m_initialized = true;
+    return true;
+}
+
+void ChunkTileRenderer::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_vao) GLState::DeleteVertexArray(m_vao);
+    if (m_vboQuad) GLState::DeleteBuffer(m_vboQuad);
+    if (m_vboTiles) GLState::DeleteBuffer(m_vboTiles);
+    m_vao = m_vboQuad = m_vboTiles = 0;
+
+    m_shader.reset();
+
+    m_initialized = false;
+}
+
+void ChunkTileRenderer::SetupShaders() {
+    const char* tileVertexShader = R"(
+#version 330 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec4 aTile;
+
+uniform mat4 uViewProjection;
+uniform float uChunkWorldSize;
+uniform float uCellSize;
+uniform vec4 uBaseColor;
+uniform vec4 uActiveColor;
+
+out vec4 TileColor;
+
+void main() {
+    vec2 worldPos = aTile.xy * uCellSize + aPos * uChunkWorldSize;
+    gl_Position = uViewProjection * vec4(worldPos, 0.0, 1.0);
+
+    // 조금이라도 있으면 보이도록 최소 불투명도를 둠
+    vec4 color = mix(uBaseColor, uActiveColor, aTile.w);
+    color.a *= 0.2 + 0.8 * sqrt(clamp(aTile.z, 0.0, 1.0));
+    TileColor = color;
+}
+)";
+
+    const char* tileFragmentShader = R"(
+#version 330 core
+
+in vec4 TileColor;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = TileColor;
+}
+)";
+
+    m_shader = std::make_unique<ShaderProgram>();
+    if (!m_shader->LoadFromSource(tileVertexShader, tileFragmentShader)) {
+        std::cerr << "Failed to compile chunk tile shader!" << std::endl;
+    }
+}
+
+void ChunkTileRenderer::Record(const std::vector<ChunkTile>& tiles, const glm::vec4& baseColor,
+                               const glm::vec4& activeColor, const Camera& camera,
+                               RenderCommandList& commands) {
+    if (tiles.empty()) {
+        return;
+    }
+
+    if (tiles.size() > m_maxTiles) {
+        m_maxTiles = std::max(tiles.size(), m_maxTiles * 2);
+    }
+    commands.ReallocateBuffer(m_vboTiles, sizeof(ChunkTile) * m_maxTiles, nullptr, true);
+    commands.UpdateBuffer(m_vboTiles, 0, sizeof(ChunkTile) * tiles.size(), tiles.data());
+
+    commands.SetBlend(true);
+    commands.UseShader(m_shader.get());
+    commands.SetUniform(U_VIEW_PROJECTION, camera.GetViewProjectionMatrix());
+    commands.SetUniform(U_CHUNK_WORLD_SIZE, static_cast<float>(RENDER_CHUNK_SIZE) * m_cellSize);
+    commands.SetUniform(U_CELL_SIZE, m_cellSize);
+    commands.SetUniform(U_BASE_COLOR, baseColor);
+    commands.SetUniform(U_ACTIVE_COLOR, activeColor);
+    commands.Draw(m_vao, PrimitiveType::Triangles, 0, 6, static_cast<uint32_t>(tiles.size()));
+    commands.SetBlend(false);
+}
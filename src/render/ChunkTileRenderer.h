@@ -0,0 +1,39 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <memory>
+#include "render/RenderTypes.h"
+#include "render/RenderCommandList.h"
+#include "render/ShaderProgram.h"
+#include "render/Camera.h"
+
+// 줌 아웃 시 청크 하나를 사각형 하나로 그리는 집계 렌더러
+// 밀도는 불투명도, HIGH 비율은 기본색과 활성색 사이 보간으로 표시
+class ChunkTileRenderer {
+public:
+    ChunkTileRenderer();
+    ~ChunkTileRenderer();
+
+    bool Initialize();
+    void Cleanup();
+
+    void Record(const std::vector<ChunkTile>& tiles, const glm::vec4& baseColor,
+                const glm::vec4& activeColor, const Camera& camera, RenderCommandList& commands);
+
+    void SetCellSize(float size) { m_cellSize = size; }
+
+private:
+    void SetupShaders();
+
+    GLuint m_vao;
+    GLuint m_vboQuad;
+    GLuint m_vboTiles;
+    size_t m_maxTiles;
+
+    std::unique_ptr<ShaderProgram> m_shader;
+
+    float m_cellSize;
+    bool m_initialized;
+};
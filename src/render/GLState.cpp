@@ -0,0 +1,123 @@
+#include "GLState.h"
+
+namespace {
+
+// 아직 모르는 바인딩 (실제 GL 이름과 겹치지 않음)
+constexpr GLuint UNKNOWN_BINDING = ~0u;
+
+enum BufferSlot { ARRAY_SLOT, ELEMENT_ARRAY_SLOT, TEXTURE_BUFFER_SLOT, UNIFORM_SLOT, BUFFER_SLOT_COUNT };
+
+struct TrackedState {
+    GLuint program = UNKNOWN_BINDING;
+    GLuint vertexArray = UNKNOWN_BINDING;
+    GLuint buffers[BUFFER_SLOT_COUNT] = {UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING, UNKNOWN_BINDING};
+
+    GLState::Counters frame;
+    GLState::Counters lastFrame;
+};
+
+TrackedState& GetState() {
+    static TrackedState state;
+    return state;
+}
+
+int SlotForTarget(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:         return ARRAY_SLOT;
+        case GL_ELEMENT_ARRAY_BUFFER: return ELEMENT_ARRAY_SLOT;
+        case GL_TEXTURE_BUFFER:       return TEXTURE_BUFFER_SLOT;
+        case GL_UNIFORM_BUFFER:       return UNIFORM_SLOT;
+        default:                      return -1;
+    }
+}
+
+} // namespace
+
+void GLState::UseProgram(GLuint program) {
+    TrackedState& state = GetState();
+    if (state.program == program) {
+        state.frame.programSkips++;
+        return;
+    }
+    glUseProgram(program);
+    state.program = program;
+    state.frame.programBinds++;
+}
+
+void GLState::BindVertexArray(GLuint vertexArray) {
+    TrackedState& state = GetState();
+    if (state.vertexArray == vertexArray) {
+        state.frame.vertexArraySkips++;
+        return;
+    }
+    glBindVertexArray(vertexArray);
+    state.vertexArray = vertexArray;
+    // 인덱스 버퍼 바인딩은 VAO마다 따로 저장됨
+    state.buffers[ELEMENT_ARRAY_SLOT] = UNKNOWN_BINDING;
+    state.frame.vertexArrayBinds++;
+}
+
+void GLState::BindBuffer(GLenum target, GLuint buffer) {
+    TrackedState& state = GetState();
+    int slot = SlotForTarget(target);
+    if (slot < 0) {
+        glBindBuffer(target, buffer);
+        state.frame.bufferBinds++;
+        return;
+    }
+    if (state.buffers[slot] == buffer) {
+        state.frame.bufferSkips++;
+        return;
+    }
+    glBindBuffer(target, buffer);
+    state.buffers[slot] = buffer;
+    state.frame.bufferBinds++;
+}
+
+void GLState::DeleteProgram(GLuint program) {
+    TrackedState& state = GetState();
+    glDeleteProgram(program);
+    // 사용 중인 프로그램은 지워도 바인딩이 유지되다가 다른 프로그램을 쓸 때 해제되므로 모르는 값으로 둠
+    if (state.program == program) {
+        state.program = UNKNOWN_BINDING;
+    }
+}
+
+void GLState::DeleteVertexArray(GLuint vertexArray) {
+    TrackedState& state = GetState();
+    glDeleteVertexArrays(1, &vertexArray);
+    if (state.vertexArray == vertexArray) {
+        state.vertexArray = 0;
+        state.buffers[ELEMENT_ARRAY_SLOT] = UNKNOWN_BINDING;
+    }
+}
+
+void GLState::DeleteBuffer(GLuint buffer) {
+    TrackedState& state = GetState();
+    glDeleteBuffers(1, &buffer);
+    for (GLuint& bound : state.buffers) {
+        if (bound == buffer) {
+            bound = 0;
+        }
+    }
+}
+
+void GLState::Invalidate() {
+    TrackedState& state = GetState();
+    state.program = UNKNOWN_BINDING;
+    state.vertexArray = UNKNOWN_BINDING;
+    for (GLuint& bound : state.buffers) {
+        bound = UNKNOWN_BINDING;
+    }
+}
+
+void GLState::BeginFrame() {
+    TrackedState& state = GetState();
+    state.lastFrame = state.frame;
+    state.frame = Counters{};
+    Invalidate();
+}
+
+const GLState::Counters& GLState::GetLastFrameCounters() {
+    return GetState().lastFrame;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// 프로그램/VAO/버퍼 바인딩 추적기 (GL 스레드 전용)
+// - 마지막으로 바인딩한 값을 기억해 같은 값의 glUseProgram/glBindVertexArray/glBindBuffer를 건너뜀
+// - GL_ELEMENT_ARRAY_BUFFER는 VAO 상태라 VAO가 바뀌면 모르는 값으로 돌림
+// - 바인딩된 객체를 지우면 GL처럼 0으로 되돌려야 이름이 재사용돼도 잘못 건너뛰지 않으므로
+//   삭제도 여기의 Delete* 함수를 거침
+// - 이 추적기를 거치지 않고 상태를 바꾸는 외부 코드가 있을 수 있으므로 프레임마다 BeginFrame에서 비움
+class GLState {
+public:
+    struct Counters {
+        uint32_t programBinds = 0;
+        uint32_t programSkips = 0;
+        uint32_t vertexArrayBinds = 0;
+        uint32_t vertexArraySkips = 0;
+        uint32_t bufferBinds = 0;
+        uint32_t bufferSkips = 0;
+
+        uint32_t GetTotalSkips() const { return programSkips + vertexArraySkips + bufferSkips; }
+    };
+
+    static void UseProgram(GLuint program);
+    static void BindVertexArray(GLuint vertexArray);
+    static void BindBuffer(GLenum target, GLuint buffer);
+
+    static void DeleteProgram(GLuint program);
+    static void DeleteVertexArray(GLuint vertexArray);
+    static void DeleteBuffer(GLuint buffer);
+
+    // 기억한 바인딩을 모두 버림 (다음 호출은 항상 GL까지 감)
+    static void Invalidate();
+
+    // 프레임 경계: 이번 프레임 카운터를 보관하고 캐시를 비움
+    static void BeginFrame();
+    // 직전에 끝난 프레임의 카운터
+    static const Counters& GetLastFrameCounters();
+};
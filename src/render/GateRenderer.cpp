@@ -1,18 +1,61 @@
 #include "GateRenderer.h"
+#include "GLState.h"
+#include "../utils/JobSystem.h"
 #include <iostream>
 #include <algorithm>
+#include <cstring>
 #include <SDL.h>
 
+namespace {
+
+// 셰이더 유니폼 (이름 등록은 정적 초기화 때 한 번)
+const UniformId U_INSTANCES("uInstances");
+const UniformId U_SIGNALS("uSignals");
+const UniformId U_TOGGLE_TIMES("uToggleTimes");
+const UniformId U_TIME("uTime");
+const UniformId U_PROJECTION("uProjection");
+const UniformId U_VIEW("uView");
+const UniformId U_GRID_SIZE("uGridSize");
+const UniformId U_LOW_COLOR("uLowColor");
+const UniformId U_HIGH_COLOR("uHighColor");
+const UniformId U_SELECTED_COLOR("uSelectedColor");
+const UniformId U_USE_OVERRIDE_COLOR("uUseOverrideColor");
+const UniformId U_BORDER_COLOR("uBorderColor");
+const UniformId U_BORDER_WIDTH("uBorderWidth");
+const UniformId U_MVP("uMVP");
+const UniformId U_PORT_OFFSET("uPortOffset");
+const UniformId U_OVERRIDE_COLOR("uOverrideColor");
+const UniformId U_OFFSET("uOffset");
+const UniformId U_COLOR("uColor");
+
+} // namespace
+
 GateRenderer::GateRenderer()
     : m_vaoGate(0)
     , m_vboGate(0)
     , m_eboGate(0)
     , m_vboInstance(0)
+    , m_instanceTexture(0)
+    , m_vboVisible(0)
     , m_vaoPort(0)
     , m_vboPort(0)
+    , m_vaoPortInstanced(0)
+    , m_vaoPreview(0)
+    , m_vboPreview(0)
+    , m_previewTexture(0)
     , m_gateSize(1.0f)
-    , m_useInstancing(true)
+    , m_drawPorts(true)
     , m_maxInstances(10000)
+    , m_maxVisible(10000)
+    , m_fullUpload(false)
+    , m_syncedCircuit(nullptr)
+    , m_jobs(nullptr)
+    , m_chunkVersion(0)
+    , m_visibleVersion(0)
+    , m_visibleMin(0)
+    , m_visibleMax(-1)
+    , m_visibleChunkCount(0)
+    , m_visibleUploaded(false)
     , m_initialized(false) {
 }
 
@@ -39,15 +82,25 @@ void GateRenderer::Cleanup() {
         return;
     }
     
-    if (m_vaoGate) glDeleteVertexArrays(1, &m_vaoGate);
-    if (m_vboGate) glDeleteBuffers(1, &m_vboGate);
-    if (m_eboGate) glDeleteBuffers(1, &m_eboGate);
-    if (m_vboInstance) glDeleteBuffers(1, &m_vboInstance);
-    if (m_vaoPort) glDeleteVertexArrays(1, &m_vaoPort);
-    if (m_vboPort) glDeleteBuffers(1, &m_vboPort);
+    if (m_vaoGate) GLState::DeleteVertexArray(m_vaoGate);
+    if (m_vboGate) GLState::DeleteBuffer(m_vboGate);
+    if (m_eboGate) GLState::DeleteBuffer(m_eboGate);
+    if (m_vboInstance) GLState::DeleteBuffer(m_vboInstance);
+    if (m_instanceTexture) glDeleteTextures(1, &m_instanceTexture);
+    if (m_vboVisible) GLState::DeleteBuffer(m_vboVisible);
+    if (m_vaoPort) GLState::DeleteVertexArray(m_vaoPort);
+    if (m_vboPort) GLState::DeleteBuffer(m_vboPort);
+    if (m_vaoPortInstanced) GLState::DeleteVertexArray(m_vaoPortInstanced);
+    if (m_vaoPreview) GLState::DeleteVertexArray(m_vaoPreview);
+    if (m_vboPreview) GLState::DeleteBuffer(m_vboPreview);
+    if (m_previewTexture) glDeleteTextures(1, &m_previewTexture);
+    m_visibleUploaded = false;
     
     m_gateShader.reset();
     m_portShader.reset();
+    m_portInstancedShader.reset();
+    
+    InvalidateGateCache();
     
     m_initialized = false;
 }
@@ -71,12 +124,12 @@ void GateRenderer::SetupGeometry() {
     glGenBuffers(1, &m_vboGate);
     glGenBuffers(1, &m_eboGate);
     
-    glBindVertexArray(m_vaoGate);
+    GLState::BindVertexArray(m_vaoGate);
     
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboGate);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboGate);
     glBufferData(GL_ARRAY_BUFFER, sizeof(gateVertices), gateVertices, GL_STATIC_DRAW);
     
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_eboGate);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_eboGate);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(gateIndices), gateIndices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
@@ -85,31 +138,39 @@ void GateRenderer::SetupGeometry() {
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
     glEnableVertexAttribArray(1);
     
-    if (m_useInstancing) {
-        glGenBuffers(1, &m_vboInstance);
-        glBindBuffer(GL_ARRAY_BUFFER, m_vboInstance);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(GateInstance) * m_maxInstances, nullptr, GL_DYNAMIC_DRAW);
-        
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GateInstance), 
-                            (void*)offsetof(GateInstance, position));
-        glEnableVertexAttribArray(2);
-        glVertexAttribDivisor(2, 1);
-        
-        glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(GateInstance), 
-                            (void*)offsetof(GateInstance, color));
-        glEnableVertexAttribArray(3);
-        glVertexAttribDivisor(3, 1);
-        
-        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GateInstance), 
-                            (void*)offsetof(GateInstance, rotation));
-        glEnableVertexAttribArray(4);
-        glVertexAttribDivisor(4, 1);
-        
-        glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GateInstance), 
-                            (void*)offsetof(GateInstance, scale));
-        glEnableVertexAttribArray(5);
-        glVertexAttribDivisor(5, 1);
-    }
+    // 게이트 데이터는 버퍼 텍스처로 읽고, 인스턴스 속성은 그릴 슬롯 번호 하나뿐
+    glGenBuffers(1, &m_vboVisible);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboVisible);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(uint32_t) * m_maxVisible, nullptr, GL_STREAM_DRAW);
+    glVertexAttribIPointer(2, 1, GL_UNSIGNED_INT, sizeof(uint32_t), (void*)0);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+    
+    // 인스턴스 버퍼는 프레임 사이에 유지하고 바뀐 슬롯만 갱신
+    glGenBuffers(1, &m_vboInstance);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboInstance);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GateInstance) * m_maxInstances, nullptr, GL_DYNAMIC_DRAW);
+    glGenTextures(1, &m_instanceTexture);
+    glBindTexture(GL_TEXTURE_BUFFER, m_instanceTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_vboInstance);
+    
+    // 미리보기는 별도 버퍼 (영구 인스턴스 버퍼를 덮어쓰지 않도록), 슬롯 번호는 상수 속성 0
+    glGenVertexArrays(1, &m_vaoPreview);
+    GLState::BindVertexArray(m_vaoPreview);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboGate);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_eboGate);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    
+    glGenBuffers(1, &m_vboPreview);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboPreview);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GateInstance), nullptr, GL_DYNAMIC_DRAW);
+    glGenTextures(1, &m_previewTexture);
+    glBindTexture(GL_TEXTURE_BUFFER, m_previewTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_vboPreview);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
     
     const int portSegments = 8;
     std::vector<float> portVertices;
@@ -127,15 +188,26 @@ void GateRenderer::SetupGeometry() {
     glGenVertexArrays(1, &m_vaoPort);
     glGenBuffers(1, &m_vboPort);
     
-    glBindVertexArray(m_vaoPort);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboPort);
+    GLState::BindVertexArray(m_vaoPort);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboPort);
     glBufferData(GL_ARRAY_BUFFER, portVertices.size() * sizeof(float), 
                 portVertices.data(), GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glBindVertexArray(0);
+    // 출력 포트도 같은 슬롯 목록으로 한 번에 그림
+    glGenVertexArrays(1, &m_vaoPortInstanced);
+    GLState::BindVertexArray(m_vaoPortInstanced);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboPort);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboVisible);
+    glVertexAttribIPointer(2, 1, GL_UNSIGNED_INT, sizeof(uint32_t), (void*)0);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+    
+    GLState::BindVertexArray(0);
 }
 
 void GateRenderer::SetupShaders() {
@@ -144,31 +216,55 @@ void GateRenderer::SetupShaders() {
 
 layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec2 aInstancePos;
-layout (location = 3) in vec4 aInstanceColor;
-layout (location = 4) in float aInstanceRotation;
-layout (location = 5) in float aInstanceScale;
+layout (location = 2) in uint aSlot;
 
+uniform samplerBuffer uInstances;
+uniform usamplerBuffer uSignals;
+uniform samplerBuffer uToggleTimes;
+uniform float uTime;
 uniform mat4 uProjection;
 uniform mat4 uView;
 uniform float uGridSize;
+uniform vec4 uLowColor;
+uniform vec4 uHighColor;
+uniform vec4 uSelectedColor;
+uniform bool uUseOverrideColor;
+uniform vec4 uOverrideColor;
 
 out vec2 TexCoord;
 out vec4 GateColor;
 
 void main() {
-    float cosR = cos(aInstanceRotation);
-    float sinR = sin(aInstanceRotation);
+    // 슬롯당 텍셀 2개: (위치, 회전, 크기), (넷 번호, 선택, -, -)
+    int base = int(aSlot) * 2;
+    vec4 transform = texelFetch(uInstances, base);
+    vec2 instancePos = transform.xy;
+    
+    float cosR = cos(transform.z);
+    float sinR = sin(transform.z);
     mat2 rotation = mat2(cosR, -sinR, sinR, cosR);
     
-    vec2 localPos = rotation * (aPos * aInstanceScale * uGridSize);
+    vec2 localPos = rotation * (aPos * transform.w * uGridSize);
     // 셀 중심에 배치 (0.5 오프셋 추가)
-    vec2 worldPos = localPos + (aInstancePos + vec2(0.5, 0.5)) * uGridSize;
+    vec2 worldPos = localPos + (instancePos + vec2(0.5, 0.5)) * uGridSize;
     
     gl_Position = uProjection * uView * vec4(worldPos, 0.0, 1.0);
     
     TexCoord = aTexCoord;
-    GateColor = aInstanceColor;
+    
+    vec4 state = texelFetch(uInstances, base + 1);
+    uint net = uint(state.x);
+    bool high = ((texelFetch(uSignals, int(net >> 5u)).r >> (net & 31u)) & 1u) != 0u;
+    if (uUseOverrideColor) {
+        GateColor = uOverrideColor;
+    } else if (state.y > 0.5) {
+        GateColor = uSelectedColor;
+    } else {
+        GateColor = high ? uHighColor : uLowColor;
+        // 출력이 바뀐 직후 잠깐 밝게 (토글 시각 기준, CPU 상태 없음)
+        float age = uTime - texelFetch(uToggleTimes, int(net)).r;
+        GateColor.rgb = mix(GateColor.rgb, vec3(1.0), 0.5 * clamp(1.0 - age / 0.25, 0.0, 1.0));
+    }
 }
 )";
 
@@ -228,151 +324,517 @@ void main() {
     if (!m_portShader->LoadFromSource(simpleVertexShader, simpleFragmentShader)) {
         std::cerr << "Failed to compile port shader!" << std::endl;
     }
+    
+    const char* portInstancedVertexShader = R"(
+#version 330 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 2) in uint aSlot;
+
+uniform samplerBuffer uInstances;
+uniform usamplerBuffer uSignals;
+uniform mat4 uMVP;
+uniform float uGridSize;
+uniform vec2 uPortOffset;
+
+out vec4 PortColor;
+
+void main() {
+    int base = int(aSlot) * 2;
+    vec2 instancePos = texelFetch(uInstances, base).xy;
+    uint net = uint(texelFetch(uInstances, base + 1).x);
+    bool high = ((texelFetch(uSignals, int(net >> 5u)).r >> (net & 31u)) & 1u) != 0u;
+    
+    // 셀 중심 + 출력 포트 오프셋 (게이트 오른쪽 경계)
+    vec2 center = (instancePos + vec2(0.5, 0.5) + uPortOffset) * uGridSize;
+    gl_Position = uMVP * vec4(aPos + center, 0.0, 1.0);
+    
+    // HIGH는 초록색, LOW는 빨간색
+    PortColor = high ? vec4(0.0, 1.0, 0.0, 1.0) : vec4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+    const char* portInstancedFragmentShader = R"(
+#version 330 core
+
+in vec4 PortColor;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = PortColor;
+}
+)";
+
+    m_portInstancedShader = std::make_unique<ShaderProgram>();
+    if (!m_portInstancedShader->LoadFromSource(portInstancedVertexShader, portInstancedFragmentShader)) {
+        std::cerr << "Failed to compile instanced port shader!" << std::endl;
+    }
 }
 
 void GateRenderer::BeginFrame() {
+    m_stats.visibleInstances = 0;
+    m_stats.visibleChunks = 0;
+    m_stats.changedGates = 0;
+    m_stats.uploadedInstances = 0;
+    m_stats.uploadCalls = 0;
+    m_stats.visibleUploads = 0;
+    m_stats.drawCalls = 0;
+}
+
+void GateRenderer::InvalidateGateCache() {
+    m_syncedCircuit = nullptr;
     m_instanceData.clear();
+    m_gateOfSlot.clear();
+    m_slotOfGate.clear();
+    m_indexInChunk.clear();
+    m_slotHigh.clear();
+    m_chunks.clear();
+    m_dirtySlots.clear();
+    m_slotDirty.clear();
+    m_fullUpload = false;
+    m_chunkVersion++;
 }
 
-void GateRenderer::RenderGates(const std::vector<Gate>& gates, const Camera& camera) {
-    if (gates.empty() || !m_gateShader || !m_portShader) {
+void GateRenderer::SyncGates(Circuit& circuit, SignalStateBuffer& signals) {
+    if (m_syncedCircuit != &circuit) {
+        // 처음 보는 Circuit: 전체 구축 후 쌓여 있던 변경 기록은 버림
+        InvalidateGateCache();
+        m_syncedCircuit = &circuit;
+        m_instanceData.reserve(circuit.getGateCount());
+        m_gateOfSlot.reserve(circuit.getGateCount());
+        signals.Reserve(circuit.getGateIdLimit());
+        signals.Clear();
+        RebuildAllGates(circuit, signals);
+        circuit.takeChangedGates(m_changedGates);
+        m_stats.changedGates += m_instanceData.size();
+        m_fullUpload = true;
         return;
     }
     
-    auto visibleGates = FrustumCull(gates, camera);
-    
-    if (m_useInstancing && visibleGates.size() > 0) {  // 게이트가 하나라도 있으면 인스턴싱 사용
-        m_instanceData.clear();
-        m_instanceData.reserve(visibleGates.size());
-        
-        for (const auto& gate : visibleGates) {
-            GateInstance instance;
-            instance.position = glm::vec2(gate.position.x, gate.position.y);
-            instance.color = GetGateColor(gate);
-            instance.rotation = 0.0f;
-            instance.scale = 1.0f;
-            m_instanceData.push_back(instance);
-            
-            // 디버깅 로그 제거
+    circuit.takeChangedGates(m_changedGates);
+    for (GateId id : m_changedGates) {
+        if (const Gate* gate = circuit.getGate(id)) {
+            bool high = gate->currentOutput == SignalState::HIGH;
+            UpsertGate(*gate, high);
+            signals.Set(id, high);
+        } else {
+            RemoveGate(id);
+            signals.Set(id, false);
         }
-        
-        if (!m_instanceData.empty()) {
-            glBindBuffer(GL_ARRAY_BUFFER, m_vboInstance);
-            glBufferSubData(GL_ARRAY_BUFFER, 0, 
-                          sizeof(GateInstance) * m_instanceData.size(),
-                          m_instanceData.data());
-            
-            m_gateShader->Use();
-            m_gateShader->SetUniform("uProjection", camera.GetProjectionMatrix());
-            m_gateShader->SetUniform("uView", camera.GetViewMatrix());
-            m_gateShader->SetUniform("uGridSize", m_gateSize);
-            m_gateShader->SetUniform("uBorderColor", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // 밝은 흰색 테두리
-            m_gateShader->SetUniform("uBorderWidth", 5.0f);  // 더 두껍게
-            
-            glBindVertexArray(m_vaoGate);
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);  // 채우기
-            
-            glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0,
-                                  static_cast<GLsizei>(m_instanceData.size()));
-        }
-        
-        for (const auto& gate : visibleGates) {
-            RenderPorts(gate, camera.GetViewProjectionMatrix());
+    }
+    m_stats.changedGates += m_changedGates.size();
+}
+
+void GateRenderer::RebuildAllGates(const Circuit& circuit, SignalStateBuffer& signals) {
+    // 슬롯 번호는 순회 순서대로 정해지므로 게이트 목록을 먼저 모음
+    m_rebuildGates.clear();
+    m_rebuildGates.reserve(circuit.getGateCount());
+    for (auto it = circuit.gatesBegin(); it != circuit.gatesEnd(); ++it) {
+        m_rebuildGates.push_back(&it->second);
+    }
+    
+    // 인스턴스 패킹은 슬롯마다 독립이므로 블록 단위로 워커에 나눔
+    const size_t count = m_rebuildGates.size();
+    constexpr size_t GATES_PER_JOB = 4096;
+    m_instanceData.resize(count);
+    auto pack = [this, count](size_t block, unsigned) {
+        const size_t end = std::min(count, (block + 1) * GATES_PER_JOB);
+        for (size_t slot = block * GATES_PER_JOB; slot < end; ++slot) {
+            m_instanceData[slot] = MakeInstance(*m_rebuildGates[slot]);
         }
+    };
+    const size_t blocks = (count + GATES_PER_JOB - 1) / GATES_PER_JOB;
+    if (m_jobs) {
+        m_jobs->ParallelFor(blocks, pack);
     } else {
-        for (const auto& gate : visibleGates) {
-            RenderSingleGate(gate, camera.GetViewProjectionMatrix());
-            RenderPorts(gate, camera.GetViewProjectionMatrix());
+        for (size_t block = 0; block < blocks; ++block) {
+            pack(block, 0);
         }
     }
     
-    glBindVertexArray(0);
+    // 청크 소속과 신호 비트는 공유 컨테이너를 건드리므로 순차로 채움
+    m_gateOfSlot.resize(count);
+    m_indexInChunk.resize(count, 0);
+    m_slotHigh.resize(count, 0);
+    m_slotDirty.resize(count, 0);
+    if (circuit.getGateIdLimit() > m_slotOfGate.size()) {
+        m_slotOfGate.resize(circuit.getGateIdLimit(), INVALID_SLOT);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const Gate& gate = *m_rebuildGates[i];
+        const uint32_t slot = static_cast<uint32_t>(i);
+        const bool high = gate.currentOutput == SignalState::HIGH;
+        if (gate.id >= m_slotOfGate.size()) {
+            m_slotOfGate.resize(gate.id + 1, INVALID_SLOT);
+        }
+        m_slotOfGate[gate.id] = slot;
+        m_gateOfSlot[slot] = gate.id;
+        m_slotHigh[slot] = high ? 1 : 0;
+        AddToChunk(slot);
+        signals.Set(gate.id, high, false);
+    }
+    m_rebuildGates.clear();
 }
 
-void GateRenderer::EndFrame() {
+GateRenderer::GateInstance GateRenderer::MakeInstance(const Gate& gate) const {
+    GateInstance instance;
+    instance.position = glm::vec2(gate.position.x, gate.position.y);
+    instance.rotation = 0.0f;
+    instance.scale = 1.0f;
+    instance.net = static_cast<float>(gate.id);
+    instance.selected = gate.isSelected ? 1.0f : 0.0f;
+    instance.padding[0] = instance.padding[1] = 0.0f;
+    return instance;
 }
 
-void GateRenderer::RenderSingleGate(const Gate& gate, const glm::mat4& mvp) {
-    m_gateShader->Use();
-    
-    // 셀 중심에 배치
-    glm::vec3 cellCenter = glm::vec3((gate.position.x + 0.5f) * m_gateSize, (gate.position.y + 0.5f) * m_gateSize, 0.0f);
-    glm::mat4 model = glm::translate(glm::mat4(1.0f), cellCenter);
-    model = glm::scale(model, glm::vec3(m_gateSize));
+void GateRenderer::UpsertGate(const Gate& gate, bool high) {
+    if (gate.id >= m_slotOfGate.size()) {
+        m_slotOfGate.resize(std::max<size_t>(gate.id + 1, m_slotOfGate.size() * 2), INVALID_SLOT);
+    }
     
-    m_gateShader->SetUniform("uProjection", mvp);
-    m_gateShader->SetUniform("uView", glm::mat4(1.0f));
-    m_gateShader->SetUniform("uGridSize", 1.0f);
-    m_gateShader->SetUniform("uBorderColor", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // 흰색 테두리
-    m_gateShader->SetUniform("uBorderWidth", 5.0f);  // 더 두껍게
+    uint32_t slot = m_slotOfGate[gate.id];
+    GateInstance instance = MakeInstance(gate);
+    
+    if (slot == INVALID_SLOT) {
+        slot = static_cast<uint32_t>(m_instanceData.size());
+        m_slotOfGate[gate.id] = slot;
+        m_instanceData.push_back(instance);
+        m_gateOfSlot.push_back(gate.id);
+        m_indexInChunk.push_back(0);
+        m_slotHigh.push_back(high ? 1 : 0);
+        m_slotDirty.push_back(0);
+        AddToChunk(slot);
+    } else {
+        GateInstance& current = m_instanceData[slot];
+        if (std::memcmp(&current, &instance, sizeof(GateInstance)) == 0) {
+            // 출력만 바뀜: 신호 텍스처가 색을 바꾸므로 청크의 HIGH 수만 갱신
+            if (m_slotHigh[slot] != (high ? 1 : 0)) {
+                GateChunk& chunk = m_chunks[RenderChunkKey(ChunkOf(current.position))];
+                if (high) {
+                    chunk.highCount++;
+                } else {
+                    chunk.highCount--;
+                }
+                m_slotHigh[slot] = high ? 1 : 0;
+            }
+            return;
+        }
+        // 청크 집계(소속, HIGH 수)는 옛 값으로 빼고 새 값으로 다시 더함
+        RemoveFromChunk(slot);
+        current = instance;
+        m_slotHigh[slot] = high ? 1 : 0;
+        AddToChunk(slot);
+    }
     
-    glBindVertexArray(m_vaoGate);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    MarkSlotDirty(slot);
 }
 
-void GateRenderer::RenderPorts(const Gate& gate, const glm::mat4& mvp) {
-    m_portShader->Use();
-    m_portShader->SetUniform("uMVP", mvp);
-    
-    glBindVertexArray(m_vaoPort);
+void GateRenderer::RemoveGate(GateId id) {
+    if (id >= m_slotOfGate.size() || m_slotOfGate[id] == INVALID_SLOT) {
+        return;
+    }
     
-    // 셀 중심에 맞춰 조정
-    glm::vec2 gateCenter = (glm::vec2(gate.position.x, gate.position.y) + glm::vec2(0.5f, 0.5f)) * m_gateSize;
+    uint32_t slot = m_slotOfGate[id];
+    uint32_t last = static_cast<uint32_t>(m_instanceData.size() - 1);
+    m_slotOfGate[id] = INVALID_SLOT;
+    RemoveFromChunk(slot);
+    
+    // 마지막 슬롯을 빈자리로 옮겨 버퍼를 빈틈 없이 유지
+    if (slot != last) {
+        GateId moved = m_gateOfSlot[last];
+        m_instanceData[slot] = m_instanceData[last];
+        m_slotHigh[slot] = m_slotHigh[last];
+        m_gateOfSlot[slot] = moved;
+        m_slotOfGate[moved] = slot;
+        
+        GateChunk& chunk = m_chunks[RenderChunkKey(ChunkOf(m_instanceData[slot].position))];
+        m_indexInChunk[slot] = m_indexInChunk[last];
+        chunk.slots[m_indexInChunk[slot]] = slot;
+        MarkSlotDirty(slot);
+    }
     
-    // 입력 포트를 제거하고 출력 포트만 렌더링
-    // 출력 포트는 오른쪽에 1개
-    glm::vec2 outputOffset(0.35f, 0.0f);  // 게이트 경계에 가까이
-    glm::vec2 outputPos = gateCenter + outputOffset * m_gateSize;
-    m_portShader->SetUniform("uOffset", outputPos);
+    m_instanceData.pop_back();
+    m_gateOfSlot.pop_back();
+    m_indexInChunk.pop_back();
+    m_slotHigh.pop_back();
+    m_slotDirty.pop_back();
+}
+
+void GateRenderer::AddToChunk(uint32_t slot) {
+    const GateInstance& instance = m_instanceData[slot];
+    glm::ivec2 coord = ChunkOf(instance.position);
+    GateChunk& chunk = m_chunks[RenderChunkKey(coord)];
+    if (chunk.slots.empty()) {
+        chunk.coord = coord;
+    }
+    m_indexInChunk[slot] = static_cast<uint32_t>(chunk.slots.size());
+    chunk.slots.push_back(slot);
+    m_chunkVersion++;
+    if (m_slotHigh[slot]) {
+        chunk.highCount++;
+    }
+}
+
+void GateRenderer::RemoveFromChunk(uint32_t slot) {
+    const GateInstance& instance = m_instanceData[slot];
+    auto it = m_chunks.find(RenderChunkKey(ChunkOf(instance.position)));
+    if (it == m_chunks.end()) {
+        return;
+    }
     
-    // 출력 포트는 신호 상태에 따라 색상 변경 (빨간색/초록색)
-    if (gate.currentOutput == SignalState::HIGH) {
-        m_portShader->SetUniform("uColor", glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));  // 초록색
-    } else {
-        m_portShader->SetUniform("uColor", glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));  // 빨간색
+    GateChunk& chunk = it->second;
+    uint32_t index = m_indexInChunk[slot];
+    uint32_t back = chunk.slots.back();
+    chunk.slots[index] = back;
+    m_indexInChunk[back] = index;
+    chunk.slots.pop_back();
+    m_chunkVersion++;
+    if (m_slotHigh[slot]) {
+        chunk.highCount--;
     }
     
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 10);
+    if (chunk.slots.empty()) {
+        m_chunks.erase(it);
+    }
 }
 
-glm::vec4 GateRenderer::GetGateColor(const Gate& gate) const {
-    // 선택된 게이트는 노란색 하이라이트
-    if (gate.isSelected) {
-        SDL_Log("[GateRenderer] Rendering selected gate %u with yellow color", gate.id);
-        return glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);  // 노란색
+void GateRenderer::MarkSlotDirty(uint32_t slot) {
+    if (!m_slotDirty[slot]) {
+        m_slotDirty[slot] = 1;
+        m_dirtySlots.push_back(slot);
+    }
+}
+
+void GateRenderer::UploadDirtySlots(RenderCommandList& commands) {
+    if (m_instanceData.size() > m_maxInstances) {
+        // 용량 초과: 두 배로 키우고 전체를 다시 올림 (버퍼 텍스처는 같은 버퍼 객체를 계속 가리킴)
+        m_maxInstances = std::max(m_instanceData.size(), m_maxInstances * 2);
+        commands.ReallocateBuffer(m_vboInstance, sizeof(GateInstance) * m_maxInstances, nullptr, false);
+        m_fullUpload = true;
     }
     
-    // 출력 신호가 HIGH이면 빨간색
-    if (gate.currentOutput == SignalState::HIGH) {
-        return glm::vec4(1.0f, 0.2f, 0.2f, 1.0f);  // 빨간색
+    if (m_fullUpload) {
+        for (uint32_t slot : m_dirtySlots) {
+            if (slot < m_slotDirty.size()) m_slotDirty[slot] = 0;
+        }
+        m_dirtySlots.clear();
+        m_fullUpload = false;
+        if (!m_instanceData.empty()) {
+            commands.UpdateBuffer(m_vboInstance, 0, sizeof(GateInstance) * m_instanceData.size(),
+                                  m_instanceData.data());
+            m_stats.uploadedInstances += m_instanceData.size();
+            m_stats.uploadCalls++;
+        }
+        return;
     }
     
-    // 기본 상태 (LOW)는 진한 회색
-    return glm::vec4(0.4f, 0.4f, 0.4f, 1.0f);
+    if (m_dirtySlots.empty()) {
+        return;
+    }
+    
+    // 바뀐 슬롯을 정렬해 가까운 것끼리 한 번의 업로드로 묶음
+    constexpr uint32_t MERGE_GAP = 32;
+    constexpr size_t MAX_UPLOAD_CALLS = 64;
+    
+    std::sort(m_dirtySlots.begin(), m_dirtySlots.end());
+    
+    const uint32_t count = static_cast<uint32_t>(m_instanceData.size());
+    size_t calls = 0;
+    size_t i = 0;
+    while (i < m_dirtySlots.size()) {
+        uint32_t begin = m_dirtySlots[i];
+        uint32_t end = begin + 1;
+        while (i < m_dirtySlots.size() && m_dirtySlots[i] <= end + MERGE_GAP) {
+            if (m_dirtySlots[i] < m_slotDirty.size()) m_slotDirty[m_dirtySlots[i]] = 0;
+            end = std::max(end, m_dirtySlots[i] + 1);
+            ++i;
+        }
+        
+        // 호출이 너무 많아지면 남은 범위를 한 번에 올림
+        if (++calls == MAX_UPLOAD_CALLS && i < m_dirtySlots.size()) {
+            for (; i < m_dirtySlots.size(); ++i) {
+                if (m_dirtySlots[i] < m_slotDirty.size()) m_slotDirty[m_dirtySlots[i]] = 0;
+            }
+            end = m_dirtySlots.back() + 1;
+        }
+        
+        // 제거로 줄어든 뒤쪽 슬롯은 그리지 않으므로 올릴 필요 없음
+        end = std::min(end, count);
+        if (begin < end) {
+            commands.UpdateBuffer(m_vboInstance, sizeof(GateInstance) * begin,
+                                  sizeof(GateInstance) * (end - begin), &m_instanceData[begin]);
+            m_stats.uploadedInstances += end - begin;
+            m_stats.uploadCalls++;
+        }
+    }
+    m_dirtySlots.clear();
 }
 
-glm::vec4 GateRenderer::GetPortColor(bool hasSignal) const {
-    if (hasSignal) {
-        return glm::vec4(1.0f, 0.2f, 0.2f, 1.0f);  // 빨간색
+void GateRenderer::VisibleGateChunkRange(const Camera& camera, glm::ivec2& minChunk, glm::ivec2& maxChunk) const {
+    // 게이트 사각형과 포트가 셀 밖으로 조금 나가므로 한 칸 여유
+    VisibleChunkRange(camera.GetVisibleBounds(), m_gateSize, 1.0f, minChunk, maxChunk);
+}
+
+template<typename Fn>
+void GateRenderer::ForEachVisibleChunk(const Camera& camera, Fn&& fn) const {
+    glm::ivec2 minChunk, maxChunk;
+    VisibleGateChunkRange(camera, minChunk, maxChunk);
+    ForEachChunkInRange(minChunk, maxChunk, std::forward<Fn>(fn));
+}
+
+template<typename Fn>
+void GateRenderer::ForEachChunkInRange(const glm::ivec2& minChunk, const glm::ivec2& maxChunk, Fn&& fn) const {
+    const uint64_t rangeChunks = static_cast<uint64_t>(maxChunk.x - minChunk.x + 1) *
+                                 static_cast<uint64_t>(maxChunk.y - minChunk.y + 1);
+    
+    // 가시 범위가 실제 청크 수보다 작으면 좌표로 조회, 아니면 있는 청크만 순회
+    if (rangeChunks <= m_chunks.size()) {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                auto it = m_chunks.find(RenderChunkKey(glm::ivec2(cx, cy)));
+                if (it != m_chunks.end()) {
+                    fn(it->second);
+                }
+            }
+        }
+    } else {
+        for (const auto& [key, chunk] : m_chunks) {
+            if (chunk.coord.x >= minChunk.x && chunk.coord.x <= maxChunk.x &&
+                chunk.coord.y >= minChunk.y && chunk.coord.y <= maxChunk.y) {
+                fn(chunk);
+            }
+        }
     }
-    return glm::vec4(0.3f, 0.3f, 0.3f, 1.0f);  // 회색
 }
 
-std::vector<Gate> GateRenderer::FrustumCull(const std::vector<Gate>& gates, const Camera& camera) const {
-    std::vector<Gate> visible;
-    visible.reserve(gates.size());
+bool GateRenderer::CollectVisibleSlots(const Camera& camera) {
+    glm::ivec2 minChunk, maxChunk;
+    VisibleGateChunkRange(camera, minChunk, maxChunk);
+    
+    // 가시 청크 범위와 청크 구성이 그대로면 지난 목록을 그대로 씀
+    const bool unchanged = m_visibleUploaded && m_visibleVersion == m_chunkVersion &&
+                           minChunk == m_visibleMin && maxChunk == m_visibleMax;
+    if (!unchanged) {
+        m_visibleSlots.clear();
+        m_visibleChunkCount = 0;
+        ForEachChunkInRange(minChunk, maxChunk, [&](const GateChunk& chunk) {
+            m_visibleSlots.insert(m_visibleSlots.end(), chunk.slots.begin(), chunk.slots.end());
+            m_visibleChunkCount++;
+        });
+        m_visibleVersion = m_chunkVersion;
+        m_visibleMin = minChunk;
+        m_visibleMax = maxChunk;
+    }
+    
+    m_stats.visibleChunks = m_visibleChunkCount;
+    m_stats.visibleInstances = m_visibleSlots.size();
+    return !unchanged;
+}
+
+void GateRenderer::AppendLodTiles(const Camera& camera, std::vector<ChunkTile>& tiles) const {
+    constexpr float CELLS_PER_CHUNK = static_cast<float>(RENDER_CHUNK_SIZE * RENDER_CHUNK_SIZE);
+    
+    ForEachVisibleChunk(camera, [&](const GateChunk& chunk) {
+        ChunkTile tile;
+        tile.origin = glm::vec2(static_cast<float>(chunk.coord.x * RENDER_CHUNK_SIZE),
+                                static_cast<float>(chunk.coord.y * RENDER_CHUNK_SIZE));
+        tile.density = static_cast<float>(chunk.slots.size()) / CELLS_PER_CHUNK;
+        tile.activity = static_cast<float>(chunk.highCount) / static_cast<float>(chunk.slots.size());
+        tiles.push_back(tile);
+    });
+}
+
+void GateRenderer::RecordGates(const Camera& camera, const SignalStateBuffer& signals,
+                               RenderCommandList& commands) {
+    m_stats.instanceCount = m_instanceData.size();
+    if (m_instanceData.empty()) {
+        return;
+    }
     
-    glm::vec2 cameraPos = camera.GetPosition();
-    float viewDistance = camera.GetZoom() * 50.0f;
+    UploadDirtySlots(commands);
+    const bool visibleChanged = CollectVisibleSlots(camera);
+    if (m_visibleSlots.empty()) {
+        return;
+    }
     
-    for (const auto& gate : gates) {
-        float distance = glm::length(glm::vec2(gate.position.x, gate.position.y) - cameraPos);
-        if (distance < viewDistance) {
-            visible.push_back(gate);
+    // 가시 슬롯 목록은 바뀐 프레임에만 올림 (이전 내용은 버리고 다시 할당)
+    // 카메라가 청크 경계를 넘지 않고 게이트 추가/제거도 없으면 GPU 쪽 목록을 그대로 씀
+    if (visibleChanged) {
+        if (m_visibleSlots.size() > m_maxVisible) {
+            m_maxVisible = std::max(m_visibleSlots.size(), m_maxVisible * 2);
         }
+        commands.ReallocateBuffer(m_vboVisible, sizeof(uint32_t) * m_maxVisible, nullptr, true);
+        commands.UpdateBuffer(m_vboVisible, 0, sizeof(uint32_t) * m_visibleSlots.size(), m_visibleSlots.data());
+        m_visibleUploaded = true;
+        m_stats.visibleUploads++;
     }
     
-    return visible;
+    const uint32_t count = static_cast<uint32_t>(m_visibleSlots.size());
+    
+    commands.BindTexture(0, TextureTarget::Buffer, m_instanceTexture);
+    commands.BindTexture(1, TextureTarget::Buffer, signals.GetTexture());
+    commands.BindTexture(2, TextureTarget::Buffer, signals.GetToggleTexture());
+    
+    commands.UseShader(m_gateShader.get());
+    commands.SetUniform(U_INSTANCES, 0);
+    commands.SetUniform(U_SIGNALS, 1);
+    commands.SetUniform(U_TOGGLE_TIMES, 2);
+    commands.SetUniform(U_TIME, signals.GetTime());
+    commands.SetUniform(U_PROJECTION, camera.GetProjectionMatrix());
+    commands.SetUniform(U_VIEW, camera.GetViewMatrix());
+    commands.SetUniform(U_GRID_SIZE, m_gateSize);
+    commands.SetUniform(U_LOW_COLOR, glm::vec4(0.4f, 0.4f, 0.4f, 1.0f));       // 진한 회색 (LOW)
+    commands.SetUniform(U_HIGH_COLOR, glm::vec4(1.0f, 0.2f, 0.2f, 1.0f));      // 빨간색 (HIGH)
+    commands.SetUniform(U_SELECTED_COLOR, glm::vec4(1.0f, 1.0f, 0.0f, 1.0f));  // 노란색 (선택)
+    commands.SetUniform(U_USE_OVERRIDE_COLOR, 0);
+    commands.SetUniform(U_BORDER_COLOR, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));  // 밝은 흰색 테두리
+    commands.SetUniform(U_BORDER_WIDTH, 5.0f);  // 더 두껍게
+    commands.DrawIndexed(m_vaoGate, PrimitiveType::Triangles, 6, count);
+    m_stats.drawCalls++;
+    
+    if (m_drawPorts) {
+        commands.UseShader(m_portInstancedShader.get());
+        commands.SetUniform(U_INSTANCES, 0);
+        commands.SetUniform(U_SIGNALS, 1);
+        commands.SetUniform(U_MVP, camera.GetViewProjectionMatrix());
+        commands.SetUniform(U_GRID_SIZE, m_gateSize);
+        commands.SetUniform(U_PORT_OFFSET, glm::vec2(0.35f, 0.0f));  // 게이트 경계에 가까이
+        commands.Draw(m_vaoPortInstanced, PrimitiveType::TriangleFan, 0, 10, count);
+        m_stats.drawCalls++;
+    }
+    
+    commands.BindTexture(2, TextureTarget::Buffer, 0);
+    commands.BindTexture(1, TextureTarget::Buffer, 0);
+    commands.BindTexture(0, TextureTarget::Buffer, 0);
+}
+
+void GateRenderer::EndFrame() {
+}
+
+MemoryUsage GateRenderer::GetMemoryUsage() const {
+    MemoryUsage usage = MemoryStats::Measure(m_instanceData);
+    usage += MemoryStats::Measure(m_gateOfSlot);
+    usage += MemoryStats::Measure(m_slotOfGate);
+    usage += MemoryStats::Measure(m_indexInChunk);
+    usage += MemoryStats::Measure(m_slotHigh);
+    usage += MemoryStats::Measure(m_chunks);
+    for (const auto& [key, chunk] : m_chunks) {
+        usage += MemoryStats::Measure(chunk.slots);
+    }
+    usage += MemoryStats::Measure(m_dirtySlots);
+    usage += MemoryStats::Measure(m_slotDirty);
+    usage += MemoryStats::Measure(m_changedGates);
+    usage += MemoryStats::Measure(m_rebuildGates);
+    usage += MemoryStats::Measure(m_visibleSlots);
+    return usage;
+}
+
+glm::vec4 GateRenderer::GetPortColor(bool hasSignal) const {
+    if (hasSignal) {
+        return glm::vec4(1.0f, 0.2f, 0.2f, 1.0f);  // 빨간색
+    }
+    return glm::vec4(0.3f, 0.3f, 0.3f, 1.0f);  // 회색
 }
 
 void GateRenderer::RenderGatePreview(const glm::vec2& position, GateType type, bool isValid, const Camera& camera) {
@@ -395,27 +857,38 @@ void GateRenderer::RenderGatePreview(const glm::vec2& position, GateType type, b
     // Create instance data for preview
     GateInstance previewInstance;
     previewInstance.position = position;
-    previewInstance.color = previewColor;
     previewInstance.rotation = 0.0f;
     previewInstance.scale = 1.0f;
+    previewInstance.net = 0.0f;
+    previewInstance.selected = 0.0f;
+    previewInstance.padding[0] = previewInstance.padding[1] = 0.0f;
     
-    // Update instance buffer with preview data
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboInstance);
+    // 미리보기 전용 버퍼에 올림 (게이트 인스턴스 버퍼는 건드리지 않음)
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboPreview);
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GateInstance), &previewInstance);
     
-    // Use instanced rendering shader
-    m_gateShader->Use();
-    m_gateShader->SetUniform("uProjection", camera.GetProjectionMatrix());
-    m_gateShader->SetUniform("uView", camera.GetViewMatrix());
-    m_gateShader->SetUniform("uGridSize", m_gateSize);
-    m_gateShader->SetUniform("uBorderColor", glm::vec4(1.0f, 1.0f, 1.0f, 0.8f));  // White border
-    m_gateShader->SetUniform("uBorderWidth", 3.0f);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, m_previewTexture);
     
-    // Draw the preview gate (single instance)
-    glBindVertexArray(m_vaoGate);
-    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, 1);
+    m_gateShader->Use();
+    m_gateShader->SetUniform(U_INSTANCES, 0);
+    m_gateShader->SetUniform(U_SIGNALS, 1);  // 색은 uOverrideColor로 정하지만 샘플러 유닛이 겹치면 안 됨
+    m_gateShader->SetUniform(U_TOGGLE_TIMES, 2);
+    m_gateShader->SetUniform(U_PROJECTION, camera.GetProjectionMatrix());
+    m_gateShader->SetUniform(U_VIEW, camera.GetViewMatrix());
+    m_gateShader->SetUniform(U_GRID_SIZE, m_gateSize);
+    m_gateShader->SetUniform(U_BORDER_COLOR, glm::vec4(1.0f, 1.0f, 1.0f, 0.8f));  // White border
+    m_gateShader->SetUniform(U_BORDER_WIDTH, 3.0f);
+    m_gateShader->SetUniform(U_USE_OVERRIDE_COLOR, true);
+    m_gateShader->SetUniform(U_OVERRIDE_COLOR, previewColor);
+    
+    // Draw the preview gate (슬롯 속성은 배열 없이 상수 0)
+    GLState::BindVertexArray(m_vaoPreview);
+    glVertexAttribI4ui(2, 0, 0, 0, 0);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
     
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
     glDisable(GL_BLEND);
 }
 
@@ -444,31 +917,31 @@ void GateRenderer::RenderGateHighlight(const Gate& gate, const Camera& camera) {
     glGenVertexArrays(1, &outlineVAO);
     glGenBuffers(1, &outlineVBO);
     
-    glBindVertexArray(outlineVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, outlineVBO);
+    GLState::BindVertexArray(outlineVAO);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, outlineVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(outlineVertices), outlineVertices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
     m_portShader->Use();
-    m_portShader->SetUniform("uMVP", mvp);
-    m_portShader->SetUniform("uOffset", glm::vec2(0.0f, 0.0f));
+    m_portShader->SetUniform(U_MVP, mvp);
+    m_portShader->SetUniform(U_OFFSET, glm::vec2(0.0f, 0.0f));
     
     // Yellow highlight for selected gates
     if (gate.isSelected) {
-        m_portShader->SetUniform("uColor", glm::vec4(1.0f, 1.0f, 0.0f, 1.0f));
+        m_portShader->SetUniform(U_COLOR, glm::vec4(1.0f, 1.0f, 0.0f, 1.0f));
     }
     // Light blue for hovered gates  
     else if (gate.isHovered) {
-        m_portShader->SetUniform("uColor", glm::vec4(0.5f, 0.8f, 1.0f, 1.0f));
+        m_portShader->SetUniform(U_COLOR, glm::vec4(0.5f, 0.8f, 1.0f, 1.0f));
     }
     
     glDrawArrays(GL_LINE_LOOP, 0, 4);
     
-    glDeleteVertexArrays(1, &outlineVAO);
-    glDeleteBuffers(1, &outlineVBO);
+    GLState::DeleteVertexArray(outlineVAO);
+    GLState::DeleteBuffer(outlineVBO);
     glLineWidth(1.0f);
     
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
\ No newline at end of file
@@ -4,10 +4,29 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include "core/Gate.h"
+#include "core/Circuit.h"
+#include "render/RenderTypes.h"
+#include "render/RenderCommandList.h"
+#include "render/SignalStateBuffer.h"
 #include "render/ShaderProgram.h"
 #include "render/Camera.h"
 
+class JobSystem;
+
+// 프레임별 게이트 렌더링 통계 (헤드리스 측정용)
+struct GateRenderStats {
+    size_t instanceCount{0};        // GPU 버퍼에 있는 게이트 수
+    size_t visibleInstances{0};     // 컬링 후 그린 인스턴스 수
+    size_t visibleChunks{0};
+    size_t changedGates{0};         // 이번 프레임에 반영한 변경 수
+    size_t uploadedInstances{0};    // glBufferSubData로 올린 인스턴스 수
+    size_t uploadCalls{0};
+    size_t visibleUploads{0};       // 가시 슬롯 목록을 다시 올린 횟수 (가시 집합이 바뀐 프레임만)
+    size_t drawCalls{0};
+};
+
 class GateRenderer {
 public:
     GateRenderer();
@@ -17,61 +36,127 @@ public:
     void Cleanup();
     
     void BeginFrame();
-    void RenderGates(const std::vector<Gate>& gates, const Camera& camera);
+    // Circuit의 변경 기록만 인스턴스 버퍼에 반영 (처음 보는 Circuit이면 전체 구축)
+    // 출력 신호는 인스턴스가 아니라 signals의 넷 비트로 반영
+    void SyncGates(Circuit& circuit, SignalStateBuffer& signals);
+    // 다음 SyncGates에서 전체 재구축
+    void InvalidateGateCache();
+    // 가시 청크의 게이트만 기록 (보이는 슬롯 목록만 매 프레임 올림)
+    // 색은 셰이더가 신호 텍스처에서 넷 비트를 읽어 결정
+    void RecordGates(const Camera& camera, const SignalStateBuffer& signals, RenderCommandList& commands);
+    // 줌 아웃용: 가시 청크마다 게이트 밀도/HIGH 비율 타일 추가
+    void AppendLodTiles(const Camera& camera, std::vector<ChunkTile>& tiles) const;
     void RenderGatePreview(const glm::vec2& position, GateType type, bool isValid, const Camera& camera);
     void RenderGateHighlight(const Gate& gate, const Camera& camera);
     void EndFrame();
     
     void SetGateSize(float size) { m_gateSize = size; }
-    void EnableInstancing(bool enable) { m_useInstancing = enable; }
+    // 전체 재구축 시 인스턴스 패킹을 나눠 맡을 워커 풀 (nullptr이면 순차)
+    void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+    void SetDrawPorts(bool enabled) { m_drawPorts = enabled; }
     
     float GetGateSize() const { return m_gateSize; }
-    bool IsInstancingEnabled() const { return m_useInstancing; }
+    const GateRenderStats& GetStats() const { return m_stats; }
+    // 인스턴스 CPU 사본과 슬롯/청크 색인 (GPU 버퍼 제외)
+    MemoryUsage GetMemoryUsage() const;
     
 private:
+    // 인스턴스 버퍼 텍스처(RGBA32F)에서 슬롯당 텍셀 2개
+    // 신호는 담지 않으므로 출력이 바뀌어도 슬롯을 다시 올리지 않음
     struct GateInstance {
         glm::vec2 position;
-        glm::vec4 color;
         float rotation;
         float scale;
+        float net;          // 신호 텍스처의 넷 번호 (GateId, 2^24 미만이라 float로 정확)
+        float selected;     // 1 = 선택됨
         float padding[2];
     };
+    static constexpr int TEXELS_PER_INSTANCE = sizeof(GateInstance) / sizeof(glm::vec4);
     
-    struct PortData {
-        glm::vec2 offset;
-        glm::vec4 color;
-        bool isInput;
+    // 32x32 셀 청크에 속한 게이트 슬롯 (가시성 판정과 줌 아웃 집계 단위)
+    struct GateChunk {
+        glm::ivec2 coord;
+        std::vector<uint32_t> slots;
+        uint32_t highCount{0};
     };
     
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+    
     void SetupGeometry();
     void SetupShaders();
-    void UpdateInstanceBuffer(const std::vector<Gate>& gates);
-    void RenderBatch(const std::vector<GateInstance>& instances);
-    void RenderSingleGate(const Gate& gate, const glm::mat4& mvp);
-    void RenderPorts(const Gate& gate, const glm::mat4& mvp);
     
-    glm::vec4 GetGateColor(const Gate& gate) const;
+    GateInstance MakeInstance(const Gate& gate) const;
     glm::vec4 GetPortColor(bool hasSignal) const;
     
-    std::vector<Gate> FrustumCull(const std::vector<Gate>& gates, const Camera& camera) const;
+    static glm::ivec2 ChunkOf(const glm::vec2& position) {
+        return glm::ivec2(static_cast<int>(std::floor(position.x)) >> RENDER_CHUNK_SHIFT,
+                          static_cast<int>(std::floor(position.y)) >> RENDER_CHUNK_SHIFT);
+    }
+    
+    void UpsertGate(const Gate& gate, bool high);
+    void RebuildAllGates(const Circuit& circuit, SignalStateBuffer& signals);
+    void RemoveGate(GateId id);
+    void AddToChunk(uint32_t slot);
+    void RemoveFromChunk(uint32_t slot);
+    void MarkSlotDirty(uint32_t slot);
+    void UploadDirtySlots(RenderCommandList& commands);
+    // 가시 집합이 지난 프레임과 달라졌으면 다시 모으고 true
+    bool CollectVisibleSlots(const Camera& camera);
+    void VisibleGateChunkRange(const Camera& camera, glm::ivec2& minChunk, glm::ivec2& maxChunk) const;
+    
+    template<typename Fn>
+    void ForEachVisibleChunk(const Camera& camera, Fn&& fn) const;
+    template<typename Fn>
+    void ForEachChunkInRange(const glm::ivec2& minChunk, const glm::ivec2& maxChunk, Fn&& fn) const;
     
     GLuint m_vaoGate;
     GLuint m_vboGate;
     GLuint m_eboGate;
     GLuint m_vboInstance;
+    GLuint m_instanceTexture;       // m_vboInstance를 가리키는 버퍼 텍스처
+    GLuint m_vboVisible;            // 이번 프레임에 그릴 슬롯 번호 (인스턴스 속성)
     GLuint m_vaoPort;
     GLuint m_vboPort;
+    GLuint m_vaoPortInstanced;
+    GLuint m_vaoPreview;
+    GLuint m_vboPreview;
+    GLuint m_previewTexture;
     
     std::unique_ptr<ShaderProgram> m_gateShader;
     std::unique_ptr<ShaderProgram> m_portShader;
+    std::unique_ptr<ShaderProgram> m_portInstancedShader;
     
     float m_gateSize;
-    bool m_useInstancing;
-    size_t m_maxInstances;
+    bool m_drawPorts;
+    size_t m_maxInstances;          // GPU 인스턴스 버퍼 용량
+    size_t m_maxVisible;            // 가시 슬롯 버퍼 용량
     
+    // 인스턴스 버퍼의 CPU 사본: 슬롯은 빈틈 없이 채움 (제거 시 마지막 슬롯을 옮김)
     std::vector<GateInstance> m_instanceData;
-    std::vector<float> m_vertices;
-    std::vector<unsigned int> m_indices;
+    std::vector<GateId> m_gateOfSlot;
+    std::vector<uint32_t> m_slotOfGate;     // GateId -> 슬롯
+    std::vector<uint32_t> m_indexInChunk;   // 슬롯 -> GateChunk::slots 내 위치
+    std::vector<uint8_t> m_slotHigh;        // 슬롯 -> 출력 HIGH 여부 (청크 집계용, GPU에는 올리지 않음)
+    std::unordered_map<uint64_t, GateChunk> m_chunks;
+    
+    std::vector<uint32_t> m_dirtySlots;
+    std::vector<uint8_t> m_slotDirty;
+    bool m_fullUpload;
+    
+    const Circuit* m_syncedCircuit;
+    std::vector<GateId> m_changedGates;
+    std::vector<const Gate*> m_rebuildGates;
+    JobSystem* m_jobs;
+    // 가시 슬롯 목록과 그것을 모은 조건 (청크 범위, 청크 구성 버전)
+    uint64_t m_chunkVersion;                // 청크 소속이나 슬롯 번호가 바뀔 때마다 증가
+    uint64_t m_visibleVersion;
+    glm::ivec2 m_visibleMin;
+    glm::ivec2 m_visibleMax;
+    size_t m_visibleChunkCount;
+    bool m_visibleUploaded;                 // m_vboVisible에 m_visibleSlots가 올라가 있음
+    std::vector<uint32_t> m_visibleSlots;
+    
+    GateRenderStats m_stats;
     
     bool m_initialized;
-};
\ No newline at end of file
+};
@@ -1,11 +1,26 @@
 #include "GridRenderer.h"
 #include "Camera.h"
+#include "ShaderProgram.h"
+#include "RenderBackend.h"
+#include "GLState.h"
 #include <SDL.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
 #include <sstream>
 #include <climits>
 
+namespace {
+
+// 셰이더 유니폼 (이름 등록은 정적 초기화 때 한 번)
+const UniformId U_INV_VIEW_PROJ("uInvViewProj");
+const UniformId U_GRID_COLOR("uGridColor");
+const UniformId U_GRID_OPACITY("uGridOpacity");
+const UniformId U_PIXELS_PER_CELL("uPixelsPerCell");
+const UniformId U_GRID_BOUNDS("uGridBounds");
+const UniformId U_BOUNDED("uBounded");
+
+} // namespace
+
 const char* vertexShaderSource = R"(
 #version 330 core
 layout(location = 0) in vec2 aPosition;
@@ -40,7 +55,6 @@ GridRenderer::GridRenderer()
     , m_gridVBO(0)
     , m_highlightVAO(0)
     , m_highlightVBO(0)
-    , m_shaderProgram(0)
     , m_viewProjMatrixLoc(-1)
     , m_gridColorLoc(-1)
     , m_gridOpacityLoc(-1)
@@ -51,7 +65,6 @@ GridRenderer::GridRenderer()
     , m_hoveredCell(INT_MIN, INT_MIN)  // 특별한 값으로 "없음" 표시
     , m_screenWidth(800)
     , m_screenHeight(600)
-    , m_gridVertexCount(0)
     , m_highlightVertexCount(0) {
 }
 
@@ -68,6 +81,13 @@ bool GridRenderer::Initialize(int screenWidth, int screenHeight) {
         return false;
     }
     
+    // 그리드 선은 shaders/grid.frag에서 계산
+    m_gridShader = std::make_unique<ShaderProgram>();
+    if (!m_gridShader->Load("shaders/grid.vert", "shaders/grid.frag")) {
+        SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Failed to compile grid shader");
+        return false;
+    }
+    
     CreateGridMesh();
     CreateHighlightMesh();
     
@@ -82,25 +102,23 @@ bool GridRenderer::Initialize(int screenWidth, int screenHeight) {
 
 void GridRenderer::Shutdown() {
     if (m_gridVAO) {
-        glDeleteVertexArrays(1, &m_gridVAO);
+        GLState::DeleteVertexArray(m_gridVAO);
         m_gridVAO = 0;
     }
     if (m_gridVBO) {
-        glDeleteBuffers(1, &m_gridVBO);
+        GLState::DeleteBuffer(m_gridVBO);
         m_gridVBO = 0;
     }
     if (m_highlightVAO) {
-        glDeleteVertexArrays(1, &m_highlightVAO);
+        GLState::DeleteVertexArray(m_highlightVAO);
         m_highlightVAO = 0;
     }
     if (m_highlightVBO) {
-        glDeleteBuffers(1, &m_highlightVBO);
+        GLState::DeleteBuffer(m_highlightVBO);
         m_highlightVBO = 0;
     }
-    if (m_shaderProgram) {
-        glDeleteProgram(m_shaderProgram);
-        m_shaderProgram = 0;
-    }
+    m_highlightShader.reset();
+    m_gridShader.reset();
 }
 
 void GridRenderer::Render(const Camera& camera) {
@@ -114,34 +132,52 @@ void GridRenderer::Render(const Camera& camera) {
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
-    glUseProgram(m_shaderProgram);
-    
-    glm::mat4 viewProj = camera.GetViewProjectionMatrix();
-    glUniformMatrix4fv(m_viewProjMatrixLoc, 1, GL_FALSE, glm::value_ptr(viewProj));
-    
-    glUniform4f(m_gridColorLoc, 0.3f, 0.3f, 0.3f, 1.0f);
-    glUniform1f(m_gridOpacityLoc, m_gridOpacity);
-    
-    UpdateGridBuffer(camera);
-    RenderGrid();
+    m_commands.Clear();
+    RecordGrid(camera, m_commands);
+    GLRenderBackend().Submit(m_commands);
     
     if (m_hoveredCell.x >= 0 || !m_selectedCells.empty()) {
+        m_highlightShader->Use();
+        
+        glm::mat4 viewProj = camera.GetViewProjectionMatrix();
+        glUniformMatrix4fv(m_viewProjMatrixLoc, 1, GL_FALSE, glm::value_ptr(viewProj));
+        glUniform1f(m_gridOpacityLoc, m_gridOpacity);
+        
         UpdateHighlightBuffer();
         RenderHighlights();
     }
     
     // Restore OpenGL state
-    glUseProgram(currentProgram);
+    GLState::UseProgram(static_cast<GLuint>(currentProgram));
     
     // Keep blending enabled for ImGui
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
-void GridRenderer::RenderGrid() {
-    glBindVertexArray(m_gridVAO);
-    glDrawArrays(GL_LINES, 0, m_gridVertexCount);
-    glBindVertexArray(0);
+void GridRenderer::RecordGrid(const Camera& camera, RenderCommandList& commands) {
+    if (!m_isGridVisible) return;
+    
+    // 화면 전체 사각형 하나, CPU 정점 생성 없음 (그리드 좌표 = 월드 좌표, 셀 한 칸이 1.0)
+    commands.SetBlend(true);
+    commands.UseShader(m_gridShader.get());
+    commands.SetUniform(U_INV_VIEW_PROJ, camera.GetTransform().inverseViewProjection);
+    commands.SetUniform(U_GRID_COLOR, glm::vec4(0.3f, 0.3f, 0.3f, 1.0f));
+    commands.SetUniform(U_GRID_OPACITY, m_gridOpacity);
+    commands.SetUniform(U_PIXELS_PER_CELL, Camera::DEFAULT_CELL_SIZE * camera.GetZoom());
+    
+    if (!camera.IsGridUnlimited()) {
+        // 마지막 줄까지 그리도록 max + 1
+        glm::ivec2 minBounds = camera.GetMinGridBounds();
+        glm::ivec2 maxBounds = camera.GetMaxGridBounds();
+        commands.SetUniform(U_GRID_BOUNDS, glm::vec4(static_cast<float>(minBounds.x), static_cast<float>(minBounds.y),
+                                                     static_cast<float>(maxBounds.x + 1), static_cast<float>(maxBounds.y + 1)));
+        commands.SetUniform(U_BOUNDED, 1);
+    } else {
+        commands.SetUniform(U_BOUNDED, 0);
+    }
+    
+    commands.Draw(m_gridVAO, PrimitiveType::TriangleStrip, 0, 4);
 }
 
 void GridRenderer::RenderHighlights() {
@@ -152,9 +188,9 @@ void GridRenderer::RenderHighlights() {
     
     glUniform4f(m_gridColorLoc, 0.4f, 0.5f, 1.0f, 0.3f);
     
-    glBindVertexArray(m_highlightVAO);
+    GLState::BindVertexArray(m_highlightVAO);
     glDrawArrays(GL_TRIANGLES, 0, m_highlightVertexCount);
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
     
     glDisable(GL_BLEND);
 }
@@ -180,30 +216,33 @@ void GridRenderer::OnResize(int width, int height) {
 }
 
 void GridRenderer::CreateGridMesh() {
+    // 0~1 사각형 (grid.vert에서 클립 공간 -1~1로 변환)
+    const float quadVertices[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f
+    };
+    
     glGenVertexArrays(1, &m_gridVAO);
     glGenBuffers(1, &m_gridVBO);
     
-    glBindVertexArray(m_gridVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_gridVBO);
-    
-    size_t bufferSize = sizeof(float) * 3 * 10000;
-    glBufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_DYNAMIC_DRAW);
+    GLState::BindVertexArray(m_gridVAO);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_gridVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
     
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
 
 void GridRenderer::CreateHighlightMesh() {
     glGenVertexArrays(1, &m_highlightVAO);
     glGenBuffers(1, &m_highlightVBO);
     
-    glBindVertexArray(m_highlightVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_highlightVBO);
+    GLState::BindVertexArray(m_highlightVAO);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_highlightVBO);
     
     size_t bufferSize = sizeof(float) * 3 * 6 * 100;
     glBufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_DYNAMIC_DRAW);
@@ -214,100 +253,24 @@ void GridRenderer::CreateHighlightMesh() {
     glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)(2 * sizeof(float)));
     glEnableVertexAttribArray(1);
     
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
 
 bool GridRenderer::CompileShaders() {
-    GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    if (!vertexShader) return false;
-    
-    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-    if (!fragmentShader) {
-        glDeleteShader(vertexShader);
-        return false;
-    }
-    
-    if (!LinkShaderProgram(vertexShader, fragmentShader)) {
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
+    // ShaderProgram을 거쳐 셰이더 바이너리 캐시를 함께 사용
+    m_highlightShader = std::make_unique<ShaderProgram>();
+    if (!m_highlightShader->LoadFromSource(vertexShaderSource, fragmentShaderSource)) {
+        m_highlightShader.reset();
         return false;
     }
     
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-    
-    m_viewProjMatrixLoc = glGetUniformLocation(m_shaderProgram, "uViewProjMatrix");
-    m_gridColorLoc = glGetUniformLocation(m_shaderProgram, "uGridColor");
-    m_gridOpacityLoc = glGetUniformLocation(m_shaderProgram, "uGridOpacity");
+    m_viewProjMatrixLoc = m_highlightShader->GetUniformLocation("uViewProjMatrix");
+    m_gridColorLoc = m_highlightShader->GetUniformLocation("uGridColor");
+    m_gridOpacityLoc = m_highlightShader->GetUniformLocation("uGridOpacity");
     
     return true;
 }
 
-void GridRenderer::UpdateGridBuffer(const Camera& camera) {
-    std::vector<float> vertices;
-    vertices.reserve(10000);
-    
-    glm::vec4 bounds = camera.GetVisibleBounds();
-    
-    int startX = static_cast<int>(floor(bounds.x));
-    int endX = static_cast<int>(ceil(bounds.z));
-    int startY = static_cast<int>(floor(bounds.y));
-    int endY = static_cast<int>(ceil(bounds.w));
-    
-    // Apply grid bounds if not unlimited
-    if (!camera.IsGridUnlimited()) {
-        glm::ivec2 minBounds = camera.GetMinGridBounds();
-        glm::ivec2 maxBounds = camera.GetMaxGridBounds();
-        
-        // Apply bounds without logging
-        startX = std::max(startX, minBounds.x);
-        endX = std::min(endX, maxBounds.x + 1);  // +1 for drawing the last line
-        startY = std::max(startY, minBounds.y);
-        endY = std::min(endY, maxBounds.y + 1);  // +1 for drawing the last line
-    } else {
-        // Default limits for unlimited grid (can still be very large)
-        startX = std::max(startX, -1000);
-        endX = std::min(endX, 1000);
-        startY = std::max(startY, -1000);
-        endY = std::min(endY, 1000);
-    }
-    
-    // Draw vertical lines (그리드 좌표를 월드 좌표로 사용)
-    for (int x = startX; x <= endX; ++x) {
-        float intensity = (x % 10 == 0) ? 1.0f : 0.5f;
-        if (x == 0) intensity = 1.5f;
-        
-        // 그리드 좌표를 직접 사용 (셰이더에서 변환)
-        vertices.push_back(static_cast<float>(x));
-        vertices.push_back(static_cast<float>(startY));
-        vertices.push_back(intensity);
-        
-        vertices.push_back(static_cast<float>(x));
-        vertices.push_back(static_cast<float>(endY));
-        vertices.push_back(intensity);
-    }
-    
-    // Draw horizontal lines
-    for (int y = startY; y <= endY; ++y) {
-        float intensity = (y % 10 == 0) ? 1.0f : 0.5f;
-        if (y == 0) intensity = 1.5f;
-        
-        vertices.push_back(static_cast<float>(startX));
-        vertices.push_back(static_cast<float>(y));
-        vertices.push_back(intensity);
-        
-        vertices.push_back(static_cast<float>(endX));
-        vertices.push_back(static_cast<float>(y));
-        vertices.push_back(intensity);
-    }
-    
-    m_gridVertexCount = vertices.size() / 3;
-    
-    glBindBuffer(GL_ARRAY_BUFFER, m_gridVBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * vertices.size(), vertices.data());
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-}
-
 void GridRenderer::UpdateHighlightBuffer() {
     std::vector<float> vertices;
     vertices.reserve(600);
@@ -337,50 +300,10 @@ void GridRenderer::UpdateHighlightBuffer() {
     m_highlightVertexCount = vertices.size() / 3;
     
     if (m_highlightVertexCount > 0) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_highlightVBO);
+        GLState::BindBuffer(GL_ARRAY_BUFFER, m_highlightVBO);
         glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * vertices.size(), vertices.data());
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-    }
-}
-
-GLuint GridRenderer::CompileShader(GLenum type, const char* source) {
-    GLuint shader = glCreateShader(type);
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
-    
-    GLint success;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    
-    if (!success) {
-        char infoLog[512];
-        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-        SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Shader compilation failed: %s", infoLog);
-        glDeleteShader(shader);
-        return 0;
-    }
-    
-    return shader;
-}
-
-bool GridRenderer::LinkShaderProgram(GLuint vertexShader, GLuint fragmentShader) {
-    m_shaderProgram = glCreateProgram();
-    glAttachShader(m_shaderProgram, vertexShader);
-    glAttachShader(m_shaderProgram, fragmentShader);
-    glLinkProgram(m_shaderProgram);
-    
-    GLint success;
-    glGetProgramiv(m_shaderProgram, GL_LINK_STATUS, &success);
-    
-    if (!success) {
-        char infoLog[512];
-        glGetProgramInfoLog(m_shaderProgram, 512, nullptr, infoLog);
-        SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Shader linking failed: %s", infoLog);
-        glDeleteProgram(m_shaderProgram);
-        m_shaderProgram = 0;
-        return false;
+        GLState::BindBuffer(GL_ARRAY_BUFFER, 0);
     }
-    
-    return true;
 }
 
 void GridRenderer::CheckGLError(const char* operation) {
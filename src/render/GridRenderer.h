@@ -5,8 +5,10 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
+#include "render/RenderCommandList.h"
 
 class Camera;
+class ShaderProgram;
 
 class GridRenderer {
 public:
@@ -16,8 +18,10 @@ public:
     bool Initialize(int screenWidth, int screenHeight);
     void Shutdown();
     
+    // 그리드와 하이라이트를 바로 그림 (RenderManager 밖에서 쓰는 경로)
     void Render(const Camera& camera);
-    void RenderGrid();
+    // 그리드 사각형만 명령 목록에 기록
+    void RecordGrid(const Camera& camera, RenderCommandList& commands);
     void RenderHighlights();
     
     void SetGridVisible(bool visible) { m_isGridVisible = visible; }
@@ -38,17 +42,21 @@ public:
     float GetCellSize() const { return m_cellSize; }
     
 private:
+    // 그리드는 화면 전체 사각형 하나를 그리고 선은 shaders/grid.frag에서 계산
     GLuint m_gridVAO;
     GLuint m_gridVBO;
+    std::unique_ptr<ShaderProgram> m_gridShader;
     GLuint m_highlightVAO;
     GLuint m_highlightVBO;
-    GLuint m_shaderProgram;
+    std::unique_ptr<ShaderProgram> m_highlightShader;   // 하이라이트 사각형용
     
     GLint m_viewProjMatrixLoc;
     GLint m_gridColorLoc;
     GLint m_gridOpacityLoc;
     GLint m_cellSizeLoc;
     
+    RenderCommandList m_commands;
+    
     bool m_isGridVisible;
     float m_gridOpacity;
     float m_cellSize;
@@ -59,17 +67,13 @@ private:
     int m_screenWidth;
     int m_screenHeight;
     
-    size_t m_gridVertexCount;
     size_t m_highlightVertexCount;
     
     void CreateGridMesh();
     void CreateHighlightMesh();
     bool CompileShaders();
-    void UpdateGridBuffer(const Camera& camera);
     void UpdateHighlightBuffer();
     
-    GLuint CompileShader(GLenum type, const char* source);
-    bool LinkShaderProgram(GLuint vertexShader, GLuint fragmentShader);
     void CheckGLError(const char* operation);
 };
 
@@ -0,0 +1,123 @@
+#include "RenderBackend.h"
+#include "render/ShaderProgram.h"
+#include "render/GLState.h"
+#include <glad/glad.h>
+#include <type_traits>
+
+namespace {
+
+GLenum ToGL(PrimitiveType primitive) {
+    switch (primitive) {
+        case PrimitiveType::Triangles:     return GL_TRIANGLES;
+        case PrimitiveType::TriangleStrip: return GL_TRIANGLE_STRIP;
+        case PrimitiveType::TriangleFan:   return GL_TRIANGLE_FAN;
+        case PrimitiveType::Lines:         return GL_LINES;
+    }
+    return GL_TRIANGLES;
+}
+
+GLenum ToGL(TextureTarget target) {
+    return target == TextureTarget::Buffer ? GL_TEXTURE_BUFFER : GL_TEXTURE_2D;
+}
+
+} // namespace
+
+void GLRenderBackend::Submit(const RenderCommandList& commands) {
+    for (const RenderCommand& command : commands.GetCommands()) {
+        std::visit([&](const auto& cmd) {
+            using T = std::decay_t<decltype(cmd)>;
+
+            if constexpr (std::is_same_v<T, BufferUpdateCommand>) {
+                const void* data = cmd.payload == NO_PAYLOAD ? nullptr : commands.GetPayload(cmd.payload);
+                GLState::BindBuffer(GL_ARRAY_BUFFER, cmd.buffer);
+                if (cmd.reallocate) {
+                    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(cmd.size), data,
+                                 cmd.stream ? GL_STREAM_DRAW : GL_DYNAMIC_DRAW);
+                } else {
+                    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(cmd.offset),
+                                    static_cast<GLsizeiptr>(cmd.size), data);
+                }
+            } else if constexpr (std::is_same_v<T, TextureUpdateCommand>) {
+                glBindTexture(GL_TEXTURE_2D, cmd.texture);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, cmd.x, cmd.y, cmd.width, cmd.height,
+                                GL_RED_INTEGER, GL_UNSIGNED_INT, commands.GetPayload(cmd.payload));
+            } else if constexpr (std::is_same_v<T, UseShaderCommand>) {
+                if (cmd.shader) {
+                    cmd.shader->Use();
+                }
+            } else if constexpr (std::is_same_v<T, UniformCommand>) {
+                if (!cmd.shader) {
+                    return;
+                }
+                const void* value = commands.GetPayload(cmd.payload);
+                switch (cmd.type) {
+                    case UniformType::Int:
+                        cmd.shader->SetUniform(cmd.uniform, *static_cast<const int*>(value));
+                        break;
+                    case UniformType::Float:
+                        cmd.shader->SetUniform(cmd.uniform, *static_cast<const float*>(value));
+                        break;
+                    case UniformType::Vec2:
+                        cmd.shader->SetUniform(cmd.uniform, *static_cast<const glm::vec2*>(value));
+                        break;
+                    case UniformType::Vec4:
+                        cmd.shader->SetUniform(cmd.uniform, *static_cast<const glm::vec4*>(value));
+                        break;
+                    case UniformType::Mat4:
+                        cmd.shader->SetUniform(cmd.uniform, *static_cast<const glm::mat4*>(value));
+                        break;
+                }
+            } else if constexpr (std::is_same_v<T, BindTextureCommand>) {
+                glActiveTexture(GL_TEXTURE0 + cmd.unit);
+                glBindTexture(ToGL(cmd.target), cmd.texture);
+            } else if constexpr (std::is_same_v<T, StateCommand>) {
+                switch (cmd.state) {
+                    case RenderState::Blend:
+                        if (cmd.enable) {
+                            glEnable(GL_BLEND);
+                            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                        } else {
+                            glDisable(GL_BLEND);
+                        }
+                        break;
+                    case RenderState::LineSmooth:
+                        if (cmd.enable) {
+                            glEnable(GL_LINE_SMOOTH);
+                            glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
+                        } else {
+                            glDisable(GL_LINE_SMOOTH);
+                        }
+                        break;
+                    case RenderState::LineWidth:
+                        glLineWidth(cmd.value);
+                        break;
+                }
+            } else if constexpr (std::is_same_v<T, DrawCommand>) {
+                const GLenum mode = ToGL(cmd.primitive);
+                const GLsizei count = static_cast<GLsizei>(cmd.count);
+                GLState::BindVertexArray(cmd.vertexArray);
+                if (cmd.indexed) {
+                    const void* indices = reinterpret_cast<const void*>(static_cast<uintptr_t>(cmd.first) * sizeof(uint32_t));
+                    if (cmd.instances) {
+                        glDrawElementsInstanced(mode, count, GL_UNSIGNED_INT, indices,
+                                                static_cast<GLsizei>(cmd.instances));
+                    } else {
+                        glDrawElements(mode, count, GL_UNSIGNED_INT, indices);
+                    }
+                } else if (cmd.instances) {
+                    glDrawArraysInstanced(mode, static_cast<GLint>(cmd.first), count,
+                                          static_cast<GLsizei>(cmd.instances));
+                } else {
+                    glDrawArrays(mode, static_cast<GLint>(cmd.first), count);
+                }
+            }
+        }, command);
+    }
+
+    GLState::BindVertexArray(0);
+    m_totals += commands.GetStats();
+}
+
+void NullRenderBackend::Submit(const RenderCommandList& commands) {
+    m_totals += commands.GetStats();
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "render/RenderCommandList.h"
+
+// 기록된 명령 목록을 실행하는 쪽
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual void Submit(const RenderCommandList& commands) = 0;
+
+    // 지금까지 제출한 명령의 누적 통계
+    const RenderListStats& GetTotals() const { return m_totals; }
+    void ResetTotals() { m_totals = RenderListStats{}; }
+
+protected:
+    RenderListStats m_totals;
+};
+
+// OpenGL 3.3 실행
+class GLRenderBackend : public RenderBackend {
+public:
+    void Submit(const RenderCommandList& commands) override;
+};
+
+// GPU 없이 통계만 집계 (헤드리스 벤치마크용)
+class NullRenderBackend : public RenderBackend {
+public:
+    void Submit(const RenderCommandList& commands) override;
+};
@@ -0,0 +1,146 @@
+#include "RenderCommandList.h"
+#include <cstring>
+
+RenderListStats& RenderListStats::operator+=(const RenderListStats& other) {
+    commands += other.commands;
+    drawCalls += other.drawCalls;
+    instances += other.instances;
+    vertices += other.vertices;
+    uploadCalls += other.uploadCalls;
+    uploadBytes += other.uploadBytes;
+    bufferReallocations += other.bufferReallocations;
+    shaderChanges += other.shaderChanges;
+    uniformChanges += other.uniformChanges;
+    stateChanges += other.stateChanges;
+    return *this;
+}
+
+void RenderCommandList::Clear() {
+    // 용량은 유지해 다음 프레임에 재할당이 없도록 함
+    m_commands.clear();
+    m_payload.clear();
+    m_currentShader = nullptr;
+    m_stats = RenderListStats{};
+}
+
+size_t RenderCommandList::PushPayload(const void* data, size_t size) {
+    // 유니폼 행렬/벡터를 그대로 읽을 수 있도록 16바이트 정렬
+    size_t offset = (m_payload.size() + 15) & ~static_cast<size_t>(15);
+    m_payload.resize(offset + size);
+    std::memcpy(m_payload.data() + offset, data, size);
+    return offset;
+}
+
+void RenderCommandList::UpdateBuffer(uint32_t buffer, size_t offset, size_t size, const void* data) {
+    if (size == 0) {
+        return;
+    }
+    m_commands.push_back(BufferUpdateCommand{buffer, offset, size, PushPayload(data, size), false, false});
+    m_stats.commands++;
+    m_stats.uploadCalls++;
+    m_stats.uploadBytes += size;
+}
+
+void RenderCommandList::ReallocateBuffer(uint32_t buffer, size_t size, const void* data, bool stream) {
+    size_t payload = data ? PushPayload(data, size) : NO_PAYLOAD;
+    m_commands.push_back(BufferUpdateCommand{buffer, 0, size, payload, true, stream});
+    m_stats.commands++;
+    m_stats.bufferReallocations++;
+    if (data) {
+        m_stats.uploadCalls++;
+        m_stats.uploadBytes += size;
+    }
+}
+
+void RenderCommandList::UpdateTexture(uint32_t texture, int x, int y, int width, int height,
+                                      const uint32_t* data) {
+    size_t size = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(uint32_t);
+    m_commands.push_back(TextureUpdateCommand{texture, x, y, width, height, PushPayload(data, size)});
+    m_stats.commands++;
+    m_stats.uploadCalls++;
+    m_stats.uploadBytes += size;
+}
+
+void RenderCommandList::UseShader(ShaderProgram* shader) {
+    if (shader == m_currentShader && !m_commands.empty()) {
+        return;
+    }
+    m_currentShader = shader;
+    m_commands.push_back(UseShaderCommand{shader});
+    m_stats.commands++;
+    m_stats.shaderChanges++;
+}
+
+void RenderCommandList::PushUniform(UniformId uniform, UniformType type, const void* value, size_t size) {
+    m_commands.push_back(UniformCommand{m_currentShader, uniform, type, PushPayload(value, size)});
+    m_stats.commands++;
+    m_stats.uniformChanges++;
+}
+
+void RenderCommandList::SetUniform(UniformId uniform, int value) {
+    PushUniform(uniform, UniformType::Int, &value, sizeof(value));
+}
+
+void RenderCommandList::SetUniform(UniformId uniform, float value) {
+    PushUniform(uniform, UniformType::Float, &value, sizeof(value));
+}
+
+void RenderCommandList::SetUniform(UniformId uniform, const glm::vec2& value) {
+    PushUniform(uniform, UniformType::Vec2, &value, sizeof(value));
+}
+
+void RenderCommandList::SetUniform(UniformId uniform, const glm::vec4& value) {
+    PushUniform(uniform, UniformType::Vec4, &value, sizeof(value));
+}
+
+void RenderCommandList::SetUniform(UniformId uniform, const glm::mat4& value) {
+    PushUniform(uniform, UniformType::Mat4, &value, sizeof(value));
+}
+
+void RenderCommandList::BindTexture(uint32_t unit, TextureTarget target, uint32_t texture) {
+    m_commands.push_back(BindTextureCommand{unit, target, texture});
+    m_stats.commands++;
+    m_stats.stateChanges++;
+}
+
+void RenderCommandList::SetBlend(bool enable) {
+    m_commands.push_back(StateCommand{RenderState::Blend, enable, 0.0f});
+    m_stats.commands++;
+    m_stats.stateChanges++;
+}
+
+void RenderCommandList::SetLineSmooth(bool enable) {
+    m_commands.push_back(StateCommand{RenderState::LineSmooth, enable, 0.0f});
+    m_stats.commands++;
+    m_stats.stateChanges++;
+}
+
+void RenderCommandList::SetLineWidth(float width) {
+    m_commands.push_back(StateCommand{RenderState::LineWidth, true, width});
+    m_stats.commands++;
+    m_stats.stateChanges++;
+}
+
+void RenderCommandList::Draw(uint32_t vertexArray, PrimitiveType primitive, uint32_t first,
+                             uint32_t count, uint32_t instances) {
+    if (count == 0) {
+        return;
+    }
+    m_commands.push_back(DrawCommand{vertexArray, primitive, false, first, count, instances});
+    m_stats.commands++;
+    m_stats.drawCalls++;
+    m_stats.instances += instances;
+    m_stats.vertices += static_cast<size_t>(count) * (instances ? instances : 1);
+}
+
+void RenderCommandList::DrawIndexed(uint32_t vertexArray, PrimitiveType primitive, uint32_t count,
+                                    uint32_t instances) {
+    if (count == 0) {
+        return;
+    }
+    m_commands.push_back(DrawCommand{vertexArray, primitive, true, 0, count, instances});
+    m_stats.commands++;
+    m_stats.drawCalls++;
+    m_stats.instances += instances;
+    m_stats.vertices += static_cast<size_t>(count) * (instances ? instances : 1);
+}
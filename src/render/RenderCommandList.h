@@ -0,0 +1,137 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+#include <vector>
+#include "utils/MemoryStats.h"
+#include "render/UniformId.h"
+
+class ShaderProgram;
+
+// 렌더러가 프레임마다 기록하는 명령 (GL 호출 없이 CPU에서만 구성)
+// 실제 실행은 RenderBackend가 담당: GL 백엔드는 그대로 실행, 널 백엔드는 통계만 집계
+
+enum class UniformType : uint8_t { Int, Float, Vec2, Vec4, Mat4 };
+enum class PrimitiveType : uint8_t { Triangles, TriangleStrip, TriangleFan, Lines };
+enum class TextureTarget : uint8_t { Texture2D, Buffer };
+enum class RenderState : uint8_t { Blend, LineSmooth, LineWidth };
+
+// 페이로드가 없는 업로드 (버퍼 재할당만)
+constexpr size_t NO_PAYLOAD = static_cast<size_t>(-1);
+
+struct BufferUpdateCommand {
+    uint32_t buffer;
+    size_t offset;
+    size_t size;
+    size_t payload;         // NO_PAYLOAD면 데이터 없이 할당만
+    bool reallocate;        // true면 size 크기로 다시 할당 (offset 무시)
+    bool stream;            // 재할당 시 매 프레임 갱신 용도
+};
+
+// R32UI 2D 텍스처 부분 갱신
+struct TextureUpdateCommand {
+    uint32_t texture;
+    int x, y, width, height;
+    size_t payload;
+};
+
+struct UseShaderCommand {
+    ShaderProgram* shader;
+};
+
+struct UniformCommand {
+    ShaderProgram* shader;
+    UniformId uniform;      // 위치는 실행 시 셰이더가 ID로 바로 찾음
+    UniformType type;
+    size_t payload;
+};
+
+struct BindTextureCommand {
+    uint32_t unit;
+    TextureTarget target;
+    uint32_t texture;
+};
+
+struct StateCommand {
+    RenderState state;
+    bool enable;
+    float value;
+};
+
+struct DrawCommand {
+    uint32_t vertexArray;
+    PrimitiveType primitive;
+    bool indexed;           // 32비트 인덱스 버퍼 사용
+    uint32_t first;
+    uint32_t count;
+    uint32_t instances;     // 0이면 비인스턴스 호출
+};
+
+using RenderCommand = std::variant<BufferUpdateCommand, TextureUpdateCommand, UseShaderCommand,
+                                   UniformCommand, BindTextureCommand, StateCommand, DrawCommand>;
+
+// 기록 시점에 집계한 명령 통계 (백엔드와 무관)
+struct RenderListStats {
+    size_t commands{0};
+    size_t drawCalls{0};
+    size_t instances{0};
+    size_t vertices{0};             // 인스턴스를 곱한 정점 수
+    size_t uploadCalls{0};
+    size_t uploadBytes{0};
+    size_t bufferReallocations{0};
+    size_t shaderChanges{0};
+    size_t uniformChanges{0};
+    size_t stateChanges{0};
+
+    RenderListStats& operator+=(const RenderListStats& other);
+};
+
+class RenderCommandList {
+public:
+    void Clear();
+
+    // 업로드 데이터는 명령 목록 내부로 복사 (원본은 기록 직후 바뀌어도 됨)
+    void UpdateBuffer(uint32_t buffer, size_t offset, size_t size, const void* data);
+    void ReallocateBuffer(uint32_t buffer, size_t size, const void* data, bool stream);
+    void UpdateTexture(uint32_t texture, int x, int y, int width, int height, const uint32_t* data);
+
+    // 같은 셰이더가 연속이면 생략. 유니폼은 마지막으로 지정한 셰이더에 적용
+    void UseShader(ShaderProgram* shader);
+    void SetUniform(UniformId uniform, int value);
+    void SetUniform(UniformId uniform, float value);
+    void SetUniform(UniformId uniform, const glm::vec2& value);
+    void SetUniform(UniformId uniform, const glm::vec4& value);
+    void SetUniform(UniformId uniform, const glm::mat4& value);
+
+    void BindTexture(uint32_t unit, TextureTarget target, uint32_t texture);
+    void SetBlend(bool enable);
+    void SetLineSmooth(bool enable);
+    void SetLineWidth(float width);
+
+    void Draw(uint32_t vertexArray, PrimitiveType primitive, uint32_t first, uint32_t count,
+              uint32_t instances = 0);
+    void DrawIndexed(uint32_t vertexArray, PrimitiveType primitive, uint32_t count,
+                     uint32_t instances = 0);
+
+    const std::vector<RenderCommand>& GetCommands() const { return m_commands; }
+    const void* GetPayload(size_t offset) const { return m_payload.data() + offset; }
+    const RenderListStats& GetStats() const { return m_stats; }
+    bool IsEmpty() const { return m_commands.empty(); }
+    // 명령/페이로드 배열은 Clear 후에도 용량을 유지하므로 가장 큰 프레임 기준
+    MemoryUsage GetMemoryUsage() const {
+        MemoryUsage usage = MemoryStats::Measure(m_commands);
+        usage += MemoryStats::Measure(m_payload);
+        return usage;
+    }
+
+private:
+    size_t PushPayload(const void* data, size_t size);
+    void PushUniform(UniformId uniform, UniformType type, const void* value, size_t size);
+
+    std::vector<RenderCommand> m_commands;
+    std::vector<uint8_t> m_payload;
+    ShaderProgram* m_currentShader{nullptr};
+    RenderListStats m_stats;
+};
@@ -1,13 +1,18 @@
 #include "RenderManager.h"
 #include "render/Window.h"
 #include "render/RenderTypes.h"
+#include "render/GLState.h"
+#include "../utils/Profiler.h"
 #include <iostream>
 #include <SDL.h>
 
 RenderManager::RenderManager()
-    : m_showGrid(true)
+    : m_gridSize(1.0f)
+    , m_lodPixelsPerCell(6.0f)
+    , m_showGrid(true)
     , m_initialized(false)
-    , m_externalCamera(nullptr) {
+    , m_externalCamera(nullptr)
+    , m_startTime(std::chrono::steady_clock::now()) {
 }
 
 RenderManager::~RenderManager() {
@@ -46,6 +51,18 @@ bool RenderManager::Initialize(Window* window) {
         return false;
     }
     
+    m_tileRenderer = std::make_unique<ChunkTileRenderer>();
+    if (!m_tileRenderer->Initialize()) {
+        std::cerr << "Failed to initialize chunk tile renderer!" << std::endl;
+        return false;
+    }
+    
+    m_signals = std::make_unique<SignalStateBuffer>();
+    if (!m_signals->Initialize()) {
+        std::cerr << "Failed to initialize signal state buffer!" << std::endl;
+        return false;
+    }
+    
     window->GetSize(width, height);
     m_camera = std::make_unique<Camera>(width, height);
     m_camera->SetPosition(glm::vec2(0.0f, 0.0f));
@@ -55,11 +72,40 @@ bool RenderManager::Initialize(Window* window) {
     m_gridRenderer->SetGridColor(glm::vec4(0.2f, 0.2f, 0.2f, 1.0f));
     
     m_gateRenderer->SetGateSize(1.0f);
-    m_gateRenderer->EnableInstancing(true);
+    m_tileRenderer->SetCellSize(1.0f);
     
     m_wireRenderer->SetLineWidth(2.0f);
     m_wireRenderer->SetAntialiasing(true);
     
+    m_backend = std::make_unique<GLRenderBackend>();
+    CreateJobSystem();
+    
+    m_initialized = true;
+    return true;
+}
+
+bool RenderManager::InitializeHeadless(int width, int height) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    // 렌더러는 GPU 객체 없이 생성만 하고, 기록된 명령은 널 백엔드가 집계
+    m_gridRenderer = std::make_unique<GridRenderer>();
+    m_gateRenderer = std::make_unique<GateRenderer>();
+    m_wireRenderer = std::make_unique<WireRenderer>();
+    m_tileRenderer = std::make_unique<ChunkTileRenderer>();
+    m_signals = std::make_unique<SignalStateBuffer>();
+    
+    m_camera = std::make_unique<Camera>(width, height);
+    m_camera->SetPosition(glm::vec2(0.0f, 0.0f));
+    m_camera->SetZoom(1.0f);
+    
+    m_gateRenderer->SetGateSize(1.0f);
+    m_tileRenderer->SetCellSize(1.0f);
+    
+    m_backend = std::make_unique<NullRenderBackend>();
+    CreateJobSystem();
+    
     m_initialized = true;
     return true;
 }
@@ -69,23 +115,44 @@ void RenderManager::Shutdown() {
         return;
     }
     
+    m_backend.reset();
+    m_signals.reset();
+    m_tileRenderer.reset();
     m_wireRenderer.reset();
     m_gateRenderer.reset();
     m_gridRenderer.reset();
     m_renderer.reset();
+    m_jobs.reset();
     
     m_initialized = false;
 }
 
+void RenderManager::CreateJobSystem() {
+    m_jobs = std::make_unique<JobSystem>();
+    m_gateRenderer->SetJobSystem(m_jobs.get());
+    m_wireRenderer->SetJobSystem(m_jobs.get());
+}
+
 void RenderManager::BeginFrame() {
     if (!m_initialized) {
         return;
     }
     
-    m_renderer->BeginFrame();
-    m_renderer->Clear(0.1f, 0.1f, 0.15f, 1.0f);
+    if (m_renderer) {
+        m_renderer->BeginFrame();
+        m_renderer->Clear(0.1f, 0.1f, 0.15f, 1.0f);
+    }
+    
+    // 신호 펄스/토글 강조는 셰이더가 이 시각과 넷별 토글 시각의 차로 계산
+    float time = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_startTime).count();
+    m_signals->SetTime(time);
+    m_wireRenderer->SetTime(time);
     
     m_gateRenderer->BeginFrame();
+    m_commands.Clear();
+    m_frameStats = RenderListStats{};
+    // 프레임 사이에 ImGui 등이 바꾼 바인딩이 있을 수 있으므로 추적 캐시를 비움
+    GLState::BeginFrame();
 }
 
 void RenderManager::EndFrame() {
@@ -94,30 +161,40 @@ void RenderManager::EndFrame() {
     }
     
     m_gateRenderer->EndFrame();
-    m_renderer->EndFrame();
+    if (m_renderer) {
+        m_renderer->EndFrame();
+    }
 }
 
-void RenderManager::RenderCircuit(const Circuit& circuit) {
+void RenderManager::RenderCircuit(Circuit& circuit) {
     if (!m_initialized) {
         return;
     }
+    PROFILE_SCOPE("RenderManager::RenderCircuit");
     
     Camera& camera = m_externalCamera ? *m_externalCamera : *m_camera;
     
     if (m_showGrid) {
-        m_gridRenderer->Render(camera);
+        m_gridRenderer->RecordGrid(camera, m_commands);
     }
     
-    // Circuit의 게이트와 와이어를 수집
-    std::vector<Gate> gates;
-    std::vector<RenderWire> renderWires;
+    // 게이트는 바뀐 것만 인스턴스 버퍼에 반영 (복사 없음), 출력 신호는 넷 비트로
+    m_gateRenderer->SyncGates(circuit, *m_signals);
     
-    // 게이트 수집 - Copy the gates to preserve selection state
-    for (auto it = circuit.gatesBegin(); it != circuit.gatesEnd(); ++it) {
-        gates.push_back(it->second);  // This copies the gate including isSelected state
+    // 줌 아웃: 개별 게이트/와이어 대신 청크당 사각형 하나
+    if (IsLodActive()) {
+        m_lodTiles.clear();
+        m_gateRenderer->AppendLodTiles(camera, m_lodTiles);
+        m_tileRenderer->Record(m_lodTiles, glm::vec4(0.4f, 0.4f, 0.4f, 0.9f),
+                               glm::vec4(1.0f, 0.2f, 0.2f, 0.9f), camera, m_commands);
+        Flush();
+        return;
     }
     
-    // 게이트 수집 완료
+    // 이번 프레임에 바뀐 신호 비트만 올림 (게이트/와이어 색은 셰이더가 결정)
+    m_signals->Record(m_commands);
+    
+    std::vector<RenderWire> renderWires;
     
     // 와이어를 RenderWire로 변환
     for (auto it = circuit.wiresBegin(); it != circuit.wiresEnd(); ++it) {
@@ -160,6 +237,7 @@ void RenderManager::RenderCircuit(const Circuit& circuit) {
                     segment.start = glm::vec2(wire.pathPoints[i].x, wire.pathPoints[i].y);
                     segment.end = glm::vec2(wire.pathPoints[i + 1].x, wire.pathPoints[i + 1].y);
                     segment.hasSignal = (wire.signalState == SignalState::HIGH);
+                    segment.net = wire.fromGateId;
                     segment.fromGate = Constants::INVALID_GATE_ID;
                     segment.toGate = Constants::INVALID_GATE_ID;
                     segment.fromPort = Constants::INVALID_PORT;
@@ -175,6 +253,7 @@ void RenderManager::RenderCircuit(const Circuit& circuit) {
         }
         
         rw.hasSignal = (wire.signalState == SignalState::HIGH);
+        rw.net = wire.fromGateId;
         rw.fromGate = wire.fromGateId;
         rw.toGate = wire.toGateId;
         rw.fromPort = wire.fromPort;
@@ -182,77 +261,37 @@ void RenderManager::RenderCircuit(const Circuit& circuit) {
         renderWires.push_back(rw);
     }
     
-    m_wireRenderer->RenderWires(renderWires, camera);
-    m_gateRenderer->RenderGates(gates, camera);
+    m_wireRenderer->RecordWires(renderWires, camera, *m_signals, m_commands);
+    m_gateRenderer->RecordGates(camera, *m_signals, m_commands);
+    Flush();
 }
 
-void RenderManager::RenderCellWires(const std::unordered_map<uint64_t, CellWire>& cellWires) {
+void RenderManager::RenderCellWires(const CellWireManager& cellWires) {
     if (!m_initialized) {
         return;
     }
+    PROFILE_SCOPE("RenderManager::RenderCellWires");
     
     Camera& camera = m_externalCamera ? *m_externalCamera : *m_camera;
-    std::vector<RenderWire> renderWires;
-    
-    // CellWire를 RenderWire로 변환
-    for (const auto& [key, cellWire] : cellWires) {
-        if (!cellWire.exists) continue;
-        
-        Vec2 center = cellWire.getCenterPos();
-        glm::vec2 centerPos(center.x, center.y);
-        
-        // 각 연결 방향에 대해 선분 생성
-        if (cellWire.hasConnection(WireDirection::Up)) {
-            RenderWire segment;
-            segment.start = centerPos;
-            segment.end = glm::vec2(centerPos.x, centerPos.y - 0.5f);
-            segment.hasSignal = cellWire.hasSignal;
-            segment.fromGate = Constants::INVALID_GATE_ID;
-            segment.toGate = Constants::INVALID_GATE_ID;
-            renderWires.push_back(segment);
-        }
-        if (cellWire.hasConnection(WireDirection::Down)) {
-            RenderWire segment;
-            segment.start = centerPos;
-            segment.end = glm::vec2(centerPos.x, centerPos.y + 0.5f);
-            segment.hasSignal = cellWire.hasSignal;
-            segment.fromGate = Constants::INVALID_GATE_ID;
-            segment.toGate = Constants::INVALID_GATE_ID;
-            renderWires.push_back(segment);
-        }
-        if (cellWire.hasConnection(WireDirection::Left)) {
-            RenderWire segment;
-            segment.start = centerPos;
-            segment.end = glm::vec2(centerPos.x - 0.5f, centerPos.y);
-            segment.hasSignal = cellWire.hasSignal;
-            segment.fromGate = Constants::INVALID_GATE_ID;
-            segment.toGate = Constants::INVALID_GATE_ID;
-            renderWires.push_back(segment);
-        }
-        if (cellWire.hasConnection(WireDirection::Right)) {
-            RenderWire segment;
-            segment.start = centerPos;
-            segment.end = glm::vec2(centerPos.x + 0.5f, centerPos.y);
-            segment.hasSignal = cellWire.hasSignal;
-            segment.fromGate = Constants::INVALID_GATE_ID;
-            segment.toGate = Constants::INVALID_GATE_ID;
-            renderWires.push_back(segment);
-        }
-        
-        // 중앙 점도 작은 선분으로 표시 (점처럼 보이게)
-        if (cellWire.connections == WireDirection::None || true) {  // 항상 중앙 점 표시
-            RenderWire dot;
-            dot.start = centerPos;
-            dot.end = centerPos + glm::vec2(0.01f, 0.01f);  // 아주 작은 선분
-            dot.hasSignal = cellWire.hasSignal;
-            dot.fromGate = Constants::INVALID_GATE_ID;
-            dot.toGate = Constants::INVALID_GATE_ID;
-            renderWires.push_back(dot);
-        }
+    if (IsLodActive()) {
+        m_lodTiles.clear();
+        m_wireRenderer->AppendLodTiles(cellWires, camera, m_lodTiles);
+        m_tileRenderer->Record(m_lodTiles, glm::vec4(0.3f, 0.3f, 0.3f, 0.6f),
+                               glm::vec4(1.0f, 0.2f, 0.2f, 0.6f), camera, m_commands);
+    } else {
+        m_wireRenderer->RecordCellWires(cellWires, camera, m_commands);
     }
-    
-    // WireRenderer를 사용해 렌더링
-    m_wireRenderer->RenderWires(renderWires, camera);
+    Flush();
+}
+
+void RenderManager::Flush() {
+    if (m_commands.IsEmpty()) {
+        return;
+    }
+    PROFILE_SCOPE("RenderManager::Flush");
+    m_backend->Submit(m_commands);
+    m_frameStats += m_commands.GetStats();
+    m_commands.Clear();
 }
 
 void RenderManager::RenderDraggingWire(const glm::vec2& start, const glm::vec2& end) {
@@ -273,13 +312,51 @@ void RenderManager::RenderGatePreview(const glm::vec2& position, GateType type,
     m_gateRenderer->RenderGatePreview(position, type, isValid, camera);
 }
 
+void RenderManager::CollectMemoryUsage(MemoryReport& report) const {
+    if (!m_initialized) {
+        return;
+    }
+    
+    report.Add("Gate renderer", m_gateRenderer->GetMemoryUsage());
+    report.Add("Wire renderer", m_wireRenderer->GetMemoryUsage());
+    report.Add("Signal state buffer", m_signals->GetMemoryUsage());
+    
+    MemoryUsage commands = m_commands.GetMemoryUsage();
+    commands += MemoryStats::Measure(m_lodTiles);
+    report.Add("Render commands", commands);
+}
+
+bool RenderManager::IsLodActive() const {
+    const Camera& camera = GetCamera();
+    return camera.GetZoom() * Camera::DEFAULT_CELL_SIZE * m_gridSize < m_lodPixelsPerCell;
+}
+
+void RenderManager::SetSignalAnimation(bool enabled) {
+    if (!m_initialized) {
+        return;
+    }
+    m_signals->SetAnimate(enabled);
+    m_wireRenderer->SetSignalAnimation(enabled);
+}
+
+void RenderManager::SetDrawPorts(bool enabled) {
+    if (!m_initialized) {
+        return;
+    }
+    m_gateRenderer->SetDrawPorts(enabled);
+}
+
 void RenderManager::SetGridSize(float size) {
+    m_gridSize = size;
     if (m_gridRenderer) {
         m_gridRenderer->SetGridSize(size);
     }
     if (m_gateRenderer) {
         m_gateRenderer->SetGateSize(size);
     }
+    if (m_tileRenderer) {
+        m_tileRenderer->SetCellSize(size);
+    }
 }
 
 void RenderManager::SetGridColor(const glm::vec4& color) {
@@ -1,15 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <chrono>
 #include <vector>
 #include <unordered_map>
 #include "render/Renderer.h"
 #include "render/GridRenderer.h"
 #include "render/GateRenderer.h"
 #include "render/WireRenderer.h"
+#include "render/ChunkTileRenderer.h"
+#include "render/SignalStateBuffer.h"
+#include "render/RenderCommandList.h"
+#include "render/RenderBackend.h"
 #include "render/Camera.h"
 #include "core/Circuit.h"
 #include "core/CellWire.h"
+#include "core/CellWireManager.h"
+#include "utils/JobSystem.h"
 
 class Window;
 
@@ -19,19 +26,28 @@ public:
     ~RenderManager();
     
     bool Initialize(Window* window);
+    // GL 없이 명령 기록만 (널 백엔드). 벤치마크/테스트용
+    bool InitializeHeadless(int width, int height);
     void Shutdown();
     
     void BeginFrame();
     void EndFrame();
     
-    void RenderCircuit(const Circuit& circuit);
-    void RenderCellWires(const std::unordered_map<uint64_t, CellWire>& cellWires);
+    // 게이트는 Circuit의 변경 기록을 소비해 GPU 인스턴스 버퍼에 반영
+    void RenderCircuit(Circuit& circuit);
+    void RenderCellWires(const CellWireManager& cellWires);
     void RenderDraggingWire(const glm::vec2& start, const glm::vec2& end);
     void RenderGatePreview(const glm::vec2& position, GateType type, bool isValid);
     
     void SetGridSize(float size);
     void SetGridColor(const glm::vec4& color);
     void SetShowGrid(bool show) { m_showGrid = show; }
+    // 셀 한 칸이 이 픽셀 수보다 작게 보이면 게이트/와이어 대신 청크 집계 타일을 그림
+    void SetLodThreshold(float pixelsPerCell) { m_lodPixelsPerCell = pixelsPerCell; }
+    bool IsLodActive() const;
+    // 적응형 품질 조절용 (신호 펄스/토글 강조, 게이트 포트)
+    void SetSignalAnimation(bool enabled);
+    void SetDrawPorts(bool enabled);
     
     Camera& GetCamera() { return m_externalCamera ? *m_externalCamera : *m_camera; }
     const Camera& GetCamera() const { return m_externalCamera ? *m_externalCamera : *m_camera; }
@@ -42,15 +58,36 @@ public:
     GateRenderer& GetGateRenderer() { return *m_gateRenderer; }
     WireRenderer& GetWireRenderer() { return *m_wireRenderer; }
     
+    // 이번 프레임에 제출한 명령 통계 (BeginFrame에서 초기화)
+    const RenderListStats& GetFrameStats() const { return m_frameStats; }
+    // 렌더러별 CPU 쪽 힙 사용량을 report에 추가
+    void CollectMemoryUsage(MemoryReport& report) const;
+    
 private:
+    // 기록한 명령을 백엔드로 실행 (즉시 그리는 오버레이보다 먼저 그려지도록 패스마다 호출)
+    void Flush();
+    // 렌더 데이터 준비(청크 메시, 인스턴스 패킹)를 나눌 워커 풀을 만들어 렌더러에 연결
+    void CreateJobSystem();
+    
     std::unique_ptr<Renderer> m_renderer;
     std::unique_ptr<GridRenderer> m_gridRenderer;
     std::unique_ptr<GateRenderer> m_gateRenderer;
     std::unique_ptr<WireRenderer> m_wireRenderer;
+    std::unique_ptr<ChunkTileRenderer> m_tileRenderer;
+    std::unique_ptr<SignalStateBuffer> m_signals;   // 넷(게이트 출력)별 신호 비트, 게이트/와이어 셰이더가 공유
+    std::vector<ChunkTile> m_lodTiles;
+    std::unique_ptr<JobSystem> m_jobs;              // CPU 쪽 준비만 병렬, GL 호출은 이 스레드의 Flush에서만
+    
+    RenderCommandList m_commands;
+    std::unique_ptr<RenderBackend> m_backend;
+    RenderListStats m_frameStats;
     
     std::unique_ptr<Camera> m_camera;
     Camera* m_externalCamera;
     
+    float m_gridSize;
+    float m_lodPixelsPerCell;
+    std::chrono::steady_clock::time_point m_startTime;     // 애니메이션 시각 기준
     bool m_showGrid;
     bool m_initialized;
 };
\ No newline at end of file
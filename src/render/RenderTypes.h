@@ -1,6 +1,8 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
 
 // 렌더링을 위한 임시 Wire 구조체
 struct RenderWire {
@@ -11,7 +13,33 @@ struct RenderWire {
     int fromPort;
     int toGate;
     int toPort;
+    uint32_t net;       // 색을 정하는 신호 텍스처의 넷 번호 (구동 게이트 ID, 없으면 0)
     
     RenderWire() : start(0.0f), end(0.0f), hasSignal(false), 
-                   fromGate(-1), fromPort(-1), toGate(-1), toPort(-1) {}
-};
\ No newline at end of file
+                   fromGate(-1), fromPort(-1), toGate(-1), toPort(-1), net(0) {}
+};
+
+// 렌더러 공통 청크 크기 (GridMap/CellWireManager와 같은 32x32 셀)
+constexpr int RENDER_CHUNK_SHIFT = 5;
+constexpr int RENDER_CHUNK_SIZE = 1 << RENDER_CHUNK_SHIFT;
+
+inline uint64_t RenderChunkKey(const glm::ivec2& chunkCoord) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunkCoord.x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(chunkCoord.y));
+}
+
+// 월드 좌표 가시 영역 (minX, minY, maxX, maxY)과 겹치는 청크 범위, marginCells만큼 넓혀서 계산
+inline void VisibleChunkRange(const glm::vec4& bounds, float cellSize, float marginCells,
+                              glm::ivec2& minChunk, glm::ivec2& maxChunk) {
+    minChunk.x = static_cast<int>(std::floor(bounds.x / cellSize - marginCells)) >> RENDER_CHUNK_SHIFT;
+    minChunk.y = static_cast<int>(std::floor(bounds.y / cellSize - marginCells)) >> RENDER_CHUNK_SHIFT;
+    maxChunk.x = static_cast<int>(std::floor(bounds.z / cellSize + marginCells)) >> RENDER_CHUNK_SHIFT;
+    maxChunk.y = static_cast<int>(std::floor(bounds.w / cellSize + marginCells)) >> RENDER_CHUNK_SHIFT;
+}
+
+// 줌 아웃 시 청크 하나를 대신 그리는 집계 타일
+struct ChunkTile {
+    glm::vec2 origin;   // 청크 왼쪽 위 셀 좌표
+    float density;      // 차지한 셀 비율 (0~1)
+    float activity;     // HIGH 비율 (0~1)
+};
@@ -0,0 +1,290 @@
+#include "ShaderCache.h"
+#include "../utils/Logger.h"
+#include <SDL.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// GL 4.1 / ARB_get_program_binary (GL 3.3 glad 헤더에는 없음)
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+namespace {
+
+typedef void (APIENTRYP GetProgramBinaryProc)(GLuint program, GLsizei bufSize, GLsizei* length,
+                                              GLenum* binaryFormat, void* binary);
+typedef void (APIENTRYP ProgramBinaryProc)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+typedef void (APIENTRYP ProgramParameteriProc)(GLuint program, GLenum pname, GLint value);
+
+constexpr uint32_t FILE_MAGIC = 0x4353474E;     // "NGSC"
+constexpr uint32_t FILE_VERSION = 1;
+// ShaderProgram::LinkProgram의 attribute/출력 바인딩이 바뀌면 올려서 이전 바이너리를 무효화
+constexpr uint32_t LINK_LAYOUT_VERSION = 1;
+constexpr uint32_t MAX_BINARY_BYTES = 64u << 20;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;           // 파일 이름과 같은 키 (손상/이름 충돌 확인용)
+    uint32_t format;        // glGetProgramBinary가 돌려준 형식
+    uint32_t length;
+};
+
+struct CacheState {
+    bool initialized = false;
+    bool available = false;
+    bool enabled = true;
+    std::string directory;          // 비어 있으면 처음 쓸 때 기본 위치로 정함
+    std::string driverOverride;
+    uint64_t driverHash = 0;
+
+    GetProgramBinaryProc getProgramBinary = nullptr;
+    ProgramBinaryProc programBinary = nullptr;
+    ProgramParameteriProc programParameteri = nullptr;
+
+    ShaderCache::Stats stats;
+};
+
+CacheState& GetState() {
+    static CacheState state;
+    return state;
+}
+
+// FNV-1a 64
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+uint64_t HashString(uint64_t hash, const std::string& text) {
+    // 길이도 섞어서 "ab"+"c"와 "a"+"bc"가 같은 키가 되지 않게 함
+    uint64_t length = text.size();
+    hash = HashBytes(hash, &length, sizeof(length));
+    return HashBytes(hash, text.data(), text.size());
+}
+
+std::string GetGLString(GLenum name) {
+    const GLubyte* value = glGetString(name);
+    return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+// 작업 디렉터리는 실행 방법마다 달라서 쓰지 않음: 사용자별 쓰기 가능한 경로, 없으면 실행 파일 옆
+const std::string& ResolveDirectory(CacheState& state) {
+    if (!state.directory.empty()) {
+        return state.directory;
+    }
+
+    char* base = SDL_GetPrefPath("NotGate", "NotGateGame");
+    if (!base) {
+        base = SDL_GetBasePath();
+    }
+    if (base) {
+        state.directory = (fs::path(base) / "shader_cache").string();
+        SDL_free(base);
+    } else {
+        state.directory = "shader_cache";
+    }
+    return state.directory;
+}
+
+void UpdateDriverHash(CacheState& state) {
+    std::string driver = state.driverOverride;
+    if (driver.empty()) {
+        driver = GetGLString(GL_VENDOR) + "|" + GetGLString(GL_RENDERER) + "|" + GetGLString(GL_VERSION);
+    }
+    state.driverHash = HashString(0xCBF29CE484222325ull, driver);
+    state.driverHash = HashBytes(state.driverHash, &LINK_LAYOUT_VERSION, sizeof(LINK_LAYOUT_VERSION));
+}
+
+bool EnsureInitialized(CacheState& state) {
+    if (state.initialized) {
+        return state.available && state.enabled;
+    }
+    state.initialized = true;
+
+    state.getProgramBinary = reinterpret_cast<GetProgramBinaryProc>(SDL_GL_GetProcAddress("glGetProgramBinary"));
+    state.programBinary = reinterpret_cast<ProgramBinaryProc>(SDL_GL_GetProcAddress("glProgramBinary"));
+    state.programParameteri = reinterpret_cast<ProgramParameteriProc>(SDL_GL_GetProcAddress("glProgramParameteri"));
+
+    GLint formatCount = 0;
+    if (state.getProgramBinary && state.programBinary) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        // 확장이 없는 드라이버는 GL_INVALID_ENUM을 남기므로 비워 둠
+        while (glGetError() != GL_NO_ERROR) {}
+    }
+    if (formatCount <= 0) {
+        Logger::Info("Shader binary cache unavailable (driver exposes no program binary formats)");
+        return false;
+    }
+
+    UpdateDriverHash(state);
+    state.available = true;
+    return state.enabled;
+}
+
+uint64_t MakeKey(const CacheState& state, const std::string& vertexSource, const std::string& fragmentSource) {
+    uint64_t hash = HashString(state.driverHash, vertexSource);
+    return HashString(hash, fragmentSource);
+}
+
+std::string PathForKey(CacheState& state, uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return (fs::path(ResolveDirectory(state)) / name).string();
+}
+
+} // namespace
+
+void ShaderCache::SetDirectory(const std::string& directory) {
+    GetState().directory = directory;
+}
+
+std::string ShaderCache::GetDirectory() {
+    return ResolveDirectory(GetState());
+}
+
+void ShaderCache::SetDriverOverride(const std::string& driver) {
+    CacheState& state = GetState();
+    state.driverOverride = driver;
+    if (state.available) {
+        UpdateDriverHash(state);
+    }
+}
+
+void ShaderCache::SetEnabled(bool enabled) {
+    GetState().enabled = enabled;
+}
+
+bool ShaderCache::IsAvailable() {
+    CacheState& state = GetState();
+    EnsureInitialized(state);
+    return state.available;
+}
+
+GLuint ShaderCache::LoadProgram(const std::string& vertexSource, const std::string& fragmentSource) {
+    CacheState& state = GetState();
+    if (!EnsureInitialized(state)) {
+        return 0;
+    }
+
+    uint64_t key = MakeKey(state, vertexSource, fragmentSource);
+    std::string path = PathForKey(state, key);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        ++state.stats.misses;
+        return 0;
+    }
+
+    FileHeader header{};
+    std::vector<char> binary;
+    bool valid = static_cast<bool>(file.read(reinterpret_cast<char*>(&header), sizeof(header))) &&
+                 header.magic == FILE_MAGIC && header.version == FILE_VERSION &&
+                 header.key == key && header.length > 0 && header.length <= MAX_BINARY_BYTES;
+    if (valid) {
+        binary.resize(header.length);
+        valid = static_cast<bool>(file.read(binary.data(), binary.size()));
+    }
+    file.close();
+
+    GLuint program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        state.programBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            // 형식을 모르면 GL_INVALID_ENUM이 남음
+            while (glGetError() != GL_NO_ERROR) {}
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (!program) {
+        std::error_code error;
+        fs::remove(path, error);
+        ++state.stats.rejected;
+        ++state.stats.misses;
+        Logger::Debug("Shader binary cache entry rejected: " + path);
+        return 0;
+    }
+
+    ++state.stats.hits;
+    return program;
+}
+
+void ShaderCache::PrepareForLink(GLuint program) {
+    CacheState& state = GetState();
+    if (EnsureInitialized(state) && state.programParameteri) {
+        state.programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+void ShaderCache::StoreProgram(GLuint program, const std::string& vertexSource, const std::string& fragmentSource) {
+    CacheState& state = GetState();
+    if (!program || !EnsureInitialized(state)) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0 || static_cast<uint32_t>(length) > MAX_BINARY_BYTES) {
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLsizei written = 0;
+    GLenum format = 0;
+    state.getProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return;
+    }
+
+    uint64_t key = MakeKey(state, vertexSource, fragmentSource);
+    std::string path = PathForKey(state, key);
+    std::string tempPath = path + ".tmp";
+
+    std::error_code error;
+    fs::create_directories(ResolveDirectory(state), error);
+
+    FileHeader header{FILE_MAGIC, FILE_VERSION, key, format, static_cast<uint32_t>(written)};
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open() ||
+            !file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+            !file.write(binary.data(), written)) {
+            Logger::Warning("Failed to write shader binary cache entry: " + tempPath);
+            file.close();
+            fs::remove(tempPath, error);
+            return;
+        }
+    }
+
+    // 다른 인스턴스가 동시에 읽어도 반쯤 쓴 파일을 보지 않도록 이름 변경으로 교체
+    fs::rename(tempPath, path, error);
+    if (error) {
+        fs::remove(tempPath, error);
+        return;
+    }
+    ++state.stats.stores;
+}
+
+ShaderCache::Stats ShaderCache::GetStats() {
+    return GetState().stats;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+// 링크된 셰이더 프로그램 바이너리 디스크 캐시 (glGetProgramBinary / glProgramBinary)
+// - 키: 정점/프래그먼트 소스 + 드라이버 문자열(GL_VENDOR/RENDERER/VERSION)의 64비트 해시
+//   → 소스를 고치거나 드라이버가 바뀌면 자연히 다른 키가 되어 다시 컴파일
+// - 파일: <디렉터리>/<키 16진수>.bin = 헤더 + 드라이버가 준 바이너리
+//   디렉터리를 정하지 않으면 SDL_GetPrefPath 아래 shader_cache (안 되면 실행 파일 옆)
+// - 드라이버가 바이너리를 거부하면 파일을 지우고 호출자가 평소처럼 컴파일
+// - glad가 GL 3.3용이라 함수는 처음 쓸 때 SDL_GL_GetProcAddress로 찾고,
+//   ARB_get_program_binary가 없거나 지원 형식이 0개면 캐시 없이 동작
+// - GL 컨텍스트가 있는 스레드에서만 호출
+class ShaderCache {
+public:
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t stores = 0;
+        uint32_t rejected = 0;      // 드라이버가 거부해 지운 항목
+    };
+
+    // 빈 문자열이면 기본 위치로 되돌림
+    static void SetDirectory(const std::string& directory);
+    static std::string GetDirectory();
+    // 테스트용: GL_VENDOR/RENDERER/VERSION 대신 키에 섞을 드라이버 문자열 (빈 문자열이면 원래대로)
+    static void SetDriverOverride(const std::string& driver);
+    static void SetEnabled(bool enabled);
+    static bool IsAvailable();
+
+    // 캐시에 있으면 링크까지 끝난 프로그램을 돌려줌 (없으면 0)
+    static GLuint LoadProgram(const std::string& vertexSource, const std::string& fragmentSource);
+    // glLinkProgram 직전에 호출 (링크 후 바이너리를 꺼낼 것임을 드라이버에 알림)
+    static void PrepareForLink(GLuint program);
+    // 링크에 성공한 프로그램을 저장
+    static void StoreProgram(GLuint program, const std::string& vertexSource, const std::string& fragmentSource);
+
+    static Stats GetStats();
+};
@@ -1,8 +1,5 @@
 #include "ShaderManager.h"
-#include <iostream>
-#include <filesystem>
-
-namespace fs = std::filesystem;
+#include "../utils/Logger.h"
 
 ShaderManager::ShaderManager() 
     : m_hotReloadEnabled(false), m_shaderDirectory("shaders/") {
@@ -10,6 +7,7 @@ ShaderManager::ShaderManager()
 }
 
 ShaderManager::~ShaderManager() {
+    m_watcher.Stop();
     Clear();
 }
 
@@ -34,7 +32,7 @@ bool ShaderManager::LoadAllShaders() {
                          m_shaderDirectory + "ui.frag");
     
     if (!success) {
-        std::cerr << "Warning: Some shaders failed to load\n";
+        Logger::Warning("Some shaders failed to load");
     }
     
     return success;
@@ -46,9 +44,8 @@ bool ShaderManager::LoadShader(const std::string& name,
     auto shader = std::make_unique<ShaderProgram>();
     
     if (!shader->Load(vertexPath, fragmentPath)) {
-        std::cerr << "Failed to load shader: " << name << std::endl;
-        std::cerr << "  Vertex: " << vertexPath << std::endl;
-        std::cerr << "  Fragment: " << fragmentPath << std::endl;
+        Logger::Error("Failed to load shader: " + name +
+                      " (vertex: " + vertexPath + ", fragment: " + fragmentPath + ")");
         return false;
     }
     
@@ -57,11 +54,11 @@ bool ShaderManager::LoadShader(const std::string& name,
     info.program = std::move(shader);
     info.vertexPath = vertexPath;
     info.fragmentPath = fragmentPath;
-    info.lastModified = std::chrono::system_clock::now();
     
     m_shaders[name] = std::move(info);
+    m_watcher.Watch(name, vertexPath, fragmentPath);
     
-    std::cout << "Loaded shader: " << name << std::endl;
+    Logger::Info("Loaded shader: " + name);
     
     return true;
 }
@@ -72,18 +69,18 @@ bool ShaderManager::LoadShaderFromSource(const std::string& name,
     auto shader = std::make_unique<ShaderProgram>();
     
     if (!shader->LoadFromSource(vertexSource, fragmentSource)) {
-        std::cerr << "Failed to load shader from source: " << name << std::endl;
+        Logger::Error("Failed to load shader from source: " + name);
         return false;
     }
     
     // Store shader info (no file paths for source-based shaders)
     ShaderInfo info;
     info.program = std::move(shader);
-    info.lastModified = std::chrono::system_clock::now();
     
     m_shaders[name] = std::move(info);
+    m_watcher.Unwatch(name);
     
-    std::cout << "Loaded shader from source: " << name << std::endl;
+    Logger::Info("Loaded shader from source: " + name);
     
     return true;
 }
@@ -97,7 +94,7 @@ ShaderProgram* ShaderManager::GetShader(const std::string& name) {
     // Return fallback shader if requested shader not found
     auto fallback = m_shaders.find("fallback");
     if (fallback != m_shaders.end()) {
-        std::cerr << "Warning: Shader '" << name << "' not found, using fallback\n";
+        Logger::Warning("Shader '" + name + "' not found, using fallback");
         return fallback->second.program.get();
     }
     
@@ -109,7 +106,7 @@ bool ShaderManager::HasShader(const std::string& name) const {
 }
 
 void ShaderManager::ReloadShaders() {
-    std::cout << "Reloading all shaders...\n";
+    Logger::Info("Reloading all shaders...");
     
     for (auto& [name, info] : m_shaders) {
         // Skip shaders without file paths (loaded from source)
@@ -124,7 +121,7 @@ void ShaderManager::ReloadShaders() {
 bool ShaderManager::ReloadShader(const std::string& name) {
     auto it = m_shaders.find(name);
     if (it == m_shaders.end()) {
-        std::cerr << "Shader not found: " << name << std::endl;
+        Logger::Error("Shader not found: " + name);
         return false;
     }
     
@@ -132,7 +129,7 @@ bool ShaderManager::ReloadShader(const std::string& name) {
     
     // Skip if no file paths
     if (info.vertexPath.empty() || info.fragmentPath.empty()) {
-        std::cerr << "Cannot reload shader without file paths: " << name << std::endl;
+        Logger::Error("Cannot reload shader without file paths: " + name);
         return false;
     }
     
@@ -140,24 +137,25 @@ bool ShaderManager::ReloadShader(const std::string& name) {
     auto newShader = std::make_unique<ShaderProgram>();
     
     if (!newShader->Load(info.vertexPath, info.fragmentPath)) {
-        std::cerr << "Failed to reload shader: " << name << std::endl;
+        Logger::Error("Failed to reload shader: " + name);
         return false;
     }
     
     // Replace old shader
     info.program = std::move(newShader);
-    info.lastModified = std::chrono::system_clock::now();
     
-    std::cout << "Reloaded shader: " << name << std::endl;
+    Logger::Info("Reloaded shader: " + name);
     
     return true;
 }
 
 void ShaderManager::RemoveShader(const std::string& name) {
+    m_watcher.Unwatch(name);
     m_shaders.erase(name);
 }
 
 void ShaderManager::Clear() {
+    m_watcher.UnwatchAll();
     m_shaders.clear();
 }
 
@@ -172,43 +170,49 @@ std::vector<std::string> ShaderManager::GetShaderNames() const {
     return names;
 }
 
-void ShaderManager::CheckForModifiedShaders() {
-    if (!m_hotReloadEnabled) return;
-    
-    for (auto& [name, info] : m_shaders) {
-        // Skip shaders without file paths
-        if (info.vertexPath.empty() || info.fragmentPath.empty()) {
-            continue;
-        }
-        
-        // Check if either file has been modified
-        bool modified = IsFileModified(info.vertexPath, info.lastModified) ||
-                       IsFileModified(info.fragmentPath, info.lastModified);
-        
-        if (modified) {
-            std::cout << "Detected change in shader: " << name << std::endl;
-            ReloadShader(name);
+void ShaderManager::SetHotReloadEnabled(bool enabled) {
+    if (enabled == m_hotReloadEnabled) {
+        return;
+    }
+
+    if (enabled) {
+        if (!m_watcher.Start()) {
+            Logger::Warning("Shader hot reload could not be enabled");
+            return;
         }
+        Logger::Info("Shader hot reload enabled");
+    } else {
+        m_watcher.Stop();
     }
+    m_hotReloadEnabled = enabled;
 }
 
-std::chrono::system_clock::time_point ShaderManager::GetFileModificationTime(const std::string& path) {
-    try {
-        auto ftime = fs::last_write_time(path);
-        auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-            ftime - fs::file_time_type::clock::now() + std::chrono::system_clock::now()
-        );
-        return sctp;
-    } catch (const std::exception& e) {
-        std::cerr << "Error getting file modification time: " << e.what() << std::endl;
-        return std::chrono::system_clock::time_point();
+void ShaderManager::CheckForModifiedShaders() {
+    if (!m_hotReloadEnabled) return;
+    
+    // Sources are read and preprocessed on the watcher thread; only the
+    // GL compile/link happens here since it needs the context
+    ShaderWatcher::ShaderSource source;
+    while (m_watcher.PopReady(source)) {
+        ApplyReloadedSource(source);
     }
 }
 
-bool ShaderManager::IsFileModified(const std::string& path, 
-                                   const std::chrono::system_clock::time_point& lastTime) {
-    auto currentTime = GetFileModificationTime(path);
-    return currentTime > lastTime;
+void ShaderManager::ApplyReloadedSource(const ShaderWatcher::ShaderSource& source) {
+    auto it = m_shaders.find(source.name);
+    if (it == m_shaders.end()) {
+        return;
+    }
+    
+    auto newShader = std::make_unique<ShaderProgram>();
+    if (!newShader->LoadFromSource(source.vertexSource, source.fragmentSource)) {
+        // Keep the previous program running until the next successful save
+        Logger::Error("Hot reload failed, keeping previous version of shader: " + source.name);
+        return;
+    }
+    
+    it->second.program = std::move(newShader);
+    Logger::Info("Hot reloaded shader: " + source.name);
 }
 
 void ShaderManager::CreateFallbackShader() {
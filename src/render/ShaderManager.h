@@ -1,10 +1,11 @@
 #pragma once
 
 #include "ShaderProgram.h"
+#include "ShaderWatcher.h"
 #include <memory>
 #include <unordered_map>
 #include <string>
-#include <chrono>
+#include <vector>
 
 class ShaderManager {
 public:
@@ -45,11 +46,12 @@ public:
     // Get list of loaded shaders
     std::vector<std::string> GetShaderNames() const;
 
-    // Enable/disable hot reloading
-    void SetHotReloadEnabled(bool enabled) { m_hotReloadEnabled = enabled; }
+    // Enable/disable hot reloading (starts/stops the file watcher thread)
+    void SetHotReloadEnabled(bool enabled);
     bool IsHotReloadEnabled() const { return m_hotReloadEnabled; }
     
-    // Check for modified shaders (call periodically for hot reload)
+    // Compile shaders whose files changed (call once per frame on the GL thread).
+    // Only drains the watcher queue; frames without changes touch no files.
     void CheckForModifiedShaders();
 
 private:
@@ -57,7 +59,6 @@ private:
         std::unique_ptr<ShaderProgram> program;
         std::string vertexPath;
         std::string fragmentPath;
-        std::chrono::system_clock::time_point lastModified;
     };
 
     std::unordered_map<std::string, ShaderInfo> m_shaders;
@@ -65,10 +66,12 @@ private:
     
     // Default shader paths
     std::string m_shaderDirectory;
+
+    // Watches shader files and prepares changed sources off the GL thread
+    ShaderWatcher m_watcher;
     
-    // Helper functions
-    std::chrono::system_clock::time_point GetFileModificationTime(const std::string& path);
-    bool IsFileModified(const std::string& path, const std::chrono::system_clock::time_point& lastTime);
+    // Compile a source pair prepared by the watcher and swap it in on success
+    void ApplyReloadedSource(const ShaderWatcher::ShaderSource& source);
     
     // Create default fallback shader
     void CreateFallbackShader();
@@ -1,4 +1,6 @@
 #include "ShaderProgram.h"
+#include "ShaderCache.h"
+#include "GLState.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -14,7 +16,8 @@ ShaderProgram::~ShaderProgram() {
 }
 
 ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept
-    : m_program(other.m_program), m_uniformLocationCache(std::move(other.m_uniformLocationCache)) {
+    : m_program(other.m_program), m_uniformLocationCache(std::move(other.m_uniformLocationCache)),
+      m_locationsById(std::move(other.m_locationsById)) {
     other.m_program = 0;
 }
 
@@ -23,30 +26,43 @@ ShaderProgram& ShaderProgram::operator=(ShaderProgram&& other) noexcept {
         Cleanup();
         m_program = other.m_program;
         m_uniformLocationCache = std::move(other.m_uniformLocationCache);
+        m_locationsById = std::move(other.m_locationsById);
         other.m_program = 0;
     }
     return *this;
 }
 
 bool ShaderProgram::Load(const std::string& vertexPath, const std::string& fragmentPath) {
-    std::string vertexSource = LoadShaderFile(vertexPath);
-    std::string fragmentSource = LoadShaderFile(fragmentPath);
+    std::string vertexSource = ReadSource(vertexPath);
+    std::string fragmentSource = ReadSource(fragmentPath);
     
     if (vertexSource.empty() || fragmentSource.empty()) {
         return false;
     }
 
-    // Process includes
-    fs::path vertBasePath = fs::path(vertexPath).parent_path();
-    fs::path fragBasePath = fs::path(fragmentPath).parent_path();
-    
-    vertexSource = ProcessIncludes(vertexSource, vertBasePath.string());
-    fragmentSource = ProcessIncludes(fragmentSource, fragBasePath.string());
-
     return LoadFromSource(vertexSource, fragmentSource);
 }
 
+std::string ShaderProgram::ReadSource(const std::string& path) {
+    std::string source = LoadShaderFile(path);
+    if (source.empty()) {
+        return source;
+    }
+
+    // Process includes relative to the shader's directory
+    return ProcessIncludes(source, fs::path(path).parent_path().string());
+}
+
 bool ShaderProgram::LoadFromSource(const std::string& vertexSource, const std::string& fragmentSource) {
+    // A binary linked by an earlier run skips compile and link entirely
+    GLuint cachedProgram = ShaderCache::LoadProgram(vertexSource, fragmentSource);
+    if (cachedProgram) {
+        Cleanup();
+        m_program = cachedProgram;
+        CacheUniformLocations();
+        return true;
+    }
+
     GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, vertexSource);
     if (!vertexShader) {
         return false;
@@ -68,6 +84,8 @@ bool ShaderProgram::LoadFromSource(const std::string& vertexSource, const std::s
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ShaderCache::StoreProgram(m_program, vertexSource, fragmentSource);
+
     // Cache uniform locations
     CacheUniformLocations();
 
@@ -75,7 +93,7 @@ bool ShaderProgram::LoadFromSource(const std::string& vertexSource, const std::s
 }
 
 void ShaderProgram::Use() const {
-    glUseProgram(m_program);
+    GLState::UseProgram(m_program);
 }
 
 GLuint ShaderProgram::CompileShader(GLenum type, const std::string& source) {
@@ -112,6 +130,7 @@ bool ShaderProgram::LinkProgram(GLuint vertexShader, GLuint fragmentShader) {
     // Bind fragment output
     glBindFragDataLocation(m_program, 0, "fragColor");
     
+    ShaderCache::PrepareForLink(m_program);
     glLinkProgram(m_program);
 
     GLint success;
@@ -120,7 +139,7 @@ bool ShaderProgram::LinkProgram(GLuint vertexShader, GLuint fragmentShader) {
     if (!success) {
         std::string log = GetProgramInfoLog(m_program);
         std::cerr << "Shader linking failed:\n" << log << std::endl;
-        glDeleteProgram(m_program);
+        GLState::DeleteProgram(m_program);
         m_program = 0;
         return false;
     }
@@ -251,6 +270,7 @@ void ShaderProgram::CacheUniformLocations() {
     if (!m_program) return;
 
     m_uniformLocationCache.clear();
+    m_locationsById.clear();
 
     GLint uniformCount;
     glGetProgramiv(m_program, GL_ACTIVE_UNIFORMS, &uniformCount);
@@ -289,58 +309,129 @@ GLint ShaderProgram::GetUniformLocation(const std::string& name) {
     return location;
 }
 
+GLint ShaderProgram::GetUniformLocation(UniformId id) {
+    const uint32_t index = id.GetIndex();
+    if (index < m_locationsById.size() && m_locationsById[index] != UNRESOLVED_LOCATION) {
+        return m_locationsById[index];
+    }
+    if (index >= m_locationsById.size()) {
+        m_locationsById.resize(index + 1, UNRESOLVED_LOCATION);
+    }
+
+    // Missing (or optimized-out) uniforms are cached as -1 so they never reach the driver again
+    GLint location = m_program ? glGetUniformLocation(m_program, id.GetName()) : -1;
+    m_locationsById[index] = location;
+    return location;
+}
+
 // Uniform setters
 void ShaderProgram::SetUniform(const std::string& name, bool value) {
-    GLint location = GetUniformLocation(name);
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, int value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, float value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, const glm::vec2& value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, const glm::vec3& value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, const glm::vec4& value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, const glm::mat3& value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& name, const glm::mat4& value) {
+    SetUniformAt(GetUniformLocation(name), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, bool value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, int value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, float value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, const glm::vec2& value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, const glm::vec3& value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, const glm::vec4& value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, const glm::mat3& value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniform(UniformId id, const glm::mat4& value) {
+    SetUniformAt(GetUniformLocation(id), value);
+}
+
+void ShaderProgram::SetUniformAt(GLint location, bool value) {
     if (location != -1) {
         glUniform1i(location, value ? 1 : 0);
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, int value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, int value) {
     if (location != -1) {
         glUniform1i(location, value);
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, float value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, float value) {
     if (location != -1) {
         glUniform1f(location, value);
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, const glm::vec2& value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, const glm::vec2& value) {
     if (location != -1) {
         glUniform2fv(location, 1, glm::value_ptr(value));
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, const glm::vec3& value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, const glm::vec3& value) {
     if (location != -1) {
         glUniform3fv(location, 1, glm::value_ptr(value));
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, const glm::vec4& value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, const glm::vec4& value) {
     if (location != -1) {
         glUniform4fv(location, 1, glm::value_ptr(value));
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, const glm::mat3& value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, const glm::mat3& value) {
     if (location != -1) {
         glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
     }
 }
 
-void ShaderProgram::SetUniform(const std::string& name, const glm::mat4& value) {
-    GLint location = GetUniformLocation(name);
+void ShaderProgram::SetUniformAt(GLint location, const glm::mat4& value) {
     if (location != -1) {
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
     }
@@ -417,8 +508,9 @@ void ShaderProgram::PrintActiveAttributes() const {
 
 void ShaderProgram::Cleanup() {
     if (m_program) {
-        glDeleteProgram(m_program);
+        GLState::DeleteProgram(m_program);
         m_program = 0;
     }
     m_uniformLocationCache.clear();
+    m_locationsById.clear();
 }
\ No newline at end of file
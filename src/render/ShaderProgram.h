@@ -5,7 +5,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <memory>
+#include "render/UniformId.h"
 
 class ShaderProgram {
 public:
@@ -24,6 +26,9 @@ public:
     bool Load(const std::string& vertexPath, const std::string& fragmentPath);
     bool LoadFromSource(const std::string& vertexSource, const std::string& fragmentSource);
 
+    // Read a shader file and expand #include directives (no GL calls, safe off the GL thread)
+    static std::string ReadSource(const std::string& path);
+
     // Use this shader program
     void Use() const;
     
@@ -43,6 +48,16 @@ public:
     void SetUniform(const std::string& name, const glm::mat3& value);
     void SetUniform(const std::string& name, const glm::mat4& value);
 
+    // Uniform setters by interned ID (location looked up once per program, then an array index)
+    void SetUniform(UniformId id, bool value);
+    void SetUniform(UniformId id, int value);
+    void SetUniform(UniformId id, float value);
+    void SetUniform(UniformId id, const glm::vec2& value);
+    void SetUniform(UniformId id, const glm::vec3& value);
+    void SetUniform(UniformId id, const glm::vec4& value);
+    void SetUniform(UniformId id, const glm::mat3& value);
+    void SetUniform(UniformId id, const glm::mat4& value);
+
     // Array uniform setters
     void SetUniformArray(const std::string& name, const float* values, size_t count);
     void SetUniformArray(const std::string& name, const glm::vec2* values, size_t count);
@@ -51,6 +66,7 @@ public:
 
     // Get uniform location (cached)
     GLint GetUniformLocation(const std::string& name);
+    GLint GetUniformLocation(UniformId id);
 
     // Debug info
     void PrintActiveUniforms() const;
@@ -59,14 +75,17 @@ public:
 private:
     GLuint m_program;
     mutable std::unordered_map<std::string, GLint> m_uniformLocationCache;
+    // Indexed by UniformId; UNRESOLVED_LOCATION until first use (-1 is cached for missing uniforms)
+    std::vector<GLint> m_locationsById;
+    static constexpr GLint UNRESOLVED_LOCATION = -2;
 
     // Shader compilation helpers
     GLuint CompileShader(GLenum type, const std::string& source);
     bool LinkProgram(GLuint vertexShader, GLuint fragmentShader);
     
     // File loading
-    std::string LoadShaderFile(const std::string& path);
-    std::string ProcessIncludes(const std::string& source, const std::string& basePath);
+    static std::string LoadShaderFile(const std::string& path);
+    static std::string ProcessIncludes(const std::string& source, const std::string& basePath);
     
     // Error handling
     std::string GetShaderInfoLog(GLuint shader);
@@ -76,6 +95,16 @@ private:
     // Cache all uniform locations
     void CacheUniformLocations();
 
+    // Upload a value to a resolved location (-1 is ignored)
+    static void SetUniformAt(GLint location, bool value);
+    static void SetUniformAt(GLint location, int value);
+    static void SetUniformAt(GLint location, float value);
+    static void SetUniformAt(GLint location, const glm::vec2& value);
+    static void SetUniformAt(GLint location, const glm::vec3& value);
+    static void SetUniformAt(GLint location, const glm::vec4& value);
+    static void SetUniformAt(GLint location, const glm::mat3& value);
+    static void SetUniformAt(GLint location, const glm::mat4& value);
+
     // Cleanup
     void Cleanup();
 };
\ No newline at end of file
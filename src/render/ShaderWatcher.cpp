@@ -0,0 +1,346 @@
+#include "ShaderWatcher.h"
+#include "ShaderProgram.h"
+#include "../utils/Logger.h"
+#include "../utils/Profiler.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+ShaderWatcher::ShaderWatcher() = default;
+
+ShaderWatcher::~ShaderWatcher() {
+    Stop();
+}
+
+bool ShaderWatcher::Start() {
+    if (IsRunning()) {
+        return true;
+    }
+
+#if defined(__linux__)
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFd < 0) {
+        Logger::Warning(std::string("Shader hot reload unavailable: inotify_init1 failed: ") + std::strerror(errno));
+        return false;
+    }
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wakeFd < 0) {
+        Logger::Warning(std::string("Shader hot reload unavailable: eventfd failed: ") + std::strerror(errno));
+        close(m_inotifyFd);
+        m_inotifyFd = -1;
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [name, shader] : m_shaders) {
+            AddDirectoryWatch(fs::path(shader.vertexPath).parent_path().string());
+            AddDirectoryWatch(fs::path(shader.fragmentPath).parent_path().string());
+        }
+    }
+#else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = false;
+    }
+    m_modifiedTimes.clear();
+#endif
+
+    m_pending.clear();
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&ShaderWatcher::ThreadLoop, this);
+    return true;
+}
+
+void ShaderWatcher::Stop() {
+    if (!IsRunning()) {
+        return;
+    }
+    m_running.store(false, std::memory_order_release);
+
+#if defined(__linux__)
+    uint64_t one = 1;
+    [[maybe_unused]] ssize_t written = write(m_wakeFd, &one, sizeof(one));
+#else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = true;
+    }
+    m_wakeCondition.notify_one();
+#endif
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+#if defined(__linux__)
+    close(m_inotifyFd);
+    close(m_wakeFd);
+    m_inotifyFd = -1;
+    m_wakeFd = -1;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_watchDirs.clear();
+    m_dirWatches.clear();
+#endif
+}
+
+void ShaderWatcher::Watch(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    WatchedShader& shader = m_shaders[name];
+    shader.vertexPath = NormalizePath(vertexPath);
+    shader.fragmentPath = NormalizePath(fragmentPath);
+
+#if defined(__linux__)
+    if (m_inotifyFd >= 0) {
+        AddDirectoryWatch(fs::path(shader.vertexPath).parent_path().string());
+        AddDirectoryWatch(fs::path(shader.fragmentPath).parent_path().string());
+    }
+#endif
+}
+
+void ShaderWatcher::Unwatch(const std::string& name) {
+    // 디렉터리 감시는 남겨 둠 (이벤트가 와도 등록된 셰이더가 없으면 무시됨)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shaders.erase(name);
+}
+
+void ShaderWatcher::UnwatchAll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shaders.clear();
+}
+
+bool ShaderWatcher::PopReady(ShaderSource& out) {
+    size_t head = m_queueHead.load(std::memory_order_relaxed);
+    if (head == m_queueTail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    out = std::move(m_queue[head & (QUEUE_CAPACITY - 1)]);
+    m_queueHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool ShaderWatcher::Push(ShaderSource&& source) {
+    size_t tail = m_queueTail.load(std::memory_order_relaxed);
+    if (tail - m_queueHead.load(std::memory_order_acquire) == QUEUE_CAPACITY) {
+        return false;
+    }
+    m_queue[tail & (QUEUE_CAPACITY - 1)] = std::move(source);
+    m_queueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void ShaderWatcher::MarkChanged(const std::string& path, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [name, shader] : m_shaders) {
+        if (shader.vertexPath == path || shader.fragmentPath == path) {
+            // 이벤트가 올 때마다 마감을 미룸 (에디터의 잘라 쓰기 + 쓰기 + 이름 변경을 한 번으로)
+            m_pending[name] = now + std::chrono::milliseconds(DEBOUNCE_MS);
+        }
+    }
+}
+
+void ShaderWatcher::MarkAllChanged(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [name, shader] : m_shaders) {
+        m_pending[name] = now + std::chrono::milliseconds(DEBOUNCE_MS);
+    }
+}
+
+int ShaderWatcher::NextTimeoutMs() const {
+    if (m_pending.empty()) {
+        return -1;
+    }
+    Clock::time_point earliest = Clock::time_point::max();
+    for (const auto& [name, deadline] : m_pending) {
+        earliest = std::min(earliest, deadline);
+    }
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(earliest - Clock::now());
+    return static_cast<int>(std::max<int64_t>(0, remaining.count()));
+}
+
+void ShaderWatcher::FlushDue() {
+    if (m_pending.empty()) {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    std::vector<std::pair<std::string, WatchedShader>> due;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            if (it->second > now) {
+                ++it;
+                continue;
+            }
+            auto shader = m_shaders.find(it->first);
+            if (shader != m_shaders.end()) {
+                due.emplace_back(it->first, shader->second);
+            }
+            it = m_pending.erase(it);
+        }
+    }
+
+    for (auto& [name, shader] : due) {
+        PROFILE_SCOPE("Shader Source Read");
+        ShaderSource source;
+        source.name = name;
+        source.vertexSource = ShaderProgram::ReadSource(shader.vertexPath);
+        source.fragmentSource = ShaderProgram::ReadSource(shader.fragmentPath);
+        if (source.vertexSource.empty() || source.fragmentSource.empty()) {
+            // 저장 도중이면 다음 이벤트에서 다시 시도됨
+            Logger::Warning("Shader hot reload: could not read sources for " + name);
+            continue;
+        }
+        if (!Push(std::move(source))) {
+            // 메인 스레드가 아직 비우지 않음: 잠시 후 다시 읽음
+            m_pending[name] = now + std::chrono::milliseconds(DEBOUNCE_MS);
+        }
+    }
+}
+
+std::string ShaderWatcher::NormalizePath(const std::string& path) {
+    fs::path normalized = fs::path(path).lexically_normal();
+    if (!normalized.has_parent_path()) {
+        normalized = fs::path(".") / normalized;
+    }
+    return normalized.string();
+}
+
+#if defined(__linux__)
+
+void ShaderWatcher::AddDirectoryWatch(const std::string& directory) {
+    if (m_dirWatches.count(directory) > 0) {
+        return;
+    }
+    // 에디터는 제자리 쓰기(CLOSE_WRITE) 또는 임시 파일 + 이름 변경(MOVED_TO)으로 저장하므로
+    // 파일이 아니라 디렉터리를 감시해야 교체된 파일도 놓치지 않음
+    int wd = inotify_add_watch(m_inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0) {
+        Logger::Warning("Shader hot reload: cannot watch " + directory + ": " + std::strerror(errno));
+        return;
+    }
+    m_dirWatches[directory] = wd;
+    m_watchDirs[wd] = directory;
+}
+
+void ShaderWatcher::ThreadLoop() {
+    PROFILE_THREAD("Shader Watcher");
+
+    pollfd fds[2] = {
+        {m_inotifyFd, POLLIN, 0},
+        {m_wakeFd, POLLIN, 0},
+    };
+
+    while (IsRunning()) {
+        int ready = poll(fds, 2, NextTimeoutMs());
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Logger::Error(std::string("Shader watcher poll failed: ") + std::strerror(errno));
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+        if (fds[0].revents & POLLIN) {
+            ReadEvents();
+        }
+        FlushDue();
+    }
+}
+
+void ShaderWatcher::ReadEvents() {
+    alignas(inotify_event) char buffer[4096];
+    Clock::time_point now = Clock::now();
+
+    for (;;) {
+        ssize_t length = read(m_inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            // EAGAIN: 큐를 다 비움
+            return;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // 이벤트를 잃었으므로 전부 다시 읽음
+                MarkAllChanged(now);
+                continue;
+            }
+            if (event->len == 0) {
+                continue;
+            }
+
+            std::string directory;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_watchDirs.find(event->wd);
+                if (it == m_watchDirs.end()) {
+                    continue;
+                }
+                directory = it->second;
+            }
+            MarkChanged((fs::path(directory) / event->name).string(), now);
+        }
+    }
+}
+
+#else
+
+void ShaderWatcher::ThreadLoop() {
+    PROFILE_THREAD("Shader Watcher");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopRequested) {
+        int timeout = NextTimeoutMs();
+        auto wait = std::chrono::milliseconds(timeout < 0 ? POLL_INTERVAL_MS : std::min(timeout, POLL_INTERVAL_MS));
+        if (m_wakeCondition.wait_for(lock, wait, [this] { return m_stopRequested; })) {
+            break;
+        }
+        lock.unlock();
+        PollModifiedTimes();
+        FlushDue();
+        lock.lock();
+    }
+}
+
+void ShaderWatcher::PollModifiedTimes() {
+    std::vector<std::string> paths;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [name, shader] : m_shaders) {
+            paths.push_back(shader.vertexPath);
+            paths.push_back(shader.fragmentPath);
+        }
+    }
+
+    Clock::time_point now = Clock::now();
+    for (const std::string& path : paths) {
+        std::error_code error;
+        fs::file_time_type modified = fs::last_write_time(path, error);
+        if (error) {
+            continue;
+        }
+        auto [it, inserted] = m_modifiedTimes.try_emplace(path, modified);
+        if (!inserted && it->second != modified) {
+            it->second = modified;
+            MarkChanged(path, now);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// 셰이더 핫 리로드용 파일 감시
+// - 감시 스레드가 셰이더 디렉터리의 변경 이벤트를 기다림 (Linux: inotify, 그 외: 스레드에서 mtime 폴링)
+// - 한 셰이더에 이벤트가 몰리면 마지막 이벤트 후 DEBOUNCE_MS 동안 조용해졌을 때 한 번만 처리
+// - 감시 스레드가 GLSL 소스를 읽고 #include를 펼쳐 락 없는 SPSC 링에 넣음
+// - 메인 스레드는 PopReady로 링만 비움: 변경이 없는 프레임은 원자 변수 읽기뿐 (시스템 콜 없음)
+// - GL 컴파일/링크는 컨텍스트가 있는 스레드에서만 가능하므로 꺼낸 소스는 ShaderManager가 컴파일
+class ShaderWatcher {
+public:
+    struct ShaderSource {
+        std::string name;
+        std::string vertexSource;
+        std::string fragmentSource;
+    };
+
+    ShaderWatcher();
+    ~ShaderWatcher();
+
+    ShaderWatcher(const ShaderWatcher&) = delete;
+    ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+    // 감시 스레드 시작/정지 (등록된 셰이더는 정지 후에도 유지)
+    bool Start();
+    void Stop();
+    bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    // 셰이더 등록/해제 (로드 시점에만 호출, 프레임마다 부르지 않음)
+    void Watch(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
+    void Unwatch(const std::string& name);
+    void UnwatchAll();
+
+    // 메인 스레드 전용: 준비된 소스를 하나 꺼냄 (없으면 false)
+    bool PopReady(ShaderSource& out);
+
+    static constexpr int DEBOUNCE_MS = 100;
+    static constexpr int POLL_INTERVAL_MS = 500;   // inotify가 없는 플랫폼의 폴링 주기
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct WatchedShader {
+        std::string vertexPath;     // lexically_normal 경로
+        std::string fragmentPath;
+    };
+
+    // 등록 정보 (Watch는 메인 스레드, 조회는 감시 스레드)
+    std::mutex m_mutex;
+    std::unordered_map<std::string, WatchedShader> m_shaders;
+
+    // 감시 스레드 전용: 셰이더 이름 -> 처리 예정 시각
+    std::unordered_map<std::string, Clock::time_point> m_pending;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+#if defined(__linux__)
+    int m_inotifyFd = -1;
+    int m_wakeFd = -1;                                      // Stop이 poll을 깨우는 eventfd
+    std::unordered_map<int, std::string> m_watchDirs;       // watch descriptor -> 디렉터리 (m_mutex)
+    std::unordered_map<std::string, int> m_dirWatches;      // 디렉터리 -> watch descriptor (m_mutex)
+
+    void AddDirectoryWatch(const std::string& directory);   // m_mutex를 잡은 채 호출
+    void ReadEvents();
+#else
+    std::condition_variable m_wakeCondition;
+    bool m_stopRequested = false;                           // m_mutex
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_modifiedTimes;  // 감시 스레드 전용
+
+    void PollModifiedTimes();
+#endif
+
+    // 감시 스레드 -> 메인 스레드 SPSC 링
+    static constexpr size_t QUEUE_CAPACITY = 32;            // 2의 거듭제곱
+    std::array<ShaderSource, QUEUE_CAPACITY> m_queue;
+    alignas(64) std::atomic<size_t> m_queueHead{0};         // 소비자 (메인)
+    alignas(64) std::atomic<size_t> m_queueTail{0};         // 생산자 (감시 스레드)
+
+    void ThreadLoop();
+    void MarkChanged(const std::string& path, Clock::time_point now);
+    void MarkAllChanged(Clock::time_point now);
+    void FlushDue();
+    int NextTimeoutMs() const;
+    bool Push(ShaderSource&& source);
+
+    static std::string NormalizePath(const std::string& path);
+};
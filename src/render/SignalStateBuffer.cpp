@@ -0,0 +1,220 @@
+#include "SignalStateBuffer.h"
+#include "GLState.h"
+#include <algorithm>
+#include <functional>
+
+SignalStateBuffer::SignalStateBuffer()
+    : m_buffer(0)
+    , m_texture(0)
+    , m_toggleBuffer(0)
+    , m_toggleTexture(0)
+    , m_capacityWords(0)
+    , m_time(0.0f)
+    , m_fullUpload(false)
+    , m_animate(true)
+    , m_initialized(false) {
+}
+
+SignalStateBuffer::~SignalStateBuffer() {
+    Cleanup();
+}
+
+bool SignalStateBuffer::Initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    // 빈 버퍼 텍스처가 되지 않도록 최소 용량으로 시작
+    Reserve(1024 * 32);
+
+    glGenBuffers(1, &m_buffer);
+    GLState::BindBuffer(GL_TEXTURE_BUFFER, m_buffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(uint32_t) * m_capacityWords, m_words.data(), GL_DYNAMIC_DRAW);
+    glGenTextures(1, &m_texture);
+    glBindTexture(GL_TEXTURE_BUFFER, m_texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, m_buffer);
+
+    glGenBuffers(1, &m_toggleBuffer);
+    GLState::BindBuffer(GL_TEXTURE_BUFFER, m_toggleBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(float) * m_toggleTimes.size(), m_toggleTimes.data(), GL_DYNAMIC_DRAW);
+    glGenTextures(1, &m_toggleTexture);
+    glBindTexture(GL_TEXTURE_BUFFER, m_toggleTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, m_toggleBuffer);
+
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    GLState::BindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    m_fullUpload = false;
+    m_initialized = true;
+    return true;
+}
+
+void SignalStateBuffer::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_texture) glDeleteTextures(1, &m_texture);
+    if (m_buffer) GLState::DeleteBuffer(m_buffer);
+    if (m_toggleTexture) glDeleteTextures(1, &m_toggleTexture);
+    if (m_toggleBuffer) GLState::DeleteBuffer(m_toggleBuffer);
+    m_texture = m_buffer = m_toggleTexture = m_toggleBuffer = 0;
+
+    m_initialized = false;
+}
+
+void SignalStateBuffer::Reserve(uint32_t netCount) {
+    size_t words = (static_cast<size_t>(netCount) + 31) >> 5;
+    if (words <= m_words.size()) {
+        return;
+    }
+
+    // 블록 단위로 두 배씩 키우고 전체를 다시 올림 (버퍼 텍스처는 같은 버퍼 객체를 계속 가리킴)
+    words = std::max(words, m_words.size() * 2);
+    words = (words + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK * WORDS_PER_BLOCK;
+    m_words.resize(words, 0);
+    m_blockDirty.resize(words / WORDS_PER_BLOCK, 0);
+    m_toggleTimes.resize(words * 32, NEVER_TOGGLED);
+    m_netToggled.resize(words * 32, 0);
+    m_capacityWords = words;
+    m_fullUpload = true;
+}
+
+void SignalStateBuffer::Set(uint32_t net, bool high, bool animate) {
+    if (net == 0) {
+        return;
+    }
+
+    size_t word = net >> 5;
+    if (word >= m_words.size()) {
+        if (!high) {
+            return;
+        }
+        Reserve(net + 1);
+    }
+
+    uint32_t mask = 1u << (net & 31u);
+    uint32_t value = high ? (m_words[word] | mask) : (m_words[word] & ~mask);
+    if (value == m_words[word]) {
+        return;
+    }
+
+    m_words[word] = value;
+    MarkDirty(word);
+
+    if (animate && m_animate) {
+        m_toggleTimes[net] = m_time;
+        if (!m_netToggled[net] && !m_fullUpload) {
+            m_netToggled[net] = 1;
+            m_toggledNets.push_back(net);
+        }
+    }
+}
+
+void SignalStateBuffer::Clear() {
+    std::fill(m_words.begin(), m_words.end(), 0u);
+    std::fill(m_toggleTimes.begin(), m_toggleTimes.end(), NEVER_TOGGLED);
+    m_fullUpload = true;
+}
+
+MemoryUsage SignalStateBuffer::GetMemoryUsage() const {
+    MemoryUsage usage = MemoryStats::Measure(m_words);
+    usage += MemoryStats::Measure(m_dirtyBlocks);
+    usage += MemoryStats::Measure(m_blockDirty);
+    usage += MemoryStats::Measure(m_toggleTimes);
+    usage += MemoryStats::Measure(m_toggledNets);
+    usage += MemoryStats::Measure(m_netToggled);
+    usage += MemoryStats::Measure(m_gapScratch);
+    return usage;
+}
+
+void SignalStateBuffer::MarkDirty(size_t word) {
+    if (m_fullUpload) {
+        return;
+    }
+    size_t block = word / WORDS_PER_BLOCK;
+    if (!m_blockDirty[block]) {
+        m_blockDirty[block] = 1;
+        m_dirtyBlocks.push_back(static_cast<uint32_t>(block));
+    }
+}
+
+void SignalStateBuffer::Record(RenderCommandList& commands) {
+    if (m_fullUpload) {
+        for (uint32_t block : m_dirtyBlocks) {
+            m_blockDirty[block] = 0;
+        }
+        m_dirtyBlocks.clear();
+        for (uint32_t net : m_toggledNets) {
+            m_netToggled[net] = 0;
+        }
+        m_toggledNets.clear();
+        m_fullUpload = false;
+        commands.ReallocateBuffer(m_buffer, sizeof(uint32_t) * m_capacityWords, m_words.data(), false);
+        commands.ReallocateBuffer(m_toggleBuffer, sizeof(float) * m_toggleTimes.size(), m_toggleTimes.data(), false);
+        return;
+    }
+
+    RecordToggleTimes(commands);
+
+    if (m_dirtyBlocks.empty()) {
+        return;
+    }
+
+    // 이웃한 블록은 한 번의 업로드로 묶음
+    std::sort(m_dirtyBlocks.begin(), m_dirtyBlocks.end());
+    size_t i = 0;
+    while (i < m_dirtyBlocks.size()) {
+        uint32_t begin = m_dirtyBlocks[i];
+        uint32_t end = begin + 1;
+        m_blockDirty[begin] = 0;
+        while (++i < m_dirtyBlocks.size() && m_dirtyBlocks[i] == end) {
+            m_blockDirty[end] = 0;
+            ++end;
+        }
+        size_t firstWord = static_cast<size_t>(begin) * WORDS_PER_BLOCK;
+        commands.UpdateBuffer(m_buffer, sizeof(uint32_t) * firstWord,
+                              sizeof(uint32_t) * (end - begin) * WORDS_PER_BLOCK, &m_words[firstWord]);
+    }
+    m_dirtyBlocks.clear();
+}
+
+void SignalStateBuffer::RecordToggleTimes(RenderCommandList& commands) {
+    if (m_toggledNets.empty()) {
+        return;
+    }
+
+    // 토글된 넷은 흩어져 있으므로 호출 수와 바이트 수를 함께 줄임:
+    // 가까운 넷은 한 범위로 묶고, 범위가 너무 많으면 가장 큰 빈틈에서만 나눔
+    constexpr uint32_t MERGE_GAP = 32;
+    constexpr size_t MAX_UPLOAD_CALLS = 256;
+
+    std::sort(m_toggledNets.begin(), m_toggledNets.end());
+    for (uint32_t net : m_toggledNets) {
+        m_netToggled[net] = 0;
+    }
+
+    uint32_t splitGap = MERGE_GAP;
+    if (m_toggledNets.size() > MAX_UPLOAD_CALLS) {
+        m_gapScratch.clear();
+        for (size_t i = 1; i < m_toggledNets.size(); ++i) {
+            m_gapScratch.push_back(m_toggledNets[i] - m_toggledNets[i - 1]);
+        }
+        // (MAX_UPLOAD_CALLS - 1)번째로 큰 빈틈보다 큰 곳에서만 나누면 호출 수가 상한 이하
+        auto nth = m_gapScratch.begin() + (MAX_UPLOAD_CALLS - 1);
+        std::nth_element(m_gapScratch.begin(), nth, m_gapScratch.end(), std::greater<uint32_t>());
+        splitGap = std::max(splitGap, *nth);
+    }
+
+    size_t i = 0;
+    while (i < m_toggledNets.size()) {
+        uint32_t begin = m_toggledNets[i];
+        uint32_t end = begin + 1;
+        while (++i < m_toggledNets.size() && m_toggledNets[i] - (end - 1) <= splitGap) {
+            end = m_toggledNets[i] + 1;
+        }
+        commands.UpdateBuffer(m_toggleBuffer, sizeof(float) * begin, sizeof(float) * (end - begin),
+                              &m_toggleTimes[begin]);
+    }
+    m_toggledNets.clear();
+}
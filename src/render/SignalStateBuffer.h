@@ -0,0 +1,78 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+#include <cstdint>
+#include "render/RenderCommandList.h"
+
+// 넷(게이트 출력)마다 1비트인 신호 상태를 R32UI 버퍼 텍스처로 GPU에 유지
+// 게이트/와이어 셰이더가 넷 번호로 비트를 읽어 색을 정하므로, 신호가 바뀌어도
+// 인스턴스/정점 데이터는 그대로이고 바뀐 블록만 올림 (100만 넷 전체가 125KB)
+// 넷 번호는 GateId를 그대로 사용하고, 0번(INVALID_GATE_ID)은 항상 LOW
+//
+// 넷마다 마지막 토글 시각(R32F)도 함께 유지: 셰이더가 현재 시각과의 차이로
+// 와이어를 따라 흐르는 펄스를 계산하므로 CPU 쪽 애니메이션 상태가 없음
+class SignalStateBuffer {
+public:
+    SignalStateBuffer();
+    ~SignalStateBuffer();
+
+    bool Initialize();
+    void Cleanup();
+
+    // netCount개의 넷을 담을 수 있도록 CPU 사본을 늘림 (GPU 버퍼는 다음 Record에서 재할당)
+    void Reserve(uint32_t netCount);
+    // 값이 바뀌면 animate일 때 현재 시각을 토글 시각으로 기록 (전체 재구축은 false)
+    void Set(uint32_t net, bool high, bool animate = true);
+    bool Get(uint32_t net) const {
+        size_t word = net >> 5;
+        return word < m_words.size() && ((m_words[word] >> (net & 31u)) & 1u);
+    }
+    // 모든 넷을 LOW로, 토글 기록도 지움 (전체 재구축 전)
+    void Clear();
+
+    // 애니메이션 기준 시각 (초). 프레임마다 RenderManager가 갱신
+    void SetTime(float seconds) { m_time = seconds; }
+    float GetTime() const { return m_time; }
+    // 끄면 토글 시각을 기록/업로드하지 않음 (새 펄스/강조가 생기지 않음)
+    void SetAnimate(bool enabled) { m_animate = enabled; }
+
+    // 바뀐 블록과 토글 시각을 업로드로 기록
+    void Record(RenderCommandList& commands);
+
+    GLuint GetTexture() const { return m_texture; }
+    GLuint GetToggleTexture() const { return m_toggleTexture; }
+    size_t GetWordCount() const { return m_words.size(); }
+    // CPU 사본과 업로드 준비용 배열 (GPU 버퍼 제외)
+    MemoryUsage GetMemoryUsage() const;
+
+private:
+    // 64워드(2048넷) 블록 단위로 변경을 모아 올림
+    static constexpr size_t WORDS_PER_BLOCK = 64;
+    // 토글이 없었던 넷의 시각 (셰이더에서 펄스가 이미 지나간 것으로 보임)
+    static constexpr float NEVER_TOGGLED = -1.0e6f;
+
+    void MarkDirty(size_t word);
+    void RecordToggleTimes(RenderCommandList& commands);
+
+    GLuint m_buffer;
+    GLuint m_texture;
+    GLuint m_toggleBuffer;
+    GLuint m_toggleTexture;
+    size_t m_capacityWords;         // GPU 버퍼 용량 (워드, 토글 버퍼는 넷 단위로 32배)
+
+    std::vector<uint32_t> m_words;
+    std::vector<uint32_t> m_dirtyBlocks;
+    std::vector<uint8_t> m_blockDirty;
+
+    std::vector<float> m_toggleTimes;
+    std::vector<uint32_t> m_toggledNets;    // 이번 프레임에 토글된 넷 (중복 없음)
+    std::vector<uint8_t> m_netToggled;
+    std::vector<uint32_t> m_gapScratch;
+
+    float m_time;
+    bool m_fullUpload;             // 다음 Record에서 전체를 다시 할당해 올림
+    bool m_animate;
+
+    bool m_initialized;
+};
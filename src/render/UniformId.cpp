@@ -0,0 +1,43 @@
+#include "UniformId.h"
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+struct UniformRegistry {
+    std::mutex mutex;
+    std::deque<std::string> names;      // deque라 등록이 늘어도 기존 문자열 주소가 유지됨
+    std::unordered_map<std::string_view, uint32_t> indices;
+};
+
+// 다른 파일의 정적 상수가 먼저 초기화될 수 있으므로 함수 안 정적 변수로 둠
+UniformRegistry& GetRegistry() {
+    static UniformRegistry registry;
+    return registry;
+}
+
+} // namespace
+
+UniformId::UniformId(const char* name) {
+    UniformRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.indices.find(name);
+    if (it != registry.indices.end()) {
+        m_index = it->second;
+        return;
+    }
+
+    m_index = static_cast<uint32_t>(registry.names.size());
+    registry.names.emplace_back(name);
+    registry.indices.emplace(registry.names.back(), m_index);
+}
+
+const char* UniformId::GetName() const {
+    UniformRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names[m_index].c_str();
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// 유니폼 이름을 프로세스 전역 표에 한 번 등록해 얻은 작은 정수
+// - 렌더러는 파일 범위 상수로 만들어 두고 (등록은 정적 초기화 때 한 번, 같은 이름은 같은 ID)
+// - ShaderProgram은 ID를 인덱스로 위치 배열을 바로 읽음 (문자열 생성/해시/비교 없음)
+class UniformId {
+public:
+    explicit UniformId(const char* name);
+
+    uint32_t GetIndex() const { return m_index; }
+    // 등록된 이름 (프로그램 수명 동안 유효)
+    const char* GetName() const;
+
+    bool operator==(const UniformId& other) const { return m_index == other.m_index; }
+    bool operator!=(const UniformId& other) const { return m_index != other.m_index; }
+
+private:
+    uint32_t m_index;
+};
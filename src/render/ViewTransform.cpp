@@ -0,0 +1,128 @@
+#include "ViewTransform.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 배치 함수는 vec2 배열을 float 배열(x0 y0 x1 y1 ...)로 읽음
+static_assert(sizeof(glm::vec2) == 2 * sizeof(float), "glm::vec2 must be two packed floats");
+static_assert(sizeof(glm::ivec2) == 2 * sizeof(int32_t), "glm::ivec2 must be two packed ints");
+
+namespace {
+
+#ifdef __SSE2__
+// 레지스터 하나 = 두 점 (x0 y0 x1 y1)
+inline __m128 Affine2(__m128 points, __m128 scale, __m128 offset) {
+    return _mm_add_ps(_mm_mul_ps(points, scale), offset);
+}
+
+// SSE2에는 floor가 없으므로 0 쪽으로 자른 뒤 원래 값보다 커진 칸(음수 비정수)만 1 뺌
+inline __m128i Floor2(__m128 points) {
+    __m128i truncated = _mm_cvttps_epi32(points);
+    __m128 roundedUp = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), points);
+    return _mm_add_epi32(truncated, _mm_castps_si128(roundedUp));    // 참인 칸은 -1
+}
+#endif
+
+void AffineBatch(const glm::vec2* in, glm::vec2* out, size_t count,
+                 const glm::vec2& scale, const glm::vec2& offset) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const float* src = reinterpret_cast<const float*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+    const __m128 scale2 = _mm_setr_ps(scale.x, scale.y, scale.x, scale.y);
+    const __m128 offset2 = _mm_setr_ps(offset.x, offset.y, offset.x, offset.y);
+    for (; i + 4 <= count; i += 4) {
+        __m128 a = _mm_loadu_ps(src + i * 2);
+        __m128 b = _mm_loadu_ps(src + i * 2 + 4);
+        _mm_storeu_ps(dst + i * 2, Affine2(a, scale2, offset2));
+        _mm_storeu_ps(dst + i * 2 + 4, Affine2(b, scale2, offset2));
+    }
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_ps(dst + i * 2, Affine2(_mm_loadu_ps(src + i * 2), scale2, offset2));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = in[i] * scale + offset;
+    }
+}
+
+} // namespace
+
+ViewTransform ViewTransform::Build(const glm::vec2& position, float pixelsPerCell,
+                                   const glm::vec2& screenSize, uint32_t version) {
+    ViewTransform transform;
+    transform.screenSize = screenSize;
+    transform.pixelsPerCell = pixelsPerCell;
+    transform.version = version;
+
+    float halfWidth = screenSize.x * 0.5f / pixelsPerCell;
+    float halfHeight = screenSize.y * 0.5f / pixelsPerCell;
+    transform.view = glm::translate(glm::mat4(1.0f), glm::vec3(-position.x, -position.y, 0.0f));
+    transform.projection = glm::ortho(-halfWidth, halfWidth, -halfHeight, halfHeight, -1.0f, 1.0f);
+    transform.viewProjection = transform.projection * transform.view;
+    transform.inverseViewProjection = glm::inverse(transform.viewProjection);
+
+    // 화면 중심이 카메라 위치, 스크린 Y는 아래로 / 월드 Y는 위로 증가
+    transform.screenToWorldScale = glm::vec2(1.0f / pixelsPerCell, -1.0f / pixelsPerCell);
+    transform.screenToWorldOffset = position + glm::vec2(-halfWidth, halfHeight);
+    transform.worldToScreenScale = glm::vec2(pixelsPerCell, -pixelsPerCell);
+    transform.worldToScreenOffset = screenSize * 0.5f - position * transform.worldToScreenScale;
+
+    transform.visibleBounds = transform.ScreenRectToWorld(glm::vec2(0.0f), screenSize);
+    return transform;
+}
+
+glm::ivec2 ViewTransform::WorldToGrid(const glm::vec2& worldPos) {
+    return glm::ivec2(static_cast<int>(std::floor(worldPos.x)), static_cast<int>(std::floor(worldPos.y)));
+}
+
+void ViewTransform::ScreenToWorldBatch(const glm::vec2* screenPos, glm::vec2* worldPos, size_t count) const {
+    AffineBatch(screenPos, worldPos, count, screenToWorldScale, screenToWorldOffset);
+}
+
+void ViewTransform::WorldToScreenBatch(const glm::vec2* worldPos, glm::vec2* screenPos, size_t count) const {
+    AffineBatch(worldPos, screenPos, count, worldToScreenScale, worldToScreenOffset);
+}
+
+void ViewTransform::WorldToGridBatch(const glm::vec2* worldPos, glm::ivec2* gridPos, size_t count) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const float* src = reinterpret_cast<const float*>(worldPos);
+    __m128i* dst = reinterpret_cast<__m128i*>(gridPos);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_si128(dst + i / 2, Floor2(_mm_loadu_ps(src + i * 2)));
+    }
+#endif
+    for (; i < count; ++i) {
+        gridPos[i] = WorldToGrid(worldPos[i]);
+    }
+}
+
+void ViewTransform::ScreenToGridBatch(const glm::vec2* screenPos, glm::ivec2* gridPos, size_t count) const {
+    size_t i = 0;
+#ifdef __SSE2__
+    // 월드 좌표를 거쳐 메모리에 쓰지 않고 레지스터 안에서 바로 셀로 내림
+    const float* src = reinterpret_cast<const float*>(screenPos);
+    __m128i* dst = reinterpret_cast<__m128i*>(gridPos);
+    const __m128 scale2 = _mm_setr_ps(screenToWorldScale.x, screenToWorldScale.y,
+                                      screenToWorldScale.x, screenToWorldScale.y);
+    const __m128 offset2 = _mm_setr_ps(screenToWorldOffset.x, screenToWorldOffset.y,
+                                       screenToWorldOffset.x, screenToWorldOffset.y);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_si128(dst + i / 2, Floor2(Affine2(_mm_loadu_ps(src + i * 2), scale2, offset2)));
+    }
+#endif
+    for (; i < count; ++i) {
+        gridPos[i] = ScreenToGrid(screenPos[i]);
+    }
+}
+
+glm::vec4 ViewTransform::ScreenRectToWorld(const glm::vec2& cornerA, const glm::vec2& cornerB) const {
+    glm::vec2 a = ScreenToWorld(cornerA);
+    glm::vec2 b = ScreenToWorld(cornerB);
+    return glm::vec4(std::min(a.x, b.x), std::min(a.y, b.y), std::max(a.x, b.x), std::max(a.y, b.y));
+}
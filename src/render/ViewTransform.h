@@ -0,0 +1,55 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// 카메라 상태 하나에 대한 화면/월드/그리드 변환 스냅샷 (Camera::GetTransform이 만들고 공유)
+// - 카메라가 바뀔 때만 다시 만들어지고, 만들어진 뒤에는 바뀌지 않음
+//   → 렌더러/입력/히트 검사가 같은 프레임에서 같은 값을 보고, 행렬 곱/역행렬을 각자 다시 계산하지 않음
+// - 직교 투영 + 평행 이동뿐이라 화면<->월드는 축마다 (배율, 오프셋) 한 쌍으로 표현됨
+// - *Batch 함수는 점 배열을 한 번에 변환 (SSE2가 있으면 두 점씩), 입력과 출력이 같은 배열이어도 됨
+// - 그리드 셀 한 칸 = 월드 1.0, 셀 좌표는 floor (음수 좌표도 올바른 셀)
+struct ViewTransform {
+    glm::mat4 view{1.0f};
+    glm::mat4 projection{1.0f};
+    glm::mat4 viewProjection{1.0f};
+    glm::mat4 inverseViewProjection{1.0f};
+
+    glm::vec2 screenSize{0.0f};
+    float pixelsPerCell = 1.0f;
+
+    // world = screen * screenToWorldScale + screenToWorldOffset (Y축 반전 포함)
+    glm::vec2 screenToWorldScale{1.0f};
+    glm::vec2 screenToWorldOffset{0.0f};
+    glm::vec2 worldToScreenScale{1.0f};
+    glm::vec2 worldToScreenOffset{0.0f};
+
+    // 화면에 보이는 월드 범위 (minX, minY, maxX, maxY)
+    glm::vec4 visibleBounds{0.0f};
+
+    // 만든 카메라의 변경 번호 (같으면 같은 변환)
+    uint32_t version = 0;
+
+    static ViewTransform Build(const glm::vec2& position, float pixelsPerCell,
+                               const glm::vec2& screenSize, uint32_t version);
+
+    glm::vec2 ScreenToWorld(const glm::vec2& screenPos) const {
+        return screenPos * screenToWorldScale + screenToWorldOffset;
+    }
+    glm::vec2 WorldToScreen(const glm::vec2& worldPos) const {
+        return worldPos * worldToScreenScale + worldToScreenOffset;
+    }
+    static glm::ivec2 WorldToGrid(const glm::vec2& worldPos);
+    glm::ivec2 ScreenToGrid(const glm::vec2& screenPos) const {
+        return WorldToGrid(ScreenToWorld(screenPos));
+    }
+
+    void ScreenToWorldBatch(const glm::vec2* screenPos, glm::vec2* worldPos, size_t count) const;
+    void WorldToScreenBatch(const glm::vec2* worldPos, glm::vec2* screenPos, size_t count) const;
+    static void WorldToGridBatch(const glm::vec2* worldPos, glm::ivec2* gridPos, size_t count);
+    void ScreenToGridBatch(const glm::vec2* screenPos, glm::ivec2* gridPos, size_t count) const;
+
+    // 화면 사각형(선택 영역 등)의 두 꼭짓점 -> 월드 범위 (minX, minY, maxX, maxY)
+    glm::vec4 ScreenRectToWorld(const glm::vec2& cornerA, const glm::vec2& cornerB) const;
+};
@@ -1,8 +1,37 @@
 #include "WireRenderer.h"
+#include "GLState.h"
+#include "../utils/JobSystem.h"
+#include "../utils/Profiler.h"
 #include <iostream>
 #include <algorithm>
+#include <bit>
 #include <cmath>
 
+namespace {
+
+// 셰이더 유니폼 (이름 등록은 정적 초기화 때 한 번)
+const UniformId U_VIEW_PROJECTION("uViewProjection");
+const UniformId U_SIGNAL_BITS("uSignalBits");
+const UniformId U_SIGNAL_SLOT("uSignalSlot");
+const UniformId U_PROJECTION("uProjection");
+const UniformId U_VIEW("uView");
+const UniformId U_SIGNALS("uSignals");
+const UniformId U_TOGGLE_TIMES("uToggleTimes");
+const UniformId U_PULSE_SPEED("uPulseSpeed");
+const UniformId U_PULSE_LENGTH("uPulseLength");
+const UniformId U_LOW_COLOR("uLowColor");
+const UniformId U_HIGH_COLOR("uHighColor");
+const UniformId U_USE_OVERRIDE_COLOR("uUseOverrideColor");
+const UniformId U_TIME("uTime");
+const UniformId U_ANIMATED("uAnimated");
+const UniformId U_ANIMATION_SPEED("uAnimationSpeed");
+const UniformId U_MVP("uMVP");
+const UniformId U_COLOR("uColor");
+const UniformId U_OFFSET("uOffset");
+const UniformId U_OVERRIDE_COLOR("uOverrideColor");
+
+} // namespace
+
 WireRenderer::WireRenderer()
     : m_vao(0)
     , m_vbo(0)
@@ -10,8 +39,16 @@ WireRenderer::WireRenderer()
     , m_vboJoint(0)
     , m_lineWidth(2.0f)
     , m_antialiasing(true)
-    , m_animationTime(0.0f)
+    , m_time(0.0f)
+    , m_signalAnimation(true)
     , m_maxVertices(100000)
+    , m_cachedWires(nullptr)
+    , m_chunkSetRevision(0)
+    , m_staging(1)
+    , m_jobs(nullptr)
+    , m_signalTexture(0)
+    , m_signalSlotCapacity(0)
+    , m_nextSignalSlot(0)
     , m_initialized(false) {
 }
 
@@ -27,16 +64,21 @@ bool WireRenderer::Initialize() {
     glGenVertexArrays(1, &m_vao);
     glGenBuffers(1, &m_vbo);
     
-    glBindVertexArray(m_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-    glBufferData(GL_ARRAY_BUFFER, m_maxVertices * 6 * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+    GLState::BindVertexArray(m_vao);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, m_maxVertices * WIRE_VERTEX_FLOATS * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
     
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    // 정점마다 (위치, 넷 번호, 거리): 색과 펄스는 셰이더가 신호 텍스처에서 결정
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, WIRE_VERTEX_FLOATS * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(2 * sizeof(float)));
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, WIRE_VERTEX_FLOATS * sizeof(float), (void*)(2 * sizeof(float)));
     glEnableVertexAttribArray(1);
     
+    // 경로 시작점부터의 거리 (신호 펄스 위치 계산용)
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, WIRE_VERTEX_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    
     const int jointSegments = 8;
     std::vector<float> jointVertices;
     jointVertices.reserve((jointSegments + 2) * 2);
@@ -53,19 +95,19 @@ bool WireRenderer::Initialize() {
     glGenVertexArrays(1, &m_vaoJoint);
     glGenBuffers(1, &m_vboJoint);
     
-    glBindVertexArray(m_vaoJoint);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboJoint);
+    GLState::BindVertexArray(m_vaoJoint);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_vboJoint);
     glBufferData(GL_ARRAY_BUFFER, jointVertices.size() * sizeof(float), 
                 jointVertices.data(), GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
     
     SetupShaders();
     
-    m_vertexBuffer.reserve(m_maxVertices * 6);
+    m_vertexBuffer.reserve(m_maxVertices * WIRE_VERTEX_FLOATS);
     
     m_initialized = true;
     return true;
@@ -76,13 +118,16 @@ void WireRenderer::Cleanup() {
         return;
     }
     
-    if (m_vao) glDeleteVertexArrays(1, &m_vao);
-    if (m_vbo) glDeleteBuffers(1, &m_vbo);
-    if (m_vaoJoint) glDeleteVertexArrays(1, &m_vaoJoint);
-    if (m_vboJoint) glDeleteBuffers(1, &m_vboJoint);
+    if (m_vao) GLState::DeleteVertexArray(m_vao);
+    if (m_vbo) GLState::DeleteBuffer(m_vbo);
+    if (m_vaoJoint) GLState::DeleteVertexArray(m_vaoJoint);
+    if (m_vboJoint) GLState::DeleteBuffer(m_vboJoint);
+    
+    ReleaseCellWireCache();
     
     m_wireShader.reset();
     m_jointShader.reset();
+    m_cellWireShader.reset();
     
     m_initialized = false;
 }
@@ -92,16 +137,38 @@ void WireRenderer::SetupShaders() {
 #version 330 core
 
 layout (location = 0) in vec2 aPos;
-layout (location = 1) in vec4 aColor;
+layout (location = 1) in float aNet;
+layout (location = 2) in float aDistance;
 
 uniform mat4 uProjection;
 uniform mat4 uView;
+uniform usamplerBuffer uSignals;
+uniform samplerBuffer uToggleTimes;
+uniform float uTime;
+uniform vec4 uLowColor;
+uniform vec4 uHighColor;
+uniform bool uUseOverrideColor;
+uniform vec4 uOverrideColor;
 
 out vec4 WireColor;
+out float Distance;
+flat out float ToggleAge;
 
 void main() {
     gl_Position = uProjection * uView * vec4(aPos, 0.0, 1.0);
-    WireColor = aColor;
+    Distance = aDistance;
+    
+    if (uUseOverrideColor) {
+        WireColor = uOverrideColor;
+        ToggleAge = 1.0e6;
+        return;
+    }
+    
+    // 구동 게이트의 넷 비트 (넷 0은 구동 게이트 없음 = 항상 LOW)
+    uint net = uint(aNet);
+    bool high = ((texelFetch(uSignals, int(net >> 5u)).r >> (net & 31u)) & 1u) != 0u;
+    WireColor = high ? uHighColor : uLowColor;
+    ToggleAge = net == 0u ? 1.0e6 : uTime - texelFetch(uToggleTimes, int(net)).r;
 }
 )";
 
@@ -109,10 +176,14 @@ void main() {
 #version 330 core
 
 in vec4 WireColor;
+in float Distance;
+flat in float ToggleAge;
 
 uniform float uTime;
 uniform bool uAnimated;
 uniform float uAnimationSpeed;
+uniform float uPulseSpeed;      // 셀/초
+uniform float uPulseLength;     // 셀
 
 out vec4 FragColor;
 
@@ -124,6 +195,12 @@ void main() {
         color.rgb = mix(color.rgb, vec3(1.0, 1.0, 0.0), pulse * 0.3);
     }
     
+    // 토글 후 펄스 머리가 시작점에서 uPulseSpeed로 이동, 뒤로 uPulseLength만큼 꼬리
+    float behind = ToggleAge * uPulseSpeed - Distance;
+    if (behind >= 0.0 && behind < uPulseLength) {
+        color.rgb = mix(color.rgb, vec3(1.0, 1.0, 0.6), 0.7 * (1.0 - behind / uPulseLength));
+    }
+    
     FragColor = color;
 }
 )";
@@ -162,10 +239,406 @@ void main() {
     if (!m_jointShader->LoadFromSource(jointVertexShader, jointFragmentShader)) {
         std::cerr << "Failed to compile joint shader!" << std::endl;
     }
+    
+    const char* cellWireVertexShader = R"(
+#version 330 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in uvec2 aCell;
+layout (location = 2) in uint aKind;
+
+uniform mat4 uViewProjection;
+uniform usampler2D uSignalBits;
+uniform int uSignalSlot;
+
+out vec4 WireColor;
+
+void main() {
+    gl_Position = uViewProjection * vec4(aPos, 0.0, 1.0);
+    
+    if (aKind == 1u) {
+        WireColor = vec4(0.5, 0.5, 0.5, 1.0);  // 접점
+        return;
+    }
+    
+    // 슬롯의 aCell.y번째 행 마스크에서 aCell.x 비트가 HIGH 여부
+    ivec2 texel = ivec2((uSignalSlot % 32) * 32 + int(aCell.y), uSignalSlot / 32);
+    uint bits = texelFetch(uSignalBits, texel, 0).r;
+    bool high = ((bits >> aCell.x) & 1u) != 0u;
+    WireColor = high ? vec4(1.0, 0.2, 0.2, 1.0) : vec4(0.4, 0.4, 0.4, 1.0);
+}
+)";
+
+    const char* cellWireFragmentShader = R"(
+#version 330 core
+
+in vec4 WireColor;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = WireColor;
+}
+)";
+
+    m_cellWireShader = std::make_unique<ShaderProgram>();
+    if (!m_cellWireShader->LoadFromSource(cellWireVertexShader, cellWireFragmentShader)) {
+        std::cerr << "Failed to compile cell wire shader!" << std::endl;
+    }
+}
+
+template<typename Fn>
+void WireRenderer::ForEachVisibleChunk(const CellWireManager& cellWires, const Camera& camera, Fn&& fn) const {
+    const auto& chunks = cellWires.getChunks();
+    
+    // 와이어는 셀 안에만 그려지므로 여유 없이 가시 범위만
+    glm::ivec2 minChunk, maxChunk;
+    VisibleChunkRange(camera.GetVisibleBounds(), 1.0f, 0.0f, minChunk, maxChunk);
+    
+    const uint64_t rangeChunks = static_cast<uint64_t>(maxChunk.x - minChunk.x + 1) *
+                                 static_cast<uint64_t>(maxChunk.y - minChunk.y + 1);
+    
+    // 가시 범위가 실제 청크 수보다 작으면 좌표로 조회, 아니면 있는 청크만 순회
+    if (rangeChunks <= chunks.size()) {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                if (const auto* chunk = cellWires.getChunk(glm::ivec2(cx, cy))) {
+                    fn(*chunk);
+                }
+            }
+        }
+    } else {
+        for (const auto& [key, chunk] : chunks) {
+            if (chunk.coord.x >= minChunk.x && chunk.coord.x <= maxChunk.x &&
+                chunk.coord.y >= minChunk.y && chunk.coord.y <= maxChunk.y) {
+                fn(chunk);
+            }
+        }
+    }
 }
 
-void WireRenderer::RenderWires(const std::vector<RenderWire>& wires, const Camera& camera) {
-    if (wires.empty() || !m_wireShader || !m_jointShader) {
+void WireRenderer::RecordCellWires(const CellWireManager& cellWires, const Camera& camera,
+                                   RenderCommandList& commands) {
+    m_stats = WireRenderStats{};
+    
+    if (m_cachedWires != &cellWires) {
+        ReleaseCellWireCache();
+        m_cachedWires = &cellWires;
+        m_chunkSetRevision = cellWires.getChunkSetRevision() - 1;
+    }
+    
+    // 청크가 생기거나 사라졌을 때만 없어진 청크의 메시를 정리
+    if (m_chunkSetRevision != cellWires.getChunkSetRevision()) {
+        for (auto it = m_chunkMeshes.begin(); it != m_chunkMeshes.end();) {
+            if (cellWires.getChunk(it->second.coord) == nullptr) {
+                if (it->second.vao) GLState::DeleteVertexArray(it->second.vao);
+                if (it->second.vbo) GLState::DeleteBuffer(it->second.vbo);
+                m_freeSignalSlots.push_back(it->second.signalSlot);
+                it = m_chunkMeshes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        m_chunkSetRevision = cellWires.getChunkSetRevision();
+    }
+    
+    if (cellWires.getChunks().empty()) {
+        return;
+    }
+    
+    // 새로 보이는 청크의 GPU 객체와 신호 슬롯을 먼저 확보
+    // (신호 텍스처가 커지면 새 텍스처로 바뀌므로 명령 기록 전에 끝내야 함)
+    m_visibleMeshes.clear();
+    ForEachVisibleChunk(cellWires, camera, [&](const CellWireManager::WireChunk& chunk) {
+        ChunkMesh& mesh = m_chunkMeshes[RenderChunkKey(chunk.coord)];
+        if (mesh.signalSlot == INVALID_SIGNAL_SLOT) {
+            CreateChunkMesh(chunk, mesh);
+        }
+        m_visibleMeshes.push_back({&chunk, &mesh});
+    });
+    
+    if (m_visibleMeshes.empty()) {
+        return;
+    }
+    
+    commands.UseShader(m_cellWireShader.get());
+    commands.SetUniform(U_VIEW_PROJECTION, camera.GetViewProjectionMatrix());
+    commands.SetUniform(U_SIGNAL_BITS, 0);
+    commands.BindTexture(0, TextureTarget::Texture2D, m_signalTexture);
+    commands.SetLineWidth(m_lineWidth);
+    
+    if (m_antialiasing) {
+        commands.SetLineSmooth(true);
+    }
+    
+    RebuildChunkMeshes(commands);
+    
+    for (const auto& [chunk, mesh] : m_visibleMeshes) {
+        if (mesh->signalRevision != chunk->signalRevision) {
+            UploadChunkSignals(*chunk, *mesh, commands);
+            mesh->signalRevision = chunk->signalRevision;
+            m_stats.signalUploads++;
+        }
+        
+        commands.SetUniform(U_SIGNAL_SLOT, static_cast<int>(mesh->signalSlot));
+        if (mesh->lineVertices > 0) {
+            commands.Draw(mesh->vao, PrimitiveType::Lines, 0, static_cast<uint32_t>(mesh->lineVertices));
+            m_stats.drawCalls++;
+        }
+        if (mesh->jointVertices > 0) {
+            commands.Draw(mesh->vao, PrimitiveType::Triangles, static_cast<uint32_t>(mesh->lineVertices),
+                          static_cast<uint32_t>(mesh->jointVertices));
+            m_stats.drawCalls++;
+        }
+        m_stats.vertices += static_cast<size_t>(mesh->lineVertices + mesh->jointVertices);
+        m_stats.chunks++;
+    }
+    
+    if (m_antialiasing) {
+        commands.SetLineSmooth(false);
+    }
+    
+    commands.BindTexture(0, TextureTarget::Texture2D, 0);
+}
+
+void WireRenderer::AppendLodTiles(const CellWireManager& cellWires, const Camera& camera,
+                                  std::vector<ChunkTile>& tiles) const {
+    constexpr int CHUNK_SIZE = CellWireManager::CHUNK_SIZE;
+    constexpr float CELLS_PER_CHUNK = static_cast<float>(CHUNK_SIZE * CHUNK_SIZE);
+    
+    ForEachVisibleChunk(cellWires, camera, [&](const CellWireManager::WireChunk& chunk) {
+        if (chunk.count == 0) {
+            return;
+        }
+        uint32_t high = 0;
+        for (uint32_t bits : chunk.signalBits) {
+            high += static_cast<uint32_t>(std::popcount(bits));
+        }
+        
+        ChunkTile tile;
+        tile.origin = glm::vec2(static_cast<float>(chunk.coord.x * CHUNK_SIZE),
+                                static_cast<float>(chunk.coord.y * CHUNK_SIZE));
+        tile.density = static_cast<float>(chunk.count) / CELLS_PER_CHUNK;
+        tile.activity = static_cast<float>(high) / static_cast<float>(chunk.count);
+        tiles.push_back(tile);
+    });
+}
+
+void WireRenderer::CreateChunkMesh(const CellWireManager::WireChunk& chunk, ChunkMesh& mesh) {
+    mesh.coord = chunk.coord;
+    mesh.signalSlot = AllocateSignalSlot();
+    
+    // 헤드리스(초기화 전)에서는 GPU 객체 없이 명령만 기록
+    if (!m_initialized) {
+        return;
+    }
+    
+    // 정점 형식은 버퍼 크기와 무관하므로 생성 시 한 번만 지정
+    glGenVertexArrays(1, &mesh.vao);
+    glGenBuffers(1, &mesh.vbo);
+    GLState::BindVertexArray(mesh.vao);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+    
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(CellWireVertex),
+                          (void*)offsetof(CellWireVertex, position));
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(1, 2, GL_UNSIGNED_BYTE, sizeof(CellWireVertex),
+                           (void*)offsetof(CellWireVertex, cellX));
+    glEnableVertexAttribArray(1);
+    glVertexAttribIPointer(2, 1, GL_UNSIGNED_BYTE, sizeof(CellWireVertex),
+                           (void*)offsetof(CellWireVertex, kind));
+    glEnableVertexAttribArray(2);
+    
+    GLState::BindVertexArray(0);
+}
+
+MemoryUsage WireRenderer::GetMemoryUsage() const {
+    MemoryUsage usage = MemoryStats::Measure(m_vertexBuffer);
+    usage += MemoryStats::Measure(m_chunkMeshes);
+    usage += MemoryStats::Measure(m_visibleMeshes);
+    usage += MemoryStats::Measure(m_buildJobs);
+    usage += MemoryStats::Measure(m_staging);
+    for (const ChunkStaging& staging : m_staging) {
+        usage += MemoryStats::Measure(staging.vertices);
+        usage += MemoryStats::Measure(staging.joints);
+    }
+    usage += MemoryStats::Measure(m_freeSignalSlots);
+    usage += MemoryStats::Measure(m_signalWords);
+    return usage;
+}
+
+void WireRenderer::SetJobSystem(JobSystem* jobs) {
+    m_jobs = jobs;
+    m_staging.resize(jobs ? jobs->GetWorkerCount() : 1);
+}
+
+void WireRenderer::RebuildChunkMeshes(RenderCommandList& commands) {
+    m_buildJobs.clear();
+    for (const auto& [chunk, mesh] : m_visibleMeshes) {
+        if (mesh->geometryRevision != chunk->geometryRevision) {
+            m_buildJobs.push_back({chunk, mesh, 0, 0, 0, 0});
+        }
+    }
+    if (m_buildJobs.empty()) {
+        return;
+    }
+    
+    for (ChunkStaging& staging : m_staging) {
+        staging.vertices.clear();
+    }
+    
+    // 정점 생성은 워커 풀에서 청크 단위로 나누고, GL 업로드 기록만 이 스레드에서 함
+    auto build = [this](size_t index, unsigned worker) {
+        PROFILE_SCOPE("WireRenderer::BuildChunkVertices");
+        ChunkBuildJob& job = m_buildJobs[index];
+        job.worker = worker;
+        BuildChunkVertices(*job.chunk, m_staging[worker], job);
+    };
+    if (m_jobs) {
+        m_jobs->ParallelFor(m_buildJobs.size(), build);
+    } else {
+        for (size_t i = 0; i < m_buildJobs.size(); ++i) {
+            build(i, 0);
+        }
+    }
+    
+    for (const ChunkBuildJob& job : m_buildJobs) {
+        const size_t vertices = static_cast<size_t>(job.lineVertices + job.jointVertices);
+        const CellWireVertex* data = m_staging[job.worker].vertices.data() + job.offset;
+        commands.ReallocateBuffer(job.mesh->vbo, vertices * sizeof(CellWireVertex), data, false);
+        
+        job.mesh->lineVertices = job.lineVertices;
+        job.mesh->jointVertices = job.jointVertices;
+        job.mesh->geometryRevision = job.chunk->geometryRevision;
+    }
+    m_stats.rebuiltChunks += m_buildJobs.size();
+}
+
+void WireRenderer::BuildChunkVertices(const CellWireManager::WireChunk& chunk, ChunkStaging& staging,
+                                      ChunkBuildJob& job) {
+    constexpr int CHUNK_SIZE = CellWireManager::CHUNK_SIZE;
+    constexpr float JOINT = 0.05f;
+    
+    std::vector<CellWireVertex>& lines = staging.vertices;
+    std::vector<CellWireVertex>& joints = staging.joints;
+    job.offset = lines.size();
+    joints.clear();
+    
+    const glm::vec2 base(static_cast<float>(chunk.coord.x * CHUNK_SIZE), 
+                         static_cast<float>(chunk.coord.y * CHUNK_SIZE));
+    
+    for (int y = 0; y < CHUNK_SIZE; ++y) {
+        uint32_t bits = chunk.occupancy[y];
+        while (bits) {
+            int x = std::countr_zero(bits);
+            bits &= bits - 1;
+            
+            const CellWire& cell = chunk.cells[y * CHUNK_SIZE + x];
+            const glm::vec2 center = base + glm::vec2(x + 0.5f, y + 0.5f);
+            const uint8_t cx = static_cast<uint8_t>(x);
+            const uint8_t cy = static_cast<uint8_t>(y);
+            
+            // 연결 방향마다 셀 중앙에서 경계까지 선분 (Down은 y+1)
+            auto addHalfSegment = [&](WireDirection dir, glm::vec2 offset) {
+                if (cell.hasConnection(dir)) {
+                    lines.push_back({center, cx, cy, 0, 0});
+                    lines.push_back({center + offset, cx, cy, 0, 0});
+                }
+            };
+            addHalfSegment(WireDirection::Up, glm::vec2(0.0f, -0.5f));
+            addHalfSegment(WireDirection::Down, glm::vec2(0.0f, 0.5f));
+            addHalfSegment(WireDirection::Left, glm::vec2(-0.5f, 0.0f));
+            addHalfSegment(WireDirection::Right, glm::vec2(0.5f, 0.0f));
+            
+            // 중앙 접점 (작은 사각형)
+            const glm::vec2 p0 = center + glm::vec2(-JOINT, -JOINT);
+            const glm::vec2 p1 = center + glm::vec2(JOINT, -JOINT);
+            const glm::vec2 p2 = center + glm::vec2(JOINT, JOINT);
+            const glm::vec2 p3 = center + glm::vec2(-JOINT, JOINT);
+            for (const glm::vec2& p : {p0, p1, p2, p2, p3, p0}) {
+                joints.push_back({p, cx, cy, 1, 0});
+            }
+        }
+    }
+    
+    job.lineVertices = static_cast<GLsizei>(lines.size() - job.offset);
+    job.jointVertices = static_cast<GLsizei>(joints.size());
+    lines.insert(lines.end(), joints.begin(), joints.end());
+}
+
+void WireRenderer::UploadChunkSignals(const CellWireManager::WireChunk& chunk, const ChunkMesh& mesh,
+                                      RenderCommandList& commands) {
+    constexpr uint32_t ROWS = CellWireManager::CHUNK_SIZE;
+    uint32_t* words = &m_signalWords[static_cast<size_t>(mesh.signalSlot) * ROWS];
+    std::copy(chunk.signalBits.begin(), chunk.signalBits.end(), words);
+    
+    commands.UpdateTexture(m_signalTexture,
+                           static_cast<int>((mesh.signalSlot % SIGNAL_SLOTS_PER_ROW) * ROWS),
+                           static_cast<int>(mesh.signalSlot / SIGNAL_SLOTS_PER_ROW),
+                           ROWS, 1, words);
+}
+
+uint32_t WireRenderer::AllocateSignalSlot() {
+    if (!m_freeSignalSlots.empty()) {
+        uint32_t slot = m_freeSignalSlots.back();
+        m_freeSignalSlots.pop_back();
+        return slot;
+    }
+    
+    if (m_nextSignalSlot >= m_signalSlotCapacity) {
+        GrowSignalTexture(m_nextSignalSlot + 1);
+    }
+    return m_nextSignalSlot++;
+}
+
+void WireRenderer::GrowSignalTexture(uint32_t minSlots) {
+    uint32_t capacity = std::max<uint32_t>(minSlots, std::max<uint32_t>(m_signalSlotCapacity * 2, 256));
+    capacity = (capacity + SIGNAL_SLOTS_PER_ROW - 1) / SIGNAL_SLOTS_PER_ROW * SIGNAL_SLOTS_PER_ROW;
+    m_signalWords.resize(static_cast<size_t>(capacity) * CellWireManager::CHUNK_SIZE, 0);
+    m_signalSlotCapacity = capacity;
+    
+    if (!m_initialized) {
+        return;
+    }
+    
+    // 새 텍스처에 CPU 사본 전체를 올림 (기존 슬롯 내용 유지)
+    if (m_signalTexture) {
+        glDeleteTextures(1, &m_signalTexture);
+    }
+    glGenTextures(1, &m_signalTexture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_signalTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, SIGNAL_TEXTURE_WIDTH, 
+                 static_cast<GLsizei>(capacity / SIGNAL_SLOTS_PER_ROW), 0,
+                 GL_RED_INTEGER, GL_UNSIGNED_INT, m_signalWords.data());
+}
+
+void WireRenderer::ReleaseCellWireCache() {
+    for (auto& [key, mesh] : m_chunkMeshes) {
+        if (mesh.vao) GLState::DeleteVertexArray(mesh.vao);
+        if (mesh.vbo) GLState::DeleteBuffer(mesh.vbo);
+    }
+    m_chunkMeshes.clear();
+    
+    if (m_signalTexture) {
+        glDeleteTextures(1, &m_signalTexture);
+        m_signalTexture = 0;
+    }
+    m_signalSlotCapacity = 0;
+    m_nextSignalSlot = 0;
+    m_freeSignalSlots.clear();
+    m_signalWords.clear();
+    m_visibleMeshes.clear();
+    m_cachedWires = nullptr;
+}
+
+void WireRenderer::RecordWires(const std::vector<RenderWire>& wires, const Camera& camera,
+                               const SignalStateBuffer& signals, RenderCommandList& commands) {
+    if (wires.empty()) {
         return;
     }
     
@@ -178,22 +651,21 @@ void WireRenderer::RenderWires(const std::vector<RenderWire>& wires, const Camer
         WirePath path;
         CalculatePath(wire, path);
         
-        glm::vec4 color = GetWireColor(wire);
+        const float net = static_cast<float>(wire.net);
+        float distance = 0.0f;
         
         for (size_t i = 0; i < path.points.size() - 1; i++) {
             m_vertexBuffer.push_back(path.points[i].x);
             m_vertexBuffer.push_back(path.points[i].y);
-            m_vertexBuffer.push_back(color.r);
-            m_vertexBuffer.push_back(color.g);
-            m_vertexBuffer.push_back(color.b);
-            m_vertexBuffer.push_back(color.a);
+            m_vertexBuffer.push_back(net);
+            m_vertexBuffer.push_back(distance);
+            
+            distance += glm::length(path.points[i + 1] - path.points[i]);
             
             m_vertexBuffer.push_back(path.points[i + 1].x);
             m_vertexBuffer.push_back(path.points[i + 1].y);
-            m_vertexBuffer.push_back(color.r);
-            m_vertexBuffer.push_back(color.g);
-            m_vertexBuffer.push_back(color.b);
-            m_vertexBuffer.push_back(color.a);
+            m_vertexBuffer.push_back(net);
+            m_vertexBuffer.push_back(distance);
         }
         
         joints.push_back(path.points.front());
@@ -205,49 +677,50 @@ void WireRenderer::RenderWires(const std::vector<RenderWire>& wires, const Camer
     }
     
     if (!m_vertexBuffer.empty()) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, 
-                       m_vertexBuffer.size() * sizeof(float),
-                       m_vertexBuffer.data());
+        commands.UpdateBuffer(m_vbo, 0, m_vertexBuffer.size() * sizeof(float), m_vertexBuffer.data());
         
-        m_wireShader->Use();
-        m_wireShader->SetUniform("uProjection", camera.GetProjectionMatrix());
-        m_wireShader->SetUniform("uView", camera.GetViewMatrix());
-        m_wireShader->SetUniform("uTime", m_animationTime);
-        m_wireShader->SetUniform("uAnimated", false);
-        m_wireShader->SetUniform("uAnimationSpeed", 3.0f);
+        commands.BindTexture(1, TextureTarget::Buffer, signals.GetTexture());
+        commands.BindTexture(2, TextureTarget::Buffer, signals.GetToggleTexture());
         
-        glBindVertexArray(m_vao);
-        glLineWidth(m_lineWidth);
+        commands.UseShader(m_wireShader.get());
+        commands.SetUniform(U_PROJECTION, camera.GetProjectionMatrix());
+        commands.SetUniform(U_VIEW, camera.GetViewMatrix());
+        commands.SetUniform(U_SIGNALS, 1);
+        commands.SetUniform(U_TOGGLE_TIMES, 2);
+        commands.SetUniform(U_PULSE_SPEED, 12.0f);
+        commands.SetUniform(U_PULSE_LENGTH, m_signalAnimation ? 1.5f : 0.0f);
+        commands.SetUniform(U_LOW_COLOR, glm::vec4(0.4f, 0.4f, 0.4f, 1.0f));   // 회색 (신호 없음)
+        commands.SetUniform(U_HIGH_COLOR, glm::vec4(1.0f, 0.2f, 0.2f, 1.0f));  // 빨간색 (신호 있음)
+        commands.SetUniform(U_USE_OVERRIDE_COLOR, 0);
+        commands.SetUniform(U_TIME, signals.GetTime());
+        commands.SetUniform(U_ANIMATED, 0);
+        commands.SetUniform(U_ANIMATION_SPEED, 3.0f);
+        commands.SetLineWidth(m_lineWidth);
         
         if (m_antialiasing) {
-            glEnable(GL_LINE_SMOOTH);
-            glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
+            commands.SetLineSmooth(true);
         }
         
-        glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(m_vertexBuffer.size() / 6));
+        commands.Draw(m_vao, PrimitiveType::Lines, 0,
+                      static_cast<uint32_t>(m_vertexBuffer.size() / WIRE_VERTEX_FLOATS));
         
         if (m_antialiasing) {
-            glDisable(GL_LINE_SMOOTH);
+            commands.SetLineSmooth(false);
         }
+        commands.BindTexture(2, TextureTarget::Buffer, 0);
+        commands.BindTexture(1, TextureTarget::Buffer, 0);
     }
     
     if (!joints.empty()) {
-        m_jointShader->Use();
-        m_jointShader->SetUniform("uMVP", camera.GetViewProjectionMatrix());
-        
-        glBindVertexArray(m_vaoJoint);
+        commands.UseShader(m_jointShader.get());
+        commands.SetUniform(U_MVP, camera.GetViewProjectionMatrix());
+        commands.SetUniform(U_COLOR, glm::vec4(0.5f, 0.5f, 0.5f, 1.0f));
         
         for (const auto& joint : joints) {
-            m_jointShader->SetUniform("uOffset", joint);
-            m_jointShader->SetUniform("uColor", glm::vec4(0.5f, 0.5f, 0.5f, 1.0f));
-            glDrawArrays(GL_TRIANGLE_FAN, 0, 10);
+            commands.SetUniform(U_OFFSET, joint);
+            commands.Draw(m_vaoJoint, PrimitiveType::TriangleFan, 0, 10);
         }
     }
-    
-    glBindVertexArray(0);
-    
-    m_animationTime += 0.016f;
 }
 
 void WireRenderer::RenderDraggingWire(const glm::vec2& start, const glm::vec2& end, 
@@ -264,51 +737,48 @@ void WireRenderer::RenderDraggingWire(const glm::vec2& start, const glm::vec2& e
     for (size_t i = 0; i < path.size() - 1; i++) {
         m_vertexBuffer.push_back(path[i].x);
         m_vertexBuffer.push_back(path[i].y);
-        m_vertexBuffer.push_back(color.r);
-        m_vertexBuffer.push_back(color.g);
-        m_vertexBuffer.push_back(color.b);
-        m_vertexBuffer.push_back(color.a);
+        m_vertexBuffer.push_back(0.0f);
+        m_vertexBuffer.push_back(0.0f);
         
         m_vertexBuffer.push_back(path[i + 1].x);
         m_vertexBuffer.push_back(path[i + 1].y);
-        m_vertexBuffer.push_back(color.r);
-        m_vertexBuffer.push_back(color.g);
-        m_vertexBuffer.push_back(color.b);
-        m_vertexBuffer.push_back(color.a);
+        m_vertexBuffer.push_back(0.0f);
+        m_vertexBuffer.push_back(0.0f);
     }
     
     if (!m_vertexBuffer.empty()) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+        GLState::BindBuffer(GL_ARRAY_BUFFER, m_vbo);
         glBufferSubData(GL_ARRAY_BUFFER, 0, 
                        m_vertexBuffer.size() * sizeof(float),
                        m_vertexBuffer.data());
         
         m_wireShader->Use();
-        m_wireShader->SetUniform("uProjection", camera.GetProjectionMatrix());
-        m_wireShader->SetUniform("uView", camera.GetViewMatrix());
-        m_wireShader->SetUniform("uAnimated", true);
-        m_wireShader->SetUniform("uTime", m_animationTime);
-        m_wireShader->SetUniform("uAnimationSpeed", 5.0f);
+        m_wireShader->SetUniform(U_PROJECTION, camera.GetProjectionMatrix());
+        m_wireShader->SetUniform(U_VIEW, camera.GetViewMatrix());
+        m_wireShader->SetUniform(U_SIGNALS, 1);
+        m_wireShader->SetUniform(U_TOGGLE_TIMES, 2);
+        m_wireShader->SetUniform(U_USE_OVERRIDE_COLOR, true);
+        m_wireShader->SetUniform(U_OVERRIDE_COLOR, color);
+        m_wireShader->SetUniform(U_ANIMATED, true);
+        m_wireShader->SetUniform(U_TIME, m_time);
+        m_wireShader->SetUniform(U_ANIMATION_SPEED, 5.0f);
         
-        glBindVertexArray(m_vao);
+        GLState::BindVertexArray(m_vao);
         glLineWidth(m_lineWidth * 1.5f);
         
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         
-        glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(m_vertexBuffer.size() / 6));
+        glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(m_vertexBuffer.size() / WIRE_VERTEX_FLOATS));
         
         glDisable(GL_BLEND);
-        glBindVertexArray(0);
+        GLState::BindVertexArray(0);
     }
 }
 
 void WireRenderer::CalculatePath(const RenderWire& wire, WirePath& path) {
     path.points = CalculateManhattanPath(wire.start, wire.end);
-    path.color = GetWireColor(wire);
     path.thickness = m_lineWidth;
-    path.animated = wire.hasSignal;
-    path.animationPhase = 0.0f;
 }
 
 std::vector<glm::vec2> WireRenderer::CalculateManhattanPath(const glm::vec2& start, 
@@ -359,13 +829,6 @@ std::vector<glm::vec2> WireRenderer::CalculateSmartPath(const glm::vec2& start,
     return CalculateManhattanPath(start, end);
 }
 
-glm::vec4 WireRenderer::GetWireColor(const RenderWire& wire) const {
-    if (wire.hasSignal) {
-        return glm::vec4(1.0f, 0.2f, 0.2f, 1.0f);  // 빨간색 (신호 있음)
-    }
-    return glm::vec4(0.4f, 0.4f, 0.4f, 1.0f);  // 회색 (신호 없음)
-}
-
 std::vector<RenderWire> WireRenderer::FrustumCull(const std::vector<RenderWire>& wires, const Camera& camera) const {
     std::vector<RenderWire> visible;
     visible.reserve(wires.size());
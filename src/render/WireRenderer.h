@@ -5,10 +5,25 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <unordered_map>
+#include "core/CellWireManager.h"
 #include "render/RenderTypes.h"
+#include "render/RenderCommandList.h"
+#include "render/SignalStateBuffer.h"
 #include "render/ShaderProgram.h"
 #include "render/Camera.h"
 
+class JobSystem;
+
+// 프레임별 셀 와이어 렌더링 통계 (헤드리스 측정용)
+struct WireRenderStats {
+    size_t chunks{0};               // 가시 범위에서 그린 청크
+    size_t rebuiltChunks{0};        // 메시를 다시 만든 청크
+    size_t signalUploads{0};        // 신호 비트만 다시 올린 청크
+    size_t drawCalls{0};
+    size_t vertices{0};
+};
+
 class WireRenderer {
 public:
     WireRenderer();
@@ -17,23 +32,67 @@ public:
     bool Initialize();
     void Cleanup();
     
-    void RenderWires(const std::vector<RenderWire>& wires, const Camera& camera);
+    // 와이어 색은 셰이더가 RenderWire::net의 신호 비트로 결정
+    // 토글 직후 펄스도 넷의 토글 시각과 현재 시각으로 셰이더에서 계산 (CPU 애니메이션 상태 없음)
+    void RecordWires(const std::vector<RenderWire>& wires, const Camera& camera,
+                     const SignalStateBuffer& signals, RenderCommandList& commands);
     void RenderDraggingWire(const glm::vec2& start, const glm::vec2& end, 
                            const Camera& camera);
+    // 셀 와이어: 32x32 청크별 정적 메시를 GPU에 캐시하고 배선이 바뀐 청크만 재구축
+    // 신호는 셀당 1비트 정수 텍스처로 따로 올려 신호 변화에 메시 재구축이 없음
+    // 가시 청크만 기록하며, 화면 밖 청크의 메시는 다시 보일 때 갱신
+    void RecordCellWires(const CellWireManager& cellWires, const Camera& camera, RenderCommandList& commands);
+    // 줌 아웃용: 가시 청크마다 와이어 밀도/HIGH 비율 타일 추가
+    void AppendLodTiles(const CellWireManager& cellWires, const Camera& camera,
+                        std::vector<ChunkTile>& tiles) const;
+    void ReleaseCellWireCache();
     
     void SetLineWidth(float width) { m_lineWidth = width; }
     void SetAntialiasing(bool enable) { m_antialiasing = enable; }
+    void SetTime(float seconds) { m_time = seconds; }
+    // 끄면 신호 펄스를 그리지 않음 (이미 흐르던 펄스도 즉시 사라짐)
+    void SetSignalAnimation(bool enabled) { m_signalAnimation = enabled; }
+    // 청크 메시 정점 생성을 나눠 맡을 워커 풀 (nullptr이면 렌더 스레드에서 순차 생성)
+    void SetJobSystem(JobSystem* jobs);
     
     float GetLineWidth() const { return m_lineWidth; }
     bool IsAntialiasingEnabled() const { return m_antialiasing; }
+    const WireRenderStats& GetStats() const { return m_stats; }
+    // 청크 메시 맵, 워커별 스테이징, 신호 텍스처 CPU 사본 (GPU 버퍼 제외)
+    MemoryUsage GetMemoryUsage() const;
     
 private:
+    struct CellWireVertex {
+        glm::vec2 position;
+        uint8_t cellX;      // 청크 내 셀 좌표 (신호 비트 조회용)
+        uint8_t cellY;
+        uint8_t kind;       // 0 = 선분, 1 = 접점
+        uint8_t padding;
+    };
+    
+    static constexpr uint32_t INVALID_SIGNAL_SLOT = 0xFFFFFFFFu;
+    
+    struct ChunkMesh {
+        glm::ivec2 coord{0, 0};
+        GLuint vao{0};
+        GLuint vbo{0};
+        GLsizei lineVertices{0};
+        GLsizei jointVertices{0};
+        uint64_t geometryRevision{0};
+        uint64_t signalRevision{0};
+        uint32_t signalSlot{INVALID_SIGNAL_SLOT};
+    };
+    
+    // 신호 텍스처: 슬롯(청크) 하나가 32텍셀(행당 32비트 마스크), 텍스처 한 줄에 32슬롯
+    static constexpr uint32_t SIGNAL_SLOTS_PER_ROW = 32;
+    static constexpr uint32_t SIGNAL_TEXTURE_WIDTH = SIGNAL_SLOTS_PER_ROW * CellWireManager::CHUNK_SIZE;
+
+    // 게이트 간 와이어 정점: 위치 2 + 넷 번호 1 + 경로 거리 1
+    static constexpr size_t WIRE_VERTEX_FLOATS = 4;
+    
     struct WirePath {
         std::vector<glm::vec2> points;
-        glm::vec4 color;
         float thickness;
-        bool animated;
-        float animationPhase;
     };
     
     void SetupShaders();
@@ -47,9 +106,37 @@ private:
                                               const glm::vec2& end,
                                               const std::vector<glm::vec2>& obstacles);
     
-    glm::vec4 GetWireColor(const RenderWire& wire) const;
     std::vector<RenderWire> FrustumCull(const std::vector<RenderWire>& wires, const Camera& camera) const;
     
+    template<typename Fn>
+    void ForEachVisibleChunk(const CellWireManager& cellWires, const Camera& camera, Fn&& fn) const;
+    
+    // 재구축할 청크 하나: 워커가 자기 스테이징 버퍼의 [offset, offset + lines + joints)에 정점을 씀
+    struct ChunkBuildJob {
+        const CellWireManager::WireChunk* chunk;
+        ChunkMesh* mesh;
+        unsigned worker;
+        size_t offset;
+        GLsizei lineVertices;
+        GLsizei jointVertices;
+    };
+    
+    // 워커별 스테이징: 같은 워커 번호는 동시에 쓰이지 않으므로 잠금 없음
+    struct ChunkStaging {
+        std::vector<CellWireVertex> vertices;
+        std::vector<CellWireVertex> joints;     // 접점은 선분 뒤에 붙이기 전 잠시 모음
+    };
+    
+    void CreateChunkMesh(const CellWireManager::WireChunk& chunk, ChunkMesh& mesh);
+    // GL 호출 없는 순수 CPU 작업 (워커 스레드에서 실행)
+    static void BuildChunkVertices(const CellWireManager::WireChunk& chunk, ChunkStaging& staging,
+                                   ChunkBuildJob& job);
+    void RebuildChunkMeshes(RenderCommandList& commands);
+    void UploadChunkSignals(const CellWireManager::WireChunk& chunk, const ChunkMesh& mesh,
+                            RenderCommandList& commands);
+    uint32_t AllocateSignalSlot();
+    void GrowSignalTexture(uint32_t minSlots);
+    
     GLuint m_vao;
     GLuint m_vbo;
     GLuint m_vaoJoint;
@@ -60,10 +147,28 @@ private:
     
     float m_lineWidth;
     bool m_antialiasing;
-    float m_animationTime;
+    float m_time;               // 애니메이션 기준 시각 (초, RenderManager가 갱신)
+    bool m_signalAnimation;
     
     std::vector<float> m_vertexBuffer;
     size_t m_maxVertices;
     
+    std::unique_ptr<ShaderProgram> m_cellWireShader;
+    std::unordered_map<uint64_t, ChunkMesh> m_chunkMeshes;     // RenderChunkKey(청크 좌표)
+    const CellWireManager* m_cachedWires;
+    uint64_t m_chunkSetRevision;
+    std::vector<std::pair<const CellWireManager::WireChunk*, ChunkMesh*>> m_visibleMeshes;
+    std::vector<ChunkBuildJob> m_buildJobs;
+    std::vector<ChunkStaging> m_staging;        // 워커 수만큼
+    JobSystem* m_jobs;
+    
+    GLuint m_signalTexture;
+    uint32_t m_signalSlotCapacity;
+    uint32_t m_nextSignalSlot;
+    std::vector<uint32_t> m_freeSignalSlots;
+    std::vector<uint32_t> m_signalWords;    // 신호 텍스처의 CPU 사본 (슬롯 * 32 + 행)
+    
+    WireRenderStats m_stats;
+    
     bool m_initialized;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "CircuitSimulator.h"
 #include "../core/CellWireManager.h"
+#include "../utils/Profiler.h"
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -45,6 +46,9 @@ namespace simulation {
         
         state = SimulationState::STOPPED;
         accumulatedTime = 0.0f;
+        windowSimTime = 0.0f;
+        windowWallTime = 0.0f;
+        simulationRatio = 0.0f;
         needsSignalPropagation = false;
         dirtyGates.clear();
 
@@ -92,43 +96,100 @@ namespace simulation {
         // 회로 변경 감지 (새 게이트 추가 등)
         onCircuitChanged();
 
-        perfManager->beginFrame();
-
         // 시뮬레이션 속도 적용
         float adjustedDeltaTime = deltaTime * config.simulationSpeed;
         accumulatedTime += adjustedDeltaTime;
 
-        auto simStart = std::chrono::high_resolution_clock::now();
+        // 밀린 시간이 상한을 넘으면 버림 (따라잡을 수 없는 만큼 쌓이면 입력/렌더링까지 밀림)
+        if (accumulatedTime > config.maxBacklog) {
+            droppedTime += accumulatedTime - config.maxBacklog;
+            accumulatedTime = config.maxBacklog;
+        }
 
-        // 고정 시간 스텝 시뮬레이션
-        const float fixedTimeStep = 1.0f / 60.0f; // 60Hz 고정
-        while (accumulatedTime >= fixedTimeStep) {
-            // 타이머 업데이트
-            updateTimers(fixedTimeStep);
-            
-            // 만료된 타이머 처리
-            processExpiredTimers();
-            
-            // 신호 전파
-            if (needsSignalPropagation) {
-                propagateSignals();
-                needsSignalPropagation = false;
+        auto simStart = std::chrono::high_resolution_clock::now();
+        const auto budget = std::chrono::duration<float, std::milli>(config.stepBudgetMs);
+
+        // 고정 시간 스텝 시뮬레이션: 예산 안에서 처리할 수 있는 만큼만 하고 나머지는 다음 프레임으로
+        const int steps = chooseStepCount(static_cast<int>(accumulatedTime / FIXED_TIME_STEP));
+        int done = 0;
+        while (done < steps) {
+            simulateStep(FIXED_TIME_STEP);
+            accumulatedTime -= FIXED_TIME_STEP;
+            ++done;
+
+            // 측정 비용보다 느린 스텝(큰 전파 등)이 섞이면 예산에서 끊음
+            if (std::chrono::high_resolution_clock::now() - simStart >= budget) {
+                break;
             }
-            
-            // 입력 변경 감지
-            detectInputChanges();
-            
-            accumulatedTime -= fixedTimeStep;
         }
 
         auto simEnd = std::chrono::high_resolution_clock::now();
-        auto simDuration = std::chrono::duration_cast<std::chrono::microseconds>(simEnd - simStart);
-        perfManager->recordSimulationTime(simDuration.count() / 1000.0f);
+        float simMs = std::chrono::duration<float, std::milli>(simEnd - simStart).count();
+        perfManager->recordSimulationTime(simMs);
 
-        // 성능 최적화
-        optimizePerformance();
-        
-        perfManager->endFrame();
+        if (done > 0) {
+            float cost = simMs / done;
+            stepCostMs = stepCostMs == 0.0f ? cost : stepCostMs + 0.2f * (cost - stepCostMs);
+        }
+
+        // 실제로 진행한 시뮬레이션 시간 / 실제 시간
+        windowSimTime += done * FIXED_TIME_STEP;
+        windowWallTime += deltaTime;
+        if (windowWallTime >= RATIO_WINDOW) {
+            simulationRatio = windowSimTime / windowWallTime;
+            windowSimTime = 0.0f;
+            windowWallTime = 0.0f;
+        }
+    }
+
+    bool CircuitSimulator::runIdleStep(float budgetSeconds) {
+        if (!circuit || state != SimulationState::RUNNING || accumulatedTime < FIXED_TIME_STEP) {
+            return false;
+        }
+        if (stepCostMs / 1000.0f > budgetSeconds) {
+            return false;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        simulateStep(FIXED_TIME_STEP);
+        accumulatedTime -= FIXED_TIME_STEP;
+        windowSimTime += FIXED_TIME_STEP;
+
+        float cost = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        stepCostMs = stepCostMs == 0.0f ? cost : stepCostMs + 0.2f * (cost - stepCostMs);
+        return true;
+    }
+
+    int CircuitSimulator::chooseStepCount(int pendingSteps) const {
+        if (pendingSteps <= 0) {
+            return 0;
+        }
+
+        int steps = std::min(pendingSteps, std::max(1, getQualitySettings().maxStepsPerFrame));
+        if (stepCostMs > 0.0f) {
+            // 한 스텝은 항상 진행 (예산보다 비싼 스텝이어도 시뮬레이션이 멈추지 않게)
+            int affordable = std::max(1, static_cast<int>(config.stepBudgetMs / stepCostMs));
+            steps = std::min(steps, affordable);
+        }
+        return steps;
+    }
+
+    void CircuitSimulator::simulateStep(float dt) {
+        // 타이머 업데이트
+        updateTimers(dt);
+
+        // 만료된 타이머 처리
+        processExpiredTimers();
+
+        // 신호 전파
+        if (needsSignalPropagation) {
+            propagateSignals();
+            needsSignalPropagation = false;
+        }
+
+        // 입력 변경 감지
+        detectInputChanges();
     }
 
     bool CircuitSimulator::getSignalState(uint32_t signalId) const {
@@ -209,11 +270,58 @@ namespace simulation {
 
     PerformanceStats CircuitSimulator::getPerformanceStats() const {
         if (perfManager) {
-            return perfManager->getStats();
+            PerformanceStats stats = perfManager->getStats();
+            stats.memoryUsage = getMemoryReport().GetTotal().bytes;
+            stats.simulationRatio = simulationRatio;
+            stats.simulationBacklog = accumulatedTime;
+            stats.simulationDropped = droppedTime;
+            return stats;
         }
         return {};
     }
 
+    const MemoryReport& CircuitSimulator::getMemoryReport() const {
+        auto now = std::chrono::steady_clock::now();
+        if (!memoryReport.entries.empty() && now - memoryReportTime < MEMORY_REPORT_INTERVAL) {
+            return memoryReport;
+        }
+        memoryReportTime = now;
+        memoryReport.Clear();
+
+        if (circuit) {
+            memoryReport.Add("Circuit", circuit->getMemoryUsage());
+        }
+        if (cellWireManager) {
+            memoryReport.Add("Cell wires", cellWireManager->getMemoryUsage());
+        }
+        if (signalManager) {
+            memoryReport.Add("Signal manager", signalManager->getMemoryUsage());
+        }
+        if (timerManager) {
+            memoryReport.Add("Timer manager", timerManager->getMemoryUsage());
+        }
+        if (loopDetector) {
+            memoryReport.Add("Loop detector", loopDetector->getMemoryUsage());
+        }
+
+        MemoryUsage mapping = MemoryStats::Measure(gateOutputSignals);
+        mapping += MemoryStats::Measure(gateInputSignals);
+        mapping += MemoryStats::Measure(dirtyGates);
+        memoryReport.Add("Signal mapping", mapping);
+
+        for (const auto& collector : memoryCollectors) {
+            collector(memoryReport);
+        }
+        return memoryReport;
+    }
+
+    void CircuitSimulator::addMemoryCollector(std::function<void(MemoryReport&)> collector) {
+        if (collector) {
+            memoryCollectors.push_back(std::move(collector));
+            memoryReport.Clear();   // 다음 조회에서 바로 다시 집계
+        }
+    }
+
     void CircuitSimulator::addObserver(ISimulationObserver* observer) {
         if (observer) {
             auto it = std::find(observers.begin(), observers.end(), observer);
@@ -231,6 +339,7 @@ namespace simulation {
     }
 
     void CircuitSimulator::onCircuitChanged() {
+        PROFILE_SCOPE("CircuitSimulator::onCircuitChanged");
         // 회로가 변경되었을 때 캐시 무효화
         if (loopDetector) {
             loopDetector->invalidateCache();
@@ -282,6 +391,7 @@ namespace simulation {
                 Gate* gate = circuit->getGate(gateId);
                 if (gate) {
                     gate->currentOutput = pendingOutput ? SignalState::HIGH : SignalState::LOW;
+                    circuit->markGateChanged(gateId);
                     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, 
                                 "[CircuitSimulator] Gate %u output changed to %s", 
                                 gateId, pendingOutput ? "HIGH" : "LOW");
@@ -342,16 +452,32 @@ namespace simulation {
         // 현재는 신호 전파에서 처리되므로 별도 구현 불필요
     }
 
-    void CircuitSimulator::optimizePerformance() {
+    void CircuitSimulator::recordFrameTime(float frameMs, float deltaTime) {
+        optimizePerformance(frameMs, deltaTime);
+    }
+
+    const QualitySettings& CircuitSimulator::getQualitySettings() const {
+        static const QualitySettings defaults;
+        return perfManager ? perfManager->getQualitySettings() : defaults;
+    }
+
+    void CircuitSimulator::setAdaptiveQuality(bool enabled) {
         if (perfManager) {
-            perfManager->updateOptimization();
-            
-            // 성능 경고 확인
-            PerformanceStats stats = perfManager->getStats();
-            
-            if (stats.frameTime > 33.33f) { // 30 FPS 이하
-                notifyPerformanceWarning("Performance degraded: " + 
-                    std::to_string(1000.0f / stats.frameTime) + " FPS");
+            perfManager->setAdaptive(enabled);
+        }
+    }
+
+    void CircuitSimulator::optimizePerformance(float frameMs, float deltaTime) {
+        if (!perfManager) return;
+
+        if (perfManager->recordFrameTime(frameMs, deltaTime)) {
+            notifyQualityChanged(perfManager->getQualitySettings());
+
+            // 최저 레벨까지 내려갔으면 경고
+            if (perfManager->getCurrentLevel() == PerformanceManager::OptimizationLevel::EMERGENCY) {
+                PerformanceStats stats = perfManager->getStats();
+                notifyPerformanceWarning("Performance degraded: " +
+                    std::to_string(1000.0f / std::max(0.001f, stats.frameTime)) + " FPS");
             }
         }
     }
@@ -506,4 +632,10 @@ namespace simulation {
         }
     }
 
+    void CircuitSimulator::notifyQualityChanged(const QualitySettings& settings) {
+        for (auto* observer : observers) {
+            observer->onQualityChanged(settings);
+        }
+    }
+
 } // namespace simulation
\ No newline at end of file
@@ -8,6 +8,9 @@
 #include "PerformanceManager.h"
 #include "../core/Circuit.h"
 #include "../core/Types.h"
+#include "../utils/MemoryStats.h"
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -31,6 +34,8 @@ namespace simulation {
         void stop();
         void reset();
         void update(float deltaTime);
+        // 프레임 대기 중 남는 시간에 넘겨 둔 스텝 하나를 처리 (할 일이 없거나 시간이 모자라면 false)
+        bool runIdleStep(float budgetSeconds);
 
         // 상태 조회
         bool isRunning() const { return state == SimulationState::RUNNING; }
@@ -53,6 +58,16 @@ namespace simulation {
         std::vector<GateId> getActiveGates() const;
         PerformanceStats getPerformanceStats() const;
 
+        // 적응형 품질: 앱이 매 프레임 CPU 작업 시간(ms)과 실제 프레임 간격(초)을 넘기면 조절기가 레벨을 정함
+        void recordFrameTime(float frameMs, float deltaTime);
+        const QualitySettings& getQualitySettings() const;
+        void setAdaptiveQuality(bool enabled);
+
+        // 서브시스템별 메모리 사용량 (0.5초마다 다시 집계, 그 사이에는 마지막 결과)
+        const MemoryReport& getMemoryReport() const;
+        // 시뮬레이터 밖의 사용량(렌더러 등)을 보고서에 추가하는 함수 등록
+        void addMemoryCollector(std::function<void(MemoryReport&)> collector);
+
         // Observer 패턴
         void addObserver(ISimulationObserver* observer);
         void removeObserver(ISimulationObserver* observer);
@@ -88,16 +103,33 @@ namespace simulation {
         uint32_t nextSignalId;
 
         // 시뮬레이션 상태
-        float accumulatedTime;
+        float accumulatedTime;      // 아직 처리하지 않은 시뮬레이션 시간 (다음 프레임으로 넘어감)
+
+        // 시간 예산 스텝
+        static constexpr float FIXED_TIME_STEP = 1.0f / 60.0f;     // 60Hz 고정
+        static constexpr float RATIO_WINDOW = 0.5f;                // 비율 측정 창 (실제 시간, 초)
+        float stepCostMs = 0.0f;        // 스텝 하나의 측정 비용 (지수 이동 평균)
+        float droppedTime = 0.0f;       // 상한을 넘어 버린 시뮬레이션 시간 (초, 누적)
+        float windowSimTime = 0.0f;
+        float windowWallTime = 0.0f;
+        float simulationRatio = 0.0f;
         bool needsSignalPropagation;
         std::vector<GateId> dirtyGates;
 
+        // 메모리 보고서 캐시
+        std::vector<std::function<void(MemoryReport&)>> memoryCollectors;
+        mutable MemoryReport memoryReport;
+        mutable std::chrono::steady_clock::time_point memoryReportTime;
+        static constexpr std::chrono::milliseconds MEMORY_REPORT_INTERVAL{500};
+
         // 내부 메서드
+        void simulateStep(float dt);
+        int chooseStepCount(int pendingSteps) const;
         void updateTimers(float deltaTime);
         void processExpiredTimers();
         void propagateSignals();
         void detectInputChanges();
-        void optimizePerformance();
+        void optimizePerformance(float frameMs, float deltaTime);
 
         // 신호 관리
         void initializeSignalMapping();
@@ -117,6 +149,7 @@ namespace simulation {
         void notifyLoopDetected(const std::vector<GateId>& loopGates);
         void notifySimulationStateChanged(SimulationState newState);
         void notifyPerformanceWarning(const std::string& message);
+        void notifyQualityChanged(const QualitySettings& settings);
     };
 
 } // namespace simulation
\ No newline at end of file
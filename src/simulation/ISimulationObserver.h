@@ -1,5 +1,6 @@
 #pragma once
 
+#include "SimulationTypes.h"
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -28,6 +29,8 @@ namespace simulation {
         virtual void onLoopDetected(const std::vector<uint32_t>& loopGates) = 0;
         virtual void onSimulationStateChanged(SimulationState newState) = 0;
         virtual void onPerformanceWarning(const std::string& message) = 0;
+        // 적응형 품질 조절로 설정이 바뀔 때 (필요한 구독자만 구현)
+        virtual void onQualityChanged(const QualitySettings& settings) {}
     };
 
 } // namespace simulation
\ No newline at end of file
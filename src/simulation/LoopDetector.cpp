@@ -87,6 +87,23 @@ namespace simulation {
         loopGates.clear();
     }
 
+    MemoryUsage LoopDetector::getMemoryUsage() const {
+        MemoryUsage usage = MemoryStats::Measure(detectedLoops);
+        for (const LoopInfo& loop : detectedLoops) {
+            usage += MemoryStats::Measure(loop.gateIds);
+        }
+        usage += MemoryStats::Measure(loopGates);
+        usage += MemoryStats::Measure(dfsState);
+        usage += MemoryStats::Measure(dfsStack);
+        usage += MemoryStats::Measure(currentPath);
+        usage += MemoryStats::Measure(adjacencyList);
+        for (const auto& neighbors : adjacencyList) {
+            usage += MemoryStats::Measure(neighbors);
+        }
+        usage += MemoryStats::Measure(gateToIndex);
+        return usage;
+    }
+
     bool LoopDetector::dfsVisit(size_t gateIndex) {
         dfsState[gateIndex] = DFSState::GRAY;
         currentPath.push_back(getGateFromIndex(gateIndex));
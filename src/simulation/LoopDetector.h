@@ -2,6 +2,7 @@
 
 #include "SimulationTypes.h"
 #include "../core/Circuit.h"
+#include "../utils/MemoryStats.h"
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -35,6 +36,9 @@ namespace simulation {
         // 캐시 무효화 (회로 변경 시 호출)
         void invalidateCache();
 
+        // 인접 리스트 캐시, DFS 작업 버퍼, 감지된 루프
+        MemoryUsage getMemoryUsage() const;
+
     private:
         const Circuit* circuit;
         std::vector<LoopInfo> detectedLoops;
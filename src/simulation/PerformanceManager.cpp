@@ -1,266 +1,154 @@
 #include "PerformanceManager.h"
 #include <algorithm>
-#include <numeric>
 
 namespace simulation {
 
-    PerformanceManager::PerformanceManager() 
+    PerformanceManager::PerformanceManager()
         : currentLevel(OptimizationLevel::HIGH)
+        , quality(qualityForLevel(OptimizationLevel::HIGH))
         , targetFrameTime(16.67f)  // 60 FPS
+        , adaptive(true)
         , frameTime(0.0f)
+        , smoothedFrameTime(0.0f)
         , simulationTime(0.0f)
-        , lastOptimizationCheck(0.0f)
+        , lastSimulationTime(0.0f)
+        , integral(0.0f)
+        , previousError(0.0f)
+        , pidOutput(0.0f)
+        , overBudgetTime(0.0f)
+        , underBudgetTime(0.0f)
+        , cooldown(0.0f)
     {
-        initializeDefaults();
     }
 
-    void PerformanceManager::beginFrame() {
-        frameStart = std::chrono::high_resolution_clock::now();
+    void PerformanceManager::recordSimulationTime(float time) {
+        simulationTime += time;
     }
 
-    void PerformanceManager::endFrame() {
-        auto now = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(now - frameStart);
-        frameTime = duration.count() / 1000.0f; // ms 단위로 변환
+    bool PerformanceManager::recordFrameTime(float frameMs, float deltaTime) {
+        frameTime = frameMs;
+        smoothedFrameTime = smoothedFrameTime == 0.0f
+            ? frameMs
+            : smoothedFrameTime + SMOOTHING * (frameMs - smoothedFrameTime);
+        lastSimulationTime = simulationTime;
+        simulationTime = 0.0f;
+
+        if (!adaptive) {
+            return false;
+        }
 
-        // 프레임 히스토리 업데이트
-        FrameStats stats;
-        stats.frameTime = frameTime;
-        stats.simulationTime = simulationTime;
-        stats.activeGates = 0;  // 실제 값은 외부에서 설정
-        stats.signalChanges = 0;  // 실제 값은 외부에서 설정
-        stats.timestamp = now;
+        OptimizationLevel previousLevel = currentLevel;
+        // 작업 시간은 vsync/프레임 제한 대기를 빼므로 프레임 간격보다 짧음 → 시간축으로 쓰면 유지 시간이 늘어남
+        updateController(std::min(deltaTime, MAX_CONTROLLER_STEP));
+        return currentLevel != previousLevel;
+    }
 
-        frameHistory.push_back(stats);
+    void PerformanceManager::updateController(float dt) {
+        if (dt <= 0.0f) {
+            return;
+        }
 
-        // 오래된 프레임 데이터 정리
-        cleanupOldFrames();
+        float error = (smoothedFrameTime - targetFrameTime) / targetFrameTime;
+        integral = std::clamp(integral + error * dt, -INTEGRAL_LIMIT, INTEGRAL_LIMIT);
+        float derivative = (error - previousError) / dt;
+        previousError = error;
+        pidOutput = KP * error + KI * integral + KD * derivative;
 
-        // 주기적으로 최적화 레벨 조정 (0.5초마다)
-        float currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()).count() / 1000.0f;
-        
-        if (currentTime - lastOptimizationCheck >= 0.5f) {
-            updateOptimization();
-            lastOptimizationCheck = currentTime;
+        if (cooldown > 0.0f) {
+            cooldown -= dt;
+            return;
         }
 
-        // 다음 프레임을 위해 시뮬레이션 시간 초기화
-        simulationTime = 0.0f;
+        // 임계값을 계속 넘은 시간만 셈 (한두 프레임의 튐은 무시)
+        overBudgetTime = pidOutput > RAISE_THRESHOLD ? overBudgetTime + dt : 0.0f;
+        underBudgetTime = pidOutput < LOWER_THRESHOLD ? underBudgetTime + dt : 0.0f;
+
+        if (overBudgetTime >= RAISE_HOLD && currentLevel < OptimizationLevel::EMERGENCY) {
+            changeLevel(+1);
+        } else if (underBudgetTime >= LOWER_HOLD && currentLevel > OptimizationLevel::ULTRA_HIGH) {
+            changeLevel(-1);
+        }
     }
 
-    void PerformanceManager::recordSimulationTime(float time) {
-        simulationTime += time;
+    void PerformanceManager::changeLevel(int delta) {
+        setLevel(static_cast<OptimizationLevel>(static_cast<int>(currentLevel) + delta));
+        // 새 레벨의 효과를 새로 측정하도록 적분을 비우고 잠시 판단을 미룸
+        integral = 0.0f;
+        cooldown = CHANGE_COOLDOWN;
     }
 
-    void PerformanceManager::updateOptimization() {
-        OptimizationLevel previousLevel = currentLevel;
-        adjustOptimizationLevel();
+    void PerformanceManager::setAdaptive(bool enabled) {
+        adaptive = enabled;
+        integral = 0.0f;
+        overBudgetTime = 0.0f;
+        underBudgetTime = 0.0f;
+    }
 
-        if (currentLevel != previousLevel) {
-            applyOptimizations();
-        }
+    void PerformanceManager::setLevel(OptimizationLevel level) {
+        currentLevel = level;
+        quality = qualityForLevel(level);
+        overBudgetTime = 0.0f;
+        underBudgetTime = 0.0f;
     }
 
     PerformanceStats PerformanceManager::getStats() const {
         PerformanceStats stats;
-        stats.frameTime = frameTime;
-        stats.simulationTime = simulationTime;
-        stats.activeGates = frameHistory.empty() ? 0 : frameHistory.back().activeGates;
-        stats.signalChanges = frameHistory.empty() ? 0 : frameHistory.back().signalChanges;
-        stats.memoryUsage = 0; // 실제 메모리 사용량은 외부에서 설정
+        stats.frameTime = smoothedFrameTime;
+        stats.simulationTime = lastSimulationTime;
+        stats.activeGates = 0;      // 외부에서 설정
+        stats.signalChanges = 0;    // 외부에서 설정
+        stats.memoryUsage = 0;      // CircuitSimulator가 메모리 보고서로 설정
         stats.optimizationLevel = static_cast<int>(currentLevel);
+        stats.simulationRatio = 0.0f;      // CircuitSimulator가 설정
+        stats.simulationBacklog = 0.0f;
+        stats.simulationDropped = 0.0f;
 
         return stats;
     }
 
     void PerformanceManager::resetStats() {
-        frameHistory.clear();
         frameTime = 0.0f;
+        smoothedFrameTime = 0.0f;
         simulationTime = 0.0f;
-    }
-
-    void PerformanceManager::enableOptimization(const std::string& name, bool enabled) {
-        optimizationFlags[name] = enabled;
-    }
-
-    bool PerformanceManager::isOptimizationEnabled(const std::string& name) const {
-        auto it = optimizationFlags.find(name);
-        return (it != optimizationFlags.end()) ? it->second : false;
-    }
-
-    void PerformanceManager::setFrameTimeThreshold(OptimizationLevel level, float threshold) {
-        frameTimeThresholds[level] = threshold;
-    }
-
-    void PerformanceManager::adjustOptimizationLevel() {
-        float avgFrameTime = getAverageFrameTime();
-
-        // 성능 저하 감지 - 최적화 레벨 증가
-        if (shouldIncreaseOptimization()) {
-            if (currentLevel < OptimizationLevel::EMERGENCY) {
-                currentLevel = static_cast<OptimizationLevel>(static_cast<int>(currentLevel) + 1);
-            }
-        }
-        // 성능 여유 감지 - 최적화 레벨 감소
-        else if (shouldDecreaseOptimization()) {
-            if (currentLevel > OptimizationLevel::ULTRA_HIGH) {
-                currentLevel = static_cast<OptimizationLevel>(static_cast<int>(currentLevel) - 1);
-            }
-        }
-    }
-
-    void PerformanceManager::applyOptimizations() {
-        switch (currentLevel) {
+        lastSimulationTime = 0.0f;
+        integral = 0.0f;
+        previousError = 0.0f;
+        pidOutput = 0.0f;
+        overBudgetTime = 0.0f;
+        underBudgetTime = 0.0f;
+        cooldown = 0.0f;
+    }
+
+    QualitySettings PerformanceManager::qualityForLevel(OptimizationLevel level) {
+        QualitySettings settings;
+        switch (level) {
             case OptimizationLevel::ULTRA_HIGH:
-                applyUltraHighSettings();
+                settings.lodPixelsPerCell = 4.0f;
+                settings.maxStepsPerFrame = 16;
                 break;
             case OptimizationLevel::HIGH:
-                applyHighSettings();
                 break;
             case OptimizationLevel::MEDIUM:
-                applyMediumSettings();
+                settings.signalGlow = false;
+                settings.lodPixelsPerCell = 8.0f;
+                settings.maxStepsPerFrame = 6;
                 break;
             case OptimizationLevel::LOW:
-                applyLowSettings();
+                settings.signalAnimations = false;
+                settings.signalGlow = false;
+                settings.drawPorts = false;
+                settings.lodPixelsPerCell = 12.0f;
+                settings.maxStepsPerFrame = 4;
                 break;
             case OptimizationLevel::EMERGENCY:
-                applyEmergencySettings();
-                break;
-        }
-    }
-
-    void PerformanceManager::restoreFeatures() {
-        // 기능 복원은 최적화 레벨이 낮아질 때 자동으로 적용됨
-        applyOptimizations();
-    }
-
-    float PerformanceManager::getAverageFrameTime() const {
-        if (frameHistory.empty()) return 0.0f;
-
-        float sum = std::accumulate(frameHistory.begin(), frameHistory.end(), 0.0f,
-            [](float acc, const FrameStats& stats) {
-                return acc + stats.frameTime;
-            });
-
-        return sum / frameHistory.size();
-    }
-
-    float PerformanceManager::getAverageSimulationTime() const {
-        if (frameHistory.empty()) return 0.0f;
-
-        float sum = std::accumulate(frameHistory.begin(), frameHistory.end(), 0.0f,
-            [](float acc, const FrameStats& stats) {
-                return acc + stats.simulationTime;
-            });
-
-        return sum / frameHistory.size();
-    }
-
-    bool PerformanceManager::shouldIncreaseOptimization() const {
-        float avgFrameTime = getAverageFrameTime();
-        
-        // 목표 프레임 시간의 1.5배를 초과하면 최적화 증가
-        return avgFrameTime > targetFrameTime * 1.5f;
-    }
-
-    bool PerformanceManager::shouldDecreaseOptimization() const {
-        float avgFrameTime = getAverageFrameTime();
-        
-        // 목표 프레임 시간의 0.8배 미만이면 최적화 감소
-        return avgFrameTime < targetFrameTime * 0.8f && 
-               frameHistory.size() >= MAX_FRAME_HISTORY; // 충분한 샘플이 있을 때만
-    }
-
-    void PerformanceManager::initializeDefaults() {
-        // 기본 최적화 플래그 설정
-        optimizationFlags["particle_effects"] = true;
-        optimizationFlags["signal_animations"] = true;
-        optimizationFlags["wire_glow"] = true;
-        optimizationFlags["gate_shadows"] = true;
-        optimizationFlags["antialiasing"] = true;
-        optimizationFlags["vsync"] = true;
-
-        // 기본 임계값 설정 (ms)
-        frameTimeThresholds[OptimizationLevel::ULTRA_HIGH] = 13.33f;  // 75 FPS
-        frameTimeThresholds[OptimizationLevel::HIGH] = 16.67f;        // 60 FPS
-        frameTimeThresholds[OptimizationLevel::MEDIUM] = 25.0f;       // 40 FPS
-        frameTimeThresholds[OptimizationLevel::LOW] = 33.33f;         // 30 FPS
-        frameTimeThresholds[OptimizationLevel::EMERGENCY] = 50.0f;    // 20 FPS
-    }
-
-    void PerformanceManager::cleanupOldFrames() {
-        auto now = std::chrono::high_resolution_clock::now();
-        
-        // 1초보다 오래된 프레임 데이터 제거
-        while (!frameHistory.empty()) {
-            auto age = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - frameHistory.front().timestamp).count();
-            
-            if (age > 1000) { // 1초
-                frameHistory.pop_front();
-            } else {
+                settings.signalAnimations = false;
+                settings.signalGlow = false;
+                settings.drawPorts = false;
+                settings.lodPixelsPerCell = 20.0f;
+                settings.maxStepsPerFrame = 2;
                 break;
-            }
-        }
-
-        // 최대 크기 제한
-        while (frameHistory.size() > MAX_FRAME_HISTORY) {
-            frameHistory.pop_front();
         }
+        return settings;
     }
 
-    void PerformanceManager::applyUltraHighSettings() {
-        optimizationFlags["particle_effects"] = true;
-        optimizationFlags["signal_animations"] = true;
-        optimizationFlags["wire_glow"] = true;
-        optimizationFlags["gate_shadows"] = true;
-        optimizationFlags["antialiasing"] = true;
-        optimizationFlags["vsync"] = true;
-        optimizationFlags["high_quality_rendering"] = true;
-    }
-
-    void PerformanceManager::applyHighSettings() {
-        optimizationFlags["particle_effects"] = true;
-        optimizationFlags["signal_animations"] = true;
-        optimizationFlags["wire_glow"] = true;
-        optimizationFlags["gate_shadows"] = true;
-        optimizationFlags["antialiasing"] = true;
-        optimizationFlags["vsync"] = true;
-        optimizationFlags["high_quality_rendering"] = false;
-    }
-
-    void PerformanceManager::applyMediumSettings() {
-        optimizationFlags["particle_effects"] = false;
-        optimizationFlags["signal_animations"] = true;
-        optimizationFlags["wire_glow"] = true;
-        optimizationFlags["gate_shadows"] = false;
-        optimizationFlags["antialiasing"] = true;
-        optimizationFlags["vsync"] = true;
-        optimizationFlags["high_quality_rendering"] = false;
-    }
-
-    void PerformanceManager::applyLowSettings() {
-        optimizationFlags["particle_effects"] = false;
-        optimizationFlags["signal_animations"] = false;
-        optimizationFlags["wire_glow"] = false;
-        optimizationFlags["gate_shadows"] = false;
-        optimizationFlags["antialiasing"] = false;
-        optimizationFlags["vsync"] = true;
-        optimizationFlags["high_quality_rendering"] = false;
-        optimizationFlags["static_colors"] = true;
-    }
-
-    void PerformanceManager::applyEmergencySettings() {
-        optimizationFlags["particle_effects"] = false;
-        optimizationFlags["signal_animations"] = false;
-        optimizationFlags["wire_glow"] = false;
-        optimizationFlags["gate_shadows"] = false;
-        optimizationFlags["antialiasing"] = false;
-        optimizationFlags["vsync"] = false;
-        optimizationFlags["high_quality_rendering"] = false;
-        optimizationFlags["static_colors"] = true;
-        optimizationFlags["minimal_rendering"] = true;
-    }
-
-} // namespace simulation
\ No newline at end of file
+} // namespace simulation
@@ -1,13 +1,13 @@
 #pragma once
 
 #include "SimulationTypes.h"
-#include <chrono>
-#include <deque>
-#include <unordered_map>
-#include <string>
 
 namespace simulation {
 
+    // 프레임 시간을 목표 예산에 맞추는 적응형 품질 조절기
+    // - 입력: 앱이 매 프레임 넘기는 CPU 작업 시간 (스왑/프레임 제한 대기 제외)
+    // - PID 출력이 임계값을 일정 시간 넘을 때만 레벨을 한 단계씩 바꿈 (히스테리시스)
+    // - 레벨마다 QualitySettings 프리셋을 두고, 렌더러/시뮬레이터가 그 값을 직접 읽음
     class PerformanceManager {
     public:
         enum class OptimizationLevel {
@@ -22,74 +22,63 @@ namespace simulation {
         ~PerformanceManager() = default;
 
         // 성능 모니터링
-        void beginFrame();
-        void endFrame();
         void recordSimulationTime(float time);
+        // frameMs: 프레임 하나의 작업 시간 (ms, 측정 부하)
+        // deltaTime: 이전 프레임부터 지난 실제 시간 (초, 조절기의 적분/유지/쿨다운 시간축)
+        // 조절기를 한 번 진행시키고 레벨이 바뀌면 true
+        bool recordFrameTime(float frameMs, float deltaTime);
 
         // 적응형 최적화
-        void updateOptimization();
         OptimizationLevel getCurrentLevel() const { return currentLevel; }
+        const QualitySettings& getQualitySettings() const { return quality; }
         void setTargetFrameRate(float fps) { targetFrameTime = 1000.0f / fps; }
+        float getTargetFrameTime() const { return targetFrameTime; }
+        // 끄면 현재 레벨에 고정 (setLevel로만 바뀜)
+        void setAdaptive(bool enabled);
+        bool isAdaptive() const { return adaptive; }
+        void setLevel(OptimizationLevel level);
 
         // 통계
         PerformanceStats getStats() const;
         void resetStats();
 
-        // 최적화 설정
-        void enableOptimization(const std::string& name, bool enabled);
-        bool isOptimizationEnabled(const std::string& name) const;
-
-        // 성능 임계값 설정
-        void setFrameTimeThreshold(OptimizationLevel level, float threshold);
+        static QualitySettings qualityForLevel(OptimizationLevel level);
 
     private:
         OptimizationLevel currentLevel;
+        QualitySettings quality;
         float targetFrameTime;  // 목표 프레임 시간 (ms)
+        bool adaptive;
 
         // 성능 측정
-        TimePoint frameStart;
-        float frameTime;
-        float simulationTime;
-        float lastOptimizationCheck;
-
-        // 통계 수집
-        struct FrameStats {
-            float frameTime;
-            float simulationTime;
-            size_t activeGates;
-            size_t signalChanges;
-            TimePoint timestamp;
-        };
-
-        std::deque<FrameStats> frameHistory;
-        static constexpr size_t MAX_FRAME_HISTORY = 60; // 1초간
-
-        // 최적화 플래그
-        std::unordered_map<std::string, bool> optimizationFlags;
-
-        // 성능 임계값 (ms)
-        std::unordered_map<OptimizationLevel, float> frameTimeThresholds;
-
-        // 적응형 조절
-        void adjustOptimizationLevel();
-        void applyOptimizations();
-        void restoreFeatures();
-
-        // 내부 메서드
-        float getAverageFrameTime() const;
-        float getAverageSimulationTime() const;
-        bool shouldIncreaseOptimization() const;
-        bool shouldDecreaseOptimization() const;
-
-        void initializeDefaults();
-        void cleanupOldFrames();
-
-        // 최적화 레벨별 설정
-        void applyUltraHighSettings();
-        void applyHighSettings();
-        void applyMediumSettings();
-        void applyLowSettings();
-        void applyEmergencySettings();
+        float frameTime;            // 마지막 프레임 (ms)
+        float smoothedFrameTime;    // 지수 이동 평균 (ms)
+        float simulationTime;       // 이번 프레임에 누적 중인 시뮬레이션 시간 (ms)
+        float lastSimulationTime;   // 마지막으로 끝난 프레임의 시뮬레이션 시간 (ms)
+
+        // PID 상태 (오차는 목표 대비 비율: +0.5면 예산을 50% 초과)
+        float integral;
+        float previousError;
+        float pidOutput;
+        float overBudgetTime;       // 출력이 올림 임계값을 넘은 채 지난 시간 (초)
+        float underBudgetTime;      // 출력이 내림 임계값 아래인 채 지난 시간 (초)
+        float cooldown;             // 레벨을 바꾼 직후 효과가 나타날 때까지 판단 보류 (초)
+
+        // 조절기 상수
+        static constexpr float SMOOTHING = 0.15f;
+        static constexpr float KP = 1.0f;
+        static constexpr float KI = 0.5f;
+        static constexpr float KD = 0.05f;
+        static constexpr float INTEGRAL_LIMIT = 1.0f;
+        static constexpr float RAISE_THRESHOLD = 0.15f;     // 예산 초과 쪽 (품질 낮춤)
+        static constexpr float LOWER_THRESHOLD = -0.35f;    // 여유 쪽 (품질 올림), 더 넓게 잡아 진동 방지
+        static constexpr float RAISE_HOLD = 0.25f;
+        static constexpr float LOWER_HOLD = 2.0f;
+        static constexpr float CHANGE_COOLDOWN = 0.5f;
+        static constexpr float MAX_CONTROLLER_STEP = 0.1f;  // 긴 멈춤(창 드래그 등) 한 번이 유지 시간을 다 채우지 않게
+
+        void updateController(float dt);
+        void changeLevel(int delta);
     };
 
-} // namespace simulation
\ No newline at end of file
+} // namespace simulation
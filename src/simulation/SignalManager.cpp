@@ -44,6 +44,15 @@ namespace simulation {
 #endif
     }
 
+    MemoryUsage SignalManager::getMemoryUsage() const {
+        std::shared_lock lock(signalMutex);
+        // 정렬 할당한 비트 배열 3개 (현재/이전/더티)
+        MemoryUsage usage{3 * signalWords * sizeof(uint32_t), 3};
+        usage += MemoryStats::Measure(changedSignals);
+        usage += MemoryStats::Measure(pendingChanges);
+        return usage;
+    }
+
     bool SignalManager::getSignal(uint32_t signalId) const {
         if (signalId >= maxSignals) return false;
 
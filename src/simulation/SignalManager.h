@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SimulationTypes.h"
+#include "../utils/MemoryStats.h"
 #include <vector>
 #include <shared_mutex>
 #include <unordered_set>
@@ -35,6 +36,7 @@ namespace simulation {
         // 상태 조회
         size_t getSignalCount() const { return maxSignals; }
         size_t getChangedCount() const { return changedSignals.size(); }
+        MemoryUsage getMemoryUsage() const;
 
     private:
         const size_t maxSignals;
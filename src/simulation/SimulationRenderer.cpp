@@ -70,6 +70,11 @@ namespace simulation {
         // renderer->showPerformanceWarning(message);
     }
 
+    void SimulationRenderer::onQualityChanged(const QualitySettings& settings) {
+        animationsEnabled = settings.signalAnimations;
+        signalGlowEnabled = settings.signalGlow;
+    }
+
     void SimulationRenderer::setSignalToGateMapping(const std::unordered_map<uint32_t, GateId>& mapping) {
         signalToGate = mapping;
     }
@@ -128,10 +133,8 @@ namespace simulation {
     void SimulationRenderer::triggerSignalAnimation(uint32_t signalId) {
         if (!renderer || !animationsEnabled) return;
 
-        // 신호 전파 애니메이션 트리거
-        // 와이어를 따라 흐르는 점 애니메이션 시작
-        // TODO: 실제 애니메이션 시스템과 연동
-        // renderer->triggerSignalFlowAnimation(signalId);
+        // 와이어를 따라 흐르는 펄스는 렌더러 셰이더가 넷별 마지막 토글 시각과
+        // 현재 시각으로 계산함 (SignalStateBuffer). 여기서는 애니메이션 상태를 두지 않음
     }
 
     void SimulationRenderer::highlightLoopGates(const std::vector<uint32_t>& gateIds) {
@@ -19,6 +19,7 @@ namespace simulation {
         void onLoopDetected(const std::vector<uint32_t>& loopGates) override;
         void onSimulationStateChanged(SimulationState newState) override;
         void onPerformanceWarning(const std::string& message) override;
+        void onQualityChanged(const QualitySettings& settings) override;
 
         // 신호 ID와 게이트 ID 매핑 설정
         void setSignalToGateMapping(const std::unordered_map<uint32_t, GateId>& mapping);
@@ -13,6 +13,18 @@ namespace simulation {
         size_t signalChanges;   // 프레임당 신호 변경 수
         size_t memoryUsage;     // 메모리 사용량 (bytes)
         int optimizationLevel;  // 현재 최적화 레벨 (0-4)
+        float simulationRatio;  // 시뮬레이션 시간 / 실제 시간 (따라잡고 있으면 속도 배율과 같음)
+        float simulationBacklog; // 다음 프레임으로 넘긴 시뮬레이션 시간 (초)
+        float simulationDropped; // 넘길 수 있는 상한을 넘어 버린 시뮬레이션 시간 (초, 누적)
+    };
+
+    // 품질 조절 항목: PerformanceManager가 최적화 레벨마다 정하고 렌더러/시뮬레이터가 매 프레임 따름
+    struct QualitySettings {
+        bool signalAnimations = true;   // 신호 토글 펄스 (게이트/와이어 셰이더)
+        bool signalGlow = true;         // 신호 강조 효과 (SimulationRenderer)
+        bool drawPorts = true;          // 게이트 포트 원
+        float lodPixelsPerCell = 6.0f;  // 셀이 이 픽셀 수보다 작게 보이면 청크 집계 타일로 그림
+        int maxStepsPerFrame = 8;       // 프레임당 최대 고정 스텝 (넘치는 시간은 버림)
     };
 
     // 시뮬레이션 설정
@@ -23,6 +35,8 @@ namespace simulation {
         size_t maxGates = 100000;       // 최대 게이트 수
         bool enableSIMD = true;         // SIMD 최적화 활성화
         bool enableLoopDetection = true; // 루프 감지 활성화
+        float stepBudgetMs = 4.0f;      // 프레임당 고정 스텝에 쓸 최대 실제 시간 (ms)
+        float maxBacklog = 0.5f;        // 넘겨 둘 수 있는 시뮬레이션 시간 상한 (초), 넘치면 버림
     };
 
     // 상수 정의
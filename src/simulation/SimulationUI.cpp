@@ -113,10 +113,23 @@ namespace simulation {
             ImGui::Text("FPS: %.1f", 1000.0f / std::max(0.001f, stats.frameTime));
             ImGui::Text("Frame Time: %.2f ms", stats.frameTime);
             ImGui::Text("Simulation Time: %.2f ms", stats.simulationTime);
+            ImGui::Text("Sim/Real Ratio: %.2fx (target %.2fx)", stats.simulationRatio, simulator->getSpeed());
+            ImGui::Text("Carried Over: %.0f ms (dropped %.1f s)", stats.simulationBacklog * 1000.0f,
+                        stats.simulationDropped);
             ImGui::Text("Active Gates: %zu", stats.activeGates);
             ImGui::Text("Signal Changes: %zu", stats.signalChanges);
             ImGui::Text("Memory Usage: %.1f MB", stats.memoryUsage / 1024.0f / 1024.0f);
 
+            // 서브시스템별 메모리 (바이트, 살아 있는 할당 수)
+            if (ImGui::TreeNode("Memory Breakdown")) {
+                const MemoryReport& report = simulator->getMemoryReport();
+                for (const MemoryReport::Entry& entry : report.entries) {
+                    ImGui::Text("%-20s %9.2f MB %10zu allocs", entry.name,
+                                entry.usage.bytes / 1024.0f / 1024.0f, entry.usage.allocations);
+                }
+                ImGui::TreePop();
+            }
+
             // 최적화 레벨 표시
             const char* levelNames[] = { "Ultra High", "High", "Medium", "Low", "Emergency" };
             int levelIndex = std::clamp(stats.optimizationLevel, 0, 4);
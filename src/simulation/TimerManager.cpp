@@ -91,6 +91,14 @@ namespace simulation {
         return gateToRemainingTime.size();
     }
 
+    MemoryUsage TimerManager::getMemoryUsage() const {
+        std::lock_guard<std::mutex> lock(timerMutex);
+        MemoryUsage usage = MemoryStats::Measure(timerQueue);
+        usage += MemoryStats::Measure(gateToRemainingTime);
+        usage += MemoryStats::Measure(expiredTimers);
+        return usage;
+    }
+
     float TimerManager::getRemainingTime(uint32_t gateId) const {
         std::lock_guard<std::mutex> lock(timerMutex);
         
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SimulationTypes.h"
+#include "../utils/MemoryStats.h"
 #include <queue>
 #include <unordered_map>
 #include <mutex>
@@ -41,6 +42,7 @@ namespace simulation {
         // 상태 조회
         size_t getActiveTimerCount() const;
         float getRemainingTime(uint32_t gateId) const;
+        MemoryUsage getMemoryUsage() const;
 
         // 초기화
         void reset();
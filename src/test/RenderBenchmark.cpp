@@ -0,0 +1,158 @@
+// 헤드리스 렌더 벤치마크
+// 큰 합성 회로를 널 백엔드로 기록해 프레임당 CPU 기록 시간과 업로드 바이트를 측정 (GPU/창 불필요)
+//
+// 사용법: render_benchmark [--gates N] [--frames F] [--toggle 비율] [--zoom Z]
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "core/Circuit.h"
+#include "core/CellWireManager.h"
+#include "render/RenderManager.h"
+
+namespace {
+
+struct BenchOptions {
+    size_t gates = 100000;
+    size_t frames = 300;
+    float toggleRatio = 0.01f;  // 프레임마다 출력이 바뀌는 게이트 비율
+    float zoom = 1.0f;
+};
+
+double Percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+    return values[index];
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--gates" && i + 1 < argc) {
+            options.gates = std::stoul(argv[++i]);
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::stoul(argv[++i]);
+        } else if (arg == "--toggle" && i + 1 < argc) {
+            options.toggleRatio = std::stof(argv[++i]);
+        } else if (arg == "--zoom" && i + 1 < argc) {
+            options.zoom = std::stof(argv[++i]);
+        }
+    }
+
+    // 셀 와이어 신호 갱신 로그가 측정을 방해하지 않도록
+    SDL_LogSetAllPriority(SDL_LOG_PRIORITY_WARN);
+
+    // 게이트는 3칸 간격 격자, 게이트 행 사이마다 가로 와이어 한 줄
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(options.gates))));
+    std::vector<Vec2> positions;
+    positions.reserve(options.gates);
+    for (size_t i = 0; i < options.gates; i++) {
+        int gx = static_cast<int>(i % side);
+        int gy = static_cast<int>(i / side);
+        positions.emplace_back(static_cast<float>(gx * 3), static_cast<float>(gy * 2));
+    }
+
+    Circuit circuit;
+    std::vector<GateId> gateIds;
+    circuit.addGatesBatch(positions, gateIds);
+
+    CellWireManager cellWires(&circuit);
+    const int rows = static_cast<int>((options.gates + side - 1) / side);
+    for (int gy = 0; gy < rows; gy++) {
+        cellWires.fillRect(glm::ivec2(1, gy * 2 + 1), glm::ivec2(side * 3 - 1, gy * 2 + 1),
+                           WireDirection::Left | WireDirection::Right);
+    }
+    cellWires.updateSignals();
+
+    RenderManager renderManager;
+    renderManager.InitializeHeadless(1920, 1080);
+    Camera& camera = renderManager.GetCamera();
+    camera.SetZoom(options.zoom);
+
+    std::cout << "=== Headless Render Benchmark ===" << std::endl;
+    std::cout << "gates: " << circuit.getGateCount()
+              << ", wire cells: " << cellWires.getWireCount()
+              << ", frames: " << options.frames
+              << ", toggle: " << options.toggleRatio
+              << ", zoom: " << options.zoom
+              << (renderManager.IsLodActive() ? " (LOD)" : "") << std::endl;
+
+    std::mt19937 rng(12345);
+    const size_t togglesPerFrame = static_cast<size_t>(static_cast<float>(gateIds.size()) * options.toggleRatio);
+    const float extentX = static_cast<float>(side * 3);
+    const float extentY = static_cast<float>(rows * 2);
+
+    std::vector<double> frameMs;
+    frameMs.reserve(options.frames);
+    RenderListStats steadyTotals;
+    size_t visibleGates = 0;
+    double firstFrameMs = 0.0;
+    size_t firstFrameUpload = 0;
+
+    for (size_t frame = 0; frame < options.frames; frame++) {
+        // 시뮬레이션 쪽 변경 (측정 제외)
+        if (frame > 0) {
+            for (size_t t = 0; t < togglesPerFrame; t++) {
+                GateId id = gateIds[rng() % gateIds.size()];
+                Gate* gate = circuit.getGate(id);
+                gate->currentOutput = gate->currentOutput == SignalState::HIGH ? SignalState::LOW : SignalState::HIGH;
+                circuit.markGateChanged(id);
+            }
+            cellWires.updateSignals();
+        }
+
+        // 회로 위를 대각선으로 천천히 이동 (청크 가시성 변화 포함)
+        float phase = static_cast<float>(frame) / static_cast<float>(std::max<size_t>(options.frames, 1));
+        camera.SetPosition(glm::vec2(extentX * phase, extentY * phase));
+
+        auto start = std::chrono::steady_clock::now();
+        renderManager.BeginFrame();
+        renderManager.RenderCircuit(circuit);
+        renderManager.RenderCellWires(cellWires);
+        renderManager.EndFrame();
+        auto end = std::chrono::steady_clock::now();
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        const RenderListStats& stats = renderManager.GetFrameStats();
+        if (frame == 0) {
+            // 첫 프레임은 전체 구축이라 따로 보고
+            firstFrameMs = ms;
+            firstFrameUpload = stats.uploadBytes;
+            continue;
+        }
+        frameMs.push_back(ms);
+        steadyTotals += stats;
+        visibleGates += renderManager.GetGateRenderer().GetStats().visibleInstances;
+    }
+
+    const double frames = static_cast<double>(std::max<size_t>(frameMs.size(), 1));
+    double sum = 0.0;
+    for (double ms : frameMs) sum += ms;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "first frame: " << firstFrameMs << " ms, "
+              << firstFrameUpload / 1024.0 << " KiB uploaded" << std::endl;
+    std::cout << "frame build (ms): avg " << sum / frames
+              << "  p50 " << Percentile(frameMs, 0.50)
+              << "  p95 " << Percentile(frameMs, 0.95)
+              << "  max " << Percentile(frameMs, 1.0) << std::endl;
+    std::cout << "per frame: upload " << steadyTotals.uploadBytes / frames / 1024.0 << " KiB in "
+              << steadyTotals.uploadCalls / frames << " calls, "
+              << steadyTotals.drawCalls / frames << " draws, "
+              << steadyTotals.commands / frames << " commands, "
+              << steadyTotals.uniformChanges / frames << " uniforms, "
+              << visibleGates / frames << " visible gates" << std::endl;
+
+    renderManager.Shutdown();
+    return 0;
+}
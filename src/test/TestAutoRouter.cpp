@@ -0,0 +1,101 @@
+#include <iostream>
+#include <cmath>
+#include <set>
+#include <utility>
+#include "../core/AutoRouter.h"
+#include "../core/CellWireManager.h"
+#include "../core/Circuit.h"
+#include "../core/Gate.h"
+
+namespace {
+
+using Cell = std::pair<int, int>;
+
+Cell cellOf(Vec2 pos) {
+    return Cell{static_cast<int>(std::floor(pos.x)), static_cast<int>(std::floor(pos.y))};
+}
+
+// 게이트 몸체와 모든 포트가 걸친 셀
+void collectGateCells(const Gate& gate, std::set<Cell>& cells) {
+    cells.insert(cellOf(gate.position));
+    cells.insert(cellOf(gate.getOutputPortPosition()));
+    for (PortIndex port = 0; port < Constants::MAX_INPUT_PORTS; ++port) {
+        cells.insert(cellOf(gate.getInputPortPosition(port)));
+    }
+}
+
+bool check(bool condition, const char* message) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << message << std::endl;
+    return condition;
+}
+
+// 두 넷이 일직선으로 가면 셋째 게이트의 몸체/포트 셀을 지나야 하는 배치
+bool testRoutesAvoidForeignPorts(unsigned threadCount) {
+    std::cout << "Routing past a third gate (threads: " << threadCount << ")" << std::endl;
+
+    Circuit circuit;
+    GateId fromA = circuit.addGate(Vec2(0.0f, 0.0f)).value;
+    GateId toA = circuit.addGate(Vec2(10.0f, 0.0f)).value;
+    GateId fromB = circuit.addGate(Vec2(0.0f, -3.0f)).value;
+    GateId toB = circuit.addGate(Vec2(10.0f, -3.0f)).value;
+    // 출력 (5, -1), 입력 (4, -2) / (4, -1): 두 넷 사이 행과 양쪽 행을 모두 막음
+    GateId bystander = circuit.addGate(Vec2(5.0f, -1.0f)).value;
+    GateId blocker = circuit.addGate(Vec2(5.0f, 0.0f)).value;
+    GateId blockerB = circuit.addGate(Vec2(5.0f, -3.0f)).value;
+
+    CellWireManager wires(&circuit);
+    AutoRouter router(&circuit);
+
+    AutoRouterConfig config;
+    config.threadCount = threadCount;
+    std::vector<RouteRequest> requests = {
+        RouteRequest{fromA, toA, 1},
+        RouteRequest{fromB, toB, 1},
+    };
+    auto result = router.route(requests, wires, config);
+
+    bool ok = check(result.success(), "route() succeeded");
+    ok &= check(result.value.routedConnections == 2, "both connections routed");
+
+    // 단자: 출력 포트 셀(CellWireManager::updateSignals 규칙)과 요청한 입력 포트 셀
+    std::set<Cell> terminals;
+    for (const RouteRequest& request : requests) {
+        const Gate* from = circuit.getGate(request.fromGate);
+        const Gate* to = circuit.getGate(request.toGate);
+        Cell source = cellOf(from->getOutputPortPosition());
+        terminals.insert(source);
+        terminals.insert(cellOf(to->getInputPortPosition(request.toPort)));
+        ok &= check(wires.getWireAt(glm::ivec2(source.first, source.second)) != nullptr,
+                    "wire starts on the output port cell");
+    }
+
+    std::set<Cell> reserved;
+    for (GateId id : {fromA, toA, fromB, toB, bystander, blocker, blockerB}) {
+        collectGateCells(*circuit.getGate(id), reserved);
+    }
+
+    size_t foreignCells = 0;
+    wires.forEachWire([&](const CellWire& wire) {
+        Cell cell = cellOf(wire.cellPos);
+        if (reserved.count(cell) && !terminals.count(cell)) {
+            std::cout << "    wire on gate/port cell (" << cell.first << ", " << cell.second << ")" << std::endl;
+            ++foreignCells;
+        }
+    });
+    ok &= check(foreignCells == 0, "no wire on another gate's body or port cell");
+
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Testing AutoRouter" << std::endl;
+
+    bool ok = true;
+    ok &= testRoutesAvoidForeignPorts(1);
+    ok &= testRoutesAvoidForeignPorts(4);
+
+    std::cout << (ok ? "All AutoRouter tests passed" : "AutoRouter tests FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
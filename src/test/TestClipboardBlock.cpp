@@ -0,0 +1,135 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../game/ClipboardBlock.h"
+
+namespace {
+
+// 바이트 레이아웃 (ClipboardBlock.cpp): 헤더 28바이트, 게이트/연결/셀 항목 각 9바이트
+constexpr size_t HEADER_BYTES = 28;
+constexpr size_t ENTRY_BYTES = 9;
+
+bool check(bool condition, const char* message) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << message << std::endl;
+    return condition;
+}
+
+ClipboardBlock makeBlock() {
+    ClipboardBlock block;
+    block.size = Vec2i{4, 3};
+    block.gates.push_back({Vec2i{0, 0}, GateType::NOT});
+    block.gates.push_back({Vec2i{3, 2}, GateType::NOT});
+    block.connections.push_back({0, 1, 2});
+    block.cells.push_back({Vec2i{1, 0}, 0x0A});
+    block.cells.push_back({Vec2i{2, 1}, 0x05});
+    return block;
+}
+
+bool sameBlock(const ClipboardBlock& a, const ClipboardBlock& b) {
+    if (a.size.x != b.size.x || a.size.y != b.size.y || a.gates.size() != b.gates.size() ||
+        a.connections.size() != b.connections.size() || a.cells.size() != b.cells.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.gates.size(); ++i) {
+        if (a.gates[i].offset.x != b.gates[i].offset.x || a.gates[i].offset.y != b.gates[i].offset.y ||
+            a.gates[i].type != b.gates[i].type) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.connections.size(); ++i) {
+        if (a.connections[i].fromIndex != b.connections[i].fromIndex ||
+            a.connections[i].toIndex != b.connections[i].toIndex ||
+            a.connections[i].toPort != b.connections[i].toPort) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.cells.size(); ++i) {
+        if (a.cells[i].offset.x != b.cells[i].offset.x || a.cells[i].offset.y != b.cells[i].offset.y ||
+            a.cells[i].connections != b.cells[i].connections) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool rejected(const std::vector<uint8_t>& bytes) {
+    return ClipboardBlock::deserialize(bytes).error == ErrorCode::INVALID_FORMAT;
+}
+
+bool testRoundTrip() {
+    std::cout << "Round trip" << std::endl;
+    ClipboardBlock block = makeBlock();
+    
+    std::vector<uint8_t> bytes = block.serialize();
+    bool ok = check(bytes.size() == HEADER_BYTES + 5 * ENTRY_BYTES, "serialized size has no padding");
+    
+    auto decoded = ClipboardBlock::deserialize(bytes);
+    ok &= check(decoded.success() && sameBlock(block, decoded.value), "bytes decode to the same block");
+    
+    auto fromText = ClipboardBlock::fromText(block.toText());
+    ok &= check(fromText.success() && sameBlock(block, fromText.value), "text decodes to the same block");
+    
+    auto empty = ClipboardBlock::deserialize(ClipboardBlock{}.serialize());
+    ok &= check(empty.success() && empty.value.empty(), "empty block round-trips");
+    return ok;
+}
+
+bool testCorruptedInput() {
+    std::cout << "Corrupted input" << std::endl;
+    const std::vector<uint8_t> bytes = makeBlock().serialize();
+    const size_t gateType = HEADER_BYTES + 8;                              // 첫 게이트의 타입 바이트
+    const size_t toPort = HEADER_BYTES + 2 * ENTRY_BYTES + 8;              // 첫 연결의 포트 바이트
+    const size_t toIndex = HEADER_BYTES + 2 * ENTRY_BYTES + 4;
+    const size_t cellMask = HEADER_BYTES + 3 * ENTRY_BYTES + 8;            // 첫 셀의 연결 비트
+    const size_t cellX = HEADER_BYTES + 3 * ENTRY_BYTES;
+    
+    bool truncatedAccepted = false;
+    for (size_t length = 0; length < bytes.size(); ++length) {
+        if (!rejected(std::vector<uint8_t>(bytes.begin(), bytes.begin() + length))) {
+            truncatedAccepted = true;
+        }
+    }
+    bool ok = check(!truncatedAccepted, "every truncation is rejected");
+    
+    auto corrupt = [&](size_t offset, uint8_t value) {
+        std::vector<uint8_t> copy = bytes;
+        copy[offset] = value;
+        return rejected(copy);
+    };
+    ok &= check(corrupt(0, 0x00), "bad magic is rejected");
+    ok &= check(corrupt(gateType, 7), "unknown gate type is rejected");
+    ok &= check(corrupt(toPort, 3), "input port past MAX_INPUT_PORTS is rejected");
+    ok &= check(corrupt(toPort, 0xFF), "negative input port is rejected");
+    ok &= check(corrupt(toIndex, 9), "connection to a missing gate is rejected");
+    ok &= check(corrupt(cellMask, 0x10), "unknown wire direction bit is rejected");
+    ok &= check(corrupt(cellX, 4), "cell outside the block is rejected");
+    
+    std::vector<uint8_t> hugeCount = bytes;
+    hugeCount[16] = hugeCount[17] = hugeCount[18] = 0xFF;                 // gateCount
+    hugeCount[19] = 0x7F;
+    ok &= check(rejected(hugeCount), "gate count beyond the data is rejected");
+    
+    const std::string text = makeBlock().toText();
+    ok &= check(ClipboardBlock::fromText("hello").error == ErrorCode::INVALID_FORMAT,
+                "plain text is not a block");
+    ok &= check(ClipboardBlock::fromText(text.substr(0, text.size() - 1)).error == ErrorCode::INVALID_FORMAT,
+                "truncated text is rejected");
+    std::string badChar = text;
+    badChar[badChar.size() / 2] = '*';
+    ok &= check(ClipboardBlock::fromText(badChar).error == ErrorCode::INVALID_FORMAT,
+                "invalid base64 character is rejected");
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Testing ClipboardBlock" << std::endl;
+    
+    bool ok = true;
+    ok &= testRoundTrip();
+    ok &= testCorruptedInput();
+    
+    std::cout << (ok ? "All ClipboardBlock tests passed" : "ClipboardBlock tests FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
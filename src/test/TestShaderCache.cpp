@@ -0,0 +1,279 @@
+#include "../render/ShaderCache.h"
+#include <SDL2/SDL.h>
+#include <glad/glad.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 셰이더 바이너리 캐시 테스트
+// 소프트웨어 GL(예: Mesa llvmpipe)로도 충분하며, 바이너리 형식이 없는 드라이버면 건너뜀
+
+namespace fs = std::filesystem;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const char* message) {
+    std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << message << std::endl;
+    if (!condition) {
+        ++g_failures;
+    }
+}
+
+const std::string VERTEX_SOURCE = R"(#version 330 core
+layout(location = 0) in vec2 aPosition;
+uniform vec2 uOffset;
+void main() {
+    gl_Position = vec4(aPosition + uOffset, 0.0, 1.0);
+}
+)";
+
+const std::string FRAGMENT_SOURCE = R"(#version 330 core
+uniform vec4 uColor;
+out vec4 FragColor;
+void main() {
+    FragColor = uColor;
+}
+)";
+
+// ShaderCache.cpp의 FileHeader와 같은 배치 (magic, version, key, format, length)
+constexpr size_t HEADER_MAGIC_OFFSET = 0;
+constexpr size_t HEADER_FORMAT_OFFSET = 16;
+constexpr size_t HEADER_SIZE = 24;
+
+GLuint CompileShader(GLenum type, const std::string& source) {
+    GLuint shader = glCreateShader(type);
+    const char* text = source.c_str();
+    glShaderSource(shader, 1, &text, nullptr);
+    glCompileShader(shader);
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// ShaderProgram과 같은 순서로 링크하고 캐시에 저장
+GLuint BuildAndStore() {
+    GLuint vertex = CompileShader(GL_VERTEX_SHADER, VERTEX_SOURCE);
+    GLuint fragment = CompileShader(GL_FRAGMENT_SHADER, FRAGMENT_SOURCE);
+    if (!vertex || !fragment) {
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    ShaderCache::PrepareForLink(program);
+    glLinkProgram(program);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        glDeleteProgram(program);
+        return 0;
+    }
+    ShaderCache::StoreProgram(program, VERTEX_SOURCE, FRAGMENT_SOURCE);
+    return program;
+}
+
+bool IsLinked(GLuint program) {
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    return linked == GL_TRUE;
+}
+
+std::vector<fs::path> ListEntries(const fs::path& directory) {
+    std::vector<fs::path> entries;
+    std::error_code error;
+    for (const fs::directory_entry& entry : fs::directory_iterator(directory, error)) {
+        if (entry.path().extension() == ".bin") {
+            entries.push_back(entry.path());
+        }
+    }
+    return entries;
+}
+
+bool PatchFile(const fs::path& path, size_t offset, uint32_t value) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.seekp(static_cast<std::streamoff>(offset));
+    return static_cast<bool>(file.write(reinterpret_cast<const char*>(&value), sizeof(value)));
+}
+
+// 캐시를 비운 뒤 한 번 저장해서 항목 하나를 만들어 둠
+fs::path StoreSingleEntry(const fs::path& directory) {
+    std::error_code error;
+    fs::remove_all(directory, error);
+    GLuint program = BuildAndStore();
+    glDeleteProgram(program);
+    std::vector<fs::path> entries = ListEntries(directory);
+    return entries.size() == 1 ? entries[0] : fs::path();
+}
+
+void TestMissStoreHit(const fs::path& directory) {
+    std::cout << "Miss -> store -> hit" << std::endl;
+    std::error_code error;
+    fs::remove_all(directory, error);
+
+    ShaderCache::Stats before = ShaderCache::GetStats();
+    GLuint cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    ShaderCache::Stats afterMiss = ShaderCache::GetStats();
+    check(cached == 0, "empty cache returns no program");
+    check(afterMiss.misses == before.misses + 1, "empty cache counts a miss");
+
+    GLuint program = BuildAndStore();
+    ShaderCache::Stats afterStore = ShaderCache::GetStats();
+    check(program != 0, "program links");
+    check(afterStore.stores == afterMiss.stores + 1, "linked program is stored");
+    check(ListEntries(directory).size() == 1, "one entry written to the cache directory");
+    glDeleteProgram(program);
+
+    cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    ShaderCache::Stats afterHit = ShaderCache::GetStats();
+    check(cached != 0 && IsLinked(cached), "stored program loads back linked");
+    check(afterHit.hits == afterStore.hits + 1, "second load counts a hit");
+    check(cached != 0 && glGetUniformLocation(cached, "uColor") != -1, "loaded program keeps its uniforms");
+    glDeleteProgram(cached);
+}
+
+void ExpectRejected(const fs::path& entry, const char* loadMessage, const char* removeMessage) {
+    ShaderCache::Stats before = ShaderCache::GetStats();
+    GLuint cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    ShaderCache::Stats after = ShaderCache::GetStats();
+    check(cached == 0 && after.rejected == before.rejected + 1, loadMessage);
+    check(!fs::exists(entry), removeMessage);
+    glDeleteProgram(cached);
+}
+
+void TestCorruptedEntries(const fs::path& directory) {
+    std::cout << "Corrupted and truncated entries" << std::endl;
+
+    fs::path entry = StoreSingleEntry(directory);
+    check(!entry.empty(), "entry stored for the bad magic case");
+    check(PatchFile(entry, HEADER_MAGIC_OFFSET, 0xDEADBEEFu), "header magic overwritten");
+    ExpectRejected(entry, "entry with a bad magic is rejected", "entry with a bad magic is deleted");
+
+    entry = StoreSingleEntry(directory);
+    check(!entry.empty(), "entry stored for the truncated case");
+    std::error_code error;
+    uintmax_t size = fs::file_size(entry, error);
+    fs::resize_file(entry, HEADER_SIZE + (size - HEADER_SIZE) / 2, error);
+    check(!error, "entry truncated to half its binary");
+    ExpectRejected(entry, "truncated entry is rejected", "truncated entry is deleted");
+
+    entry = StoreSingleEntry(directory);
+    check(!entry.empty(), "entry stored for the unknown format case");
+    check(PatchFile(entry, HEADER_FORMAT_OFFSET, 0xFFFFFFFFu), "binary format overwritten");
+    ExpectRejected(entry, "binary the driver refuses is rejected", "binary the driver refuses is deleted");
+
+    GLuint program = BuildAndStore();
+    GLuint cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    check(cached != 0, "rejected entry is replaced by the next store");
+    glDeleteProgram(program);
+    glDeleteProgram(cached);
+}
+
+void TestDriverChange(const fs::path& directory) {
+    std::cout << "Driver string change" << std::endl;
+
+    fs::path original = StoreSingleEntry(directory);
+    check(!original.empty(), "entry stored for the real driver");
+
+    ShaderCache::SetDriverOverride("Test Vendor|Test Renderer|9.9 Test");
+    GLuint cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    check(cached == 0, "other driver string misses the stored entry");
+    check(fs::exists(original), "other driver string leaves the old entry alone");
+
+    GLuint program = BuildAndStore();
+    std::vector<fs::path> entries = ListEntries(directory);
+    check(entries.size() == 2, "other driver string stores under a new key");
+    glDeleteProgram(program);
+
+    ShaderCache::SetDriverOverride("");
+    cached = ShaderCache::LoadProgram(VERTEX_SOURCE, FRAGMENT_SOURCE);
+    check(cached != 0, "original driver string hits its entry again");
+    glDeleteProgram(cached);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        std::cerr << "Failed to initialize SDL: " << SDL_GetError() << std::endl;
+        return -1;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+
+    SDL_Window* window = SDL_CreateWindow(
+        "Shader Cache Test",
+        SDL_WINDOWPOS_UNDEFINED,
+        SDL_WINDOWPOS_UNDEFINED,
+        1, 1,
+        SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+    );
+    if (!window) {
+        std::cerr << "Failed to create window: " << SDL_GetError() << std::endl;
+        SDL_Quit();
+        return -1;
+    }
+
+    SDL_GLContext context = SDL_GL_CreateContext(window);
+    if (!context) {
+        std::cerr << "Failed to create OpenGL context: " << SDL_GetError() << std::endl;
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return -1;
+    }
+
+    if (!gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress)) {
+        std::cerr << "Failed to initialize GLAD" << std::endl;
+        SDL_GL_DeleteContext(context);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return -1;
+    }
+
+    std::cout << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
+
+    // 실제 캐시 위치를 건드리지 않도록 임시 디렉터리 사용
+    fs::path directory = fs::temp_directory_path() / "notgate_shader_cache_test";
+    ShaderCache::SetDirectory(directory.string());
+
+    int result = 0;
+    if (!ShaderCache::IsAvailable()) {
+        std::cout << "[SKIP] driver exposes no program binary formats" << std::endl;
+    } else {
+        TestMissStoreHit(directory);
+        TestCorruptedEntries(directory);
+        TestDriverChange(directory);
+
+        if (g_failures == 0) {
+            std::cout << "All ShaderCache tests passed" << std::endl;
+        } else {
+            std::cout << g_failures << " ShaderCache check(s) failed" << std::endl;
+            result = 1;
+        }
+    }
+
+    std::error_code error;
+    fs::remove_all(directory, error);
+
+    SDL_GL_DeleteContext(context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return result;
+}
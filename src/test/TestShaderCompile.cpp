@@ -74,6 +74,15 @@ int main(int argc, char* argv[]) {
         if (gridShader) {
             std::cout << "  Grid shader uniforms:" << std::endl;
             gridShader->PrintActiveUniforms();
+            
+            // GridRenderer가 설정하는 uniform이 모두 남아 있어야 함 (최적화로 빠지면 -1)
+            for (const char* name : {"uInvViewProj", "uGridColor", "uGridOpacity",
+                                     "uPixelsPerCell", "uGridBounds", "uBounded"}) {
+                if (gridShader->GetUniformLocation(name) == -1) {
+                    std::cout << "  Missing grid uniform: " << name << std::endl;
+                    allShadersLoaded = false;
+                }
+            }
         }
     } else {
         std::cout << "FAILED" << std::endl;
@@ -87,6 +87,10 @@ public:
             return false;
         }
         
+        if (!CheckGridUniforms()) {
+            return false;
+        }
+        
         // Enable hot reload in debug mode
         #ifdef DEBUG
         m_shaderManager.SetHotReloadEnabled(true);
@@ -105,6 +109,30 @@ public:
         return true;
     }
     
+    // 절차적 그리드 셰이더가 쓰는 uniform이 모두 활성 상태인지 확인
+    bool CheckGridUniforms() {
+        ShaderProgram* gridShader = m_shaderManager.GetShader("grid");
+        if (!gridShader || !gridShader->IsValid()) {
+            std::cerr << "Grid shader not loaded" << std::endl;
+            return false;
+        }
+        
+        bool ok = true;
+        for (const char* name : {"uInvViewProj", "uGridColor", "uGridOpacity",
+                                 "uPixelsPerCell", "uGridBounds", "uBounded"}) {
+            if (gridShader->GetUniformLocation(name) == -1) {
+                std::cerr << "Grid shader uniform not found: " << name << std::endl;
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    
+    // 창 높이 720픽셀에 월드 20 / m_zoom 단위가 보임 (HandleMouseWheel의 투영과 같음)
+    float PixelsPerCell() const {
+        return 720.0f / (20.0f / m_zoom);
+    }
+    
     void SetupGeometry() {
         // Grid quad (fullscreen)
         float gridVertices[] = {
@@ -205,14 +233,12 @@ public:
         ShaderProgram* gridShader = m_shaderManager.GetShader("grid");
         if (gridShader && gridShader->IsValid()) {
             gridShader->Use();
-            gridShader->SetUniform("uProjection", m_projection);
-            gridShader->SetUniform("uView", m_view);
             gridShader->SetUniform("uInvViewProj", invViewProj);
-            gridShader->SetUniform("uGridSize", 1.0f);
-            gridShader->SetUniform("uGridColor", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f));
-            gridShader->SetUniform("uSubGridColor", glm::vec4(0.3f, 0.3f, 0.3f, 0.3f));
-            gridShader->SetUniform("uCameraPos", m_cameraPos);
-            gridShader->SetUniform("uZoom", m_zoom);
+            gridShader->SetUniform("uGridColor", glm::vec4(0.5f, 0.5f, 0.5f, 1.0f));
+            gridShader->SetUniform("uGridOpacity", 0.5f);
+            gridShader->SetUniform("uPixelsPerCell", PixelsPerCell());
+            gridShader->SetUniform("uGridBounds", glm::vec4(0.0f));
+            gridShader->SetUniform("uBounded", 0);
             
             glBindVertexArray(m_gridVAO);
             glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
@@ -0,0 +1,158 @@
+#include "ProfilerPanel.h"
+#include "../render/GLState.h"
+#include <imgui.h>
+#include <algorithm>
+#include <cstdio>
+
+void ProfilerPanel::render() noexcept {
+    if (!isVisible) {
+        return;
+    }
+
+    if (!isPaused) {
+        Profiler::CollectLastFrame(frameZones, frameStart, frameEnd);
+        updateAverages();
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(720, 420), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Profiler", &isVisible, ImGuiWindowFlags_NoFocusOnAppearing)) {
+#if !defined(ENABLE_PROFILER_ZONES)
+        ImGui::TextDisabled("Profiling zones are compiled out (configure with -DENABLE_PROFILER_ZONES=ON)");
+#endif
+        ImGui::Checkbox("Pause", &isPaused);
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome Trace")) {
+            const char* path = "notgate_trace.json";
+            exportStatus = Profiler::ExportChromeTrace(path) ? std::string("Saved ") + path
+                                                             : std::string("Failed to write ") + path;
+        }
+        if (!exportStatus.empty()) {
+            ImGui::SameLine();
+            ImGui::TextUnformatted(exportStatus.c_str());
+        }
+
+        if (frameEnd > frameStart) {
+            ImGui::Text("Frame: %.2f ms, %zu zones", Profiler::TicksToMs(frameEnd - frameStart), frameZones.size());
+        }
+        if (timer) {
+            const Timer::PacingStats& pacing = timer->getPacingStats();
+            ImGui::Text("Pacing: oversleep %.3f ms (avg %.3f, max %.3f), spin %.3f ms, idle work %.2f ms, missed %u",
+                        pacing.lastOversleep * 1000.0f, pacing.averageOversleep * 1000.0f,
+                        pacing.maxOversleep * 1000.0f, pacing.spinMargin * 1000.0f,
+                        pacing.idleWorkTime * 1000.0f, pacing.missedDeadlines);
+        }
+        const GLState::Counters& glState = GLState::GetLastFrameCounters();
+        ImGui::Text("GL binds: program %u (skipped %u), VAO %u (skipped %u), buffer %u (skipped %u)",
+                    glState.programBinds, glState.programSkips, glState.vertexArrayBinds,
+                    glState.vertexArraySkips, glState.bufferBinds, glState.bufferSkips);
+
+        ImGui::Separator();
+        renderTimeline();
+        ImGui::Separator();
+        renderZoneTable();
+    }
+    ImGui::End();
+}
+
+void ProfilerPanel::renderTimeline() noexcept {
+    if (frameEnd <= frameStart || frameZones.empty()) {
+        ImGui::TextDisabled("No zones recorded in the last frame");
+        return;
+    }
+
+    constexpr float ROW_HEIGHT = 18.0f;
+    constexpr float LANE_GAP = 6.0f;
+    constexpr float LABEL_WIDTH = 80.0f;
+
+    // 스레드별 레인, 레인 안에서는 중첩 깊이별 행
+    std::vector<Profiler::ThreadInfo> threads = Profiler::GetThreads();
+    std::vector<uint32_t> laneDepth(threads.size(), 0);
+    for (const Profiler::Zone& zone : frameZones) {
+        if (zone.thread < laneDepth.size()) {
+            laneDepth[zone.thread] = std::max(laneDepth[zone.thread], zone.depth + 1);
+        }
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(100.0f, ImGui::GetContentRegionAvail().x - LABEL_WIDTH);
+    const double frameTicks = static_cast<double>(frameEnd - frameStart);
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+
+    std::vector<float> laneTop(threads.size(), 0.0f);
+    float y = origin.y;
+    for (size_t i = 0; i < threads.size(); ++i) {
+        if (laneDepth[i] == 0) {
+            continue;
+        }
+        laneTop[i] = y;
+        drawList->AddText(ImVec2(origin.x, y + 2.0f), IM_COL32(200, 200, 200, 255), threads[i].name.c_str());
+        y += laneDepth[i] * ROW_HEIGHT + LANE_GAP;
+    }
+
+    const Profiler::Zone* hovered = nullptr;
+    for (const Profiler::Zone& zone : frameZones) {
+        if (zone.thread >= threads.size()) {
+            continue;
+        }
+        float x0 = origin.x + LABEL_WIDTH + static_cast<float>((zone.start - frameStart) / frameTicks) * width;
+        float x1 = origin.x + LABEL_WIDTH + static_cast<float>(
+            std::min<double>(1.0, (zone.end - frameStart) / frameTicks)) * width;
+        x1 = std::max(x1, x0 + 1.0f);
+        float y0 = laneTop[zone.thread] + zone.depth * ROW_HEIGHT;
+        float y1 = y0 + ROW_HEIGHT - 1.0f;
+
+        // 이름 포인터로 색을 정해 같은 구간은 프레임마다 같은 색
+        uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(zone.name) * 2654435761u);
+        ImU32 color = IM_COL32(80 + (hash & 0x7F), 80 + ((hash >> 8) & 0x7F), 80 + ((hash >> 16) & 0x7F), 255);
+        drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), color);
+
+        if (x1 - x0 > 40.0f) {
+            drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+            drawList->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), zone.name);
+            drawList->PopClipRect();
+        }
+
+        if (mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1) {
+            hovered = &zone;
+        }
+    }
+
+    ImGui::Dummy(ImVec2(width + LABEL_WIDTH, std::max(ROW_HEIGHT, y - origin.y)));
+
+    if (hovered && ImGui::IsWindowHovered()) {
+        ImGui::BeginTooltip();
+        ImGui::Text("%s", hovered->name);
+        ImGui::Text("%.3f ms", Profiler::TicksToMs(hovered->end - hovered->start));
+        ImGui::EndTooltip();
+    }
+}
+
+void ProfilerPanel::renderZoneTable() noexcept {
+    std::vector<std::pair<const char*, float>> rows(averageMs.begin(), averageMs.end());
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+
+    ImGui::Text("Average per frame");
+    ImGui::BeginChild("ZoneTable", ImVec2(0, 0), false);
+    for (const auto& [name, ms] : rows) {
+        ImGui::Text("%8.3f ms  %s", ms, name);
+    }
+    ImGui::EndChild();
+}
+
+void ProfilerPanel::updateAverages() noexcept {
+    // 같은 이름이 한 프레임에 여러 번이면 합산
+    std::unordered_map<const char*, float> frameTotals;
+    for (const Profiler::Zone& zone : frameZones) {
+        frameTotals[zone.name] += static_cast<float>(Profiler::TicksToMs(zone.end - zone.start));
+    }
+
+    constexpr float SMOOTHING = 0.1f;
+    for (auto& [name, average] : averageMs) {
+        auto it = frameTotals.find(name);
+        average += SMOOTHING * ((it != frameTotals.end() ? it->second : 0.0f) - average);
+    }
+    for (const auto& [name, total] : frameTotals) {
+        averageMs.try_emplace(name, total);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "../utils/Profiler.h"
+#include "../core/Timer.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 직전 프레임의 계측 구간을 스레드별 타임라인(플레임 그래프)과 구간별 시간 표로 표시
+class ProfilerPanel {
+private:
+    bool isVisible{false};
+    bool isPaused{false};
+
+    std::vector<Profiler::Zone> frameZones;
+    uint64_t frameStart{0};
+    uint64_t frameEnd{0};
+
+    // 구간 이름(리터럴 포인터)별 프레임 합계의 지수 이동 평균 (ms)
+    std::unordered_map<const char*, float> averageMs;
+    std::string exportStatus;
+    const Timer* timer{nullptr};       // 프레임 제한 대기 통계용 (없으면 표시 안 함)
+
+public:
+    ProfilerPanel() = default;
+    ~ProfilerPanel() = default;
+
+    void render() noexcept;
+
+    void setTimer(const Timer* frameTimer) noexcept { timer = frameTimer; }
+    void setVisible(bool visible) noexcept { isVisible = visible; }
+    void toggleVisible() noexcept { isVisible = !isVisible; }
+    [[nodiscard]] bool getVisible() const noexcept { return isVisible; }
+
+private:
+    void renderTimeline() noexcept;
+    void renderZoneTable() noexcept;
+    void updateAverages() noexcept;
+};
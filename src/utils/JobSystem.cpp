@@ -0,0 +1,90 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned threadCount)
+    : m_job(nullptr)
+    , m_count(0)
+    , m_next(0)
+    , m_pending(0)
+    , m_generation(0)
+    , m_quit(false) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_threads.reserve(threadCount - 1);
+    for (unsigned worker = 1; worker < threadCount; ++worker) {
+        m_threads.emplace_back(&JobSystem::WorkerLoop, this, worker);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, const std::function<void(size_t, unsigned)>& fn) {
+    if (count == 0) {
+        return;
+    }
+
+    // 항목이 하나뿐이거나 워커가 없으면 깨우는 비용 없이 바로 실행
+    if (count == 1 || m_threads.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &fn;
+        m_count = count;
+        m_next.store(0, std::memory_order_relaxed);
+        m_pending = static_cast<unsigned>(m_threads.size());
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    RunItems(0);
+
+    // 늦게 깨어난 워커도 m_job을 놓을 때까지 기다린 뒤 반환
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_pending == 0; });
+    m_job = nullptr;
+}
+
+void JobSystem::RunItems(unsigned worker) {
+    for (size_t i = m_next.fetch_add(1); i < m_count; i = m_next.fetch_add(1)) {
+        (*m_job)(i, worker);
+    }
+}
+
+void JobSystem::WorkerLoop(unsigned worker) {
+    PROFILE_THREAD("Job Worker");
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_quit || m_generation != seen; });
+            if (m_quit) {
+                return;
+            }
+            seen = m_generation;
+        }
+
+        RunItems(worker);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_pending == 0) {
+            m_done.notify_one();
+        }
+    }
+}
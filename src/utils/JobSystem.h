@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 프레임 단위 병렬 작업용 고정 워커 스레드 풀
+// 스레드는 생성 시 한 번만 만들고, ParallelFor 호출마다 깨워서 항목을 나눠 가져감
+// 호출 스레드도 워커 0으로 참여하며, 모든 항목이 끝나야 반환
+class JobSystem {
+public:
+    // threadCount: 호출 스레드를 포함한 전체 워커 수 (0이면 hardware_concurrency)
+    explicit JobSystem(unsigned threadCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // 워커별 스테이징 버퍼 개수를 정할 때 사용
+    unsigned GetWorkerCount() const { return static_cast<unsigned>(m_threads.size()) + 1; }
+
+    // fn(index, worker)를 [0, count) 항목마다 한 번씩 호출. worker는 [0, GetWorkerCount())
+    // 같은 worker 번호는 동시에 두 스레드에서 쓰이지 않으므로 워커별 버퍼를 잠금 없이 사용 가능
+    void ParallelFor(size_t count, const std::function<void(size_t, unsigned)>& fn);
+
+private:
+    void WorkerLoop(unsigned worker);
+    void RunItems(unsigned worker);
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    const std::function<void(size_t, unsigned)>* m_job;
+    size_t m_count;
+    std::atomic<size_t> m_next;
+    unsigned m_pending;             // 아직 이번 작업을 마치지 않은 워커 스레드 수
+    uint64_t m_generation;          // ParallelFor 호출마다 증가 (워커가 새 작업을 구분)
+    bool m_quit;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// 서브시스템별 힙 사용량 집계
+// 할당자를 바꾸지 않고 컨테이너의 capacity/bucket 수로 계산 (읽기만 하므로 핫 패스에 비용 없음)
+// - bytes: 컨테이너가 잡고 있는 힙 바이트 (사용 중이 아닌 예약분 포함)
+// - allocations: 살아 있는 힙 블록 수 (vector는 1개, 노드 기반 컨테이너는 노드마다 1개 + 버킷 배열)
+struct MemoryUsage {
+    size_t bytes = 0;
+    size_t allocations = 0;
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        bytes += other.bytes;
+        allocations += other.allocations;
+        return *this;
+    }
+};
+
+// 한 번에 모은 서브시스템별 사용량 (이름은 문자열 리터럴)
+struct MemoryReport {
+    struct Entry {
+        const char* name;
+        MemoryUsage usage;
+    };
+
+    std::vector<Entry> entries;
+
+    void Add(const char* name, const MemoryUsage& usage) { entries.push_back({name, usage}); }
+    void Clear() { entries.clear(); }
+
+    MemoryUsage GetTotal() const {
+        MemoryUsage total;
+        for (const Entry& entry : entries) {
+            total += entry.usage;
+        }
+        return total;
+    }
+};
+
+namespace MemoryStats {
+
+// malloc은 16바이트 단위로 잡으므로 작은 노드는 실제보다 작게 보이지 않게 올림
+constexpr size_t RoundAllocation(size_t bytes) {
+    return (bytes + 15) & ~size_t(15);
+}
+
+constexpr MemoryUsage Block(size_t bytes) {
+    return bytes > 0 ? MemoryUsage{bytes, 1} : MemoryUsage{};
+}
+
+template<typename T, typename Alloc>
+MemoryUsage Measure(const std::vector<T, Alloc>& v) {
+    return Block(v.capacity() * sizeof(T));
+}
+
+// 노드 = 다음 노드 포인터 + 값 + 캐시된 해시 (libstdc++ 기준 추정)
+template<typename Value, typename Node = Value>
+MemoryUsage MeasureHashed(size_t size, size_t bucketCount) {
+    size_t nodeBytes = RoundAllocation(sizeof(void*) + sizeof(Node) + sizeof(size_t));
+    MemoryUsage usage{size * nodeBytes, size};
+    if (bucketCount > 1) {
+        usage += Block(bucketCount * sizeof(void*));
+    }
+    return usage;
+}
+
+template<typename K, typename V, typename H, typename E, typename A>
+MemoryUsage Measure(const std::unordered_map<K, V, H, E, A>& m) {
+    return MeasureHashed<typename std::unordered_map<K, V, H, E, A>::value_type>(m.size(), m.bucket_count());
+}
+
+template<typename K, typename H, typename E, typename A>
+MemoryUsage Measure(const std::unordered_set<K, H, E, A>& s) {
+    return MeasureHashed<K>(s.size(), s.bucket_count());
+}
+
+// deque는 512바이트 블록 + 블록 포인터 맵 (libstdc++ 기준 추정)
+template<typename T, typename A>
+MemoryUsage Measure(const std::deque<T, A>& d) {
+    constexpr size_t BLOCK_BYTES = sizeof(T) < 512 ? 512 : sizeof(T);
+    constexpr size_t PER_BLOCK = BLOCK_BYTES / sizeof(T);
+    size_t blocks = d.size() / PER_BLOCK + 1;
+    MemoryUsage usage{blocks * BLOCK_BYTES, blocks};
+    usage += Block(std::max<size_t>(8, blocks + 2) * sizeof(void*));
+    return usage;
+}
+
+// priority_queue는 내부 컨테이너(protected c)를 측정
+template<typename T, typename C, typename Cmp>
+MemoryUsage Measure(const std::priority_queue<T, C, Cmp>& q) {
+    struct Access : std::priority_queue<T, C, Cmp> {
+        static const C& Container(const std::priority_queue<T, C, Cmp>& queue) {
+            return queue.*(&Access::c);
+        }
+    };
+    return Measure(Access::Container(q));
+}
+
+} // namespace MemoryStats
@@ -0,0 +1,242 @@
+#include "Profiler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_HAS_TSC 1
+#endif
+
+namespace {
+
+// 스레드당 최근 32768개 구간 (60fps에서 프레임당 500개씩이면 약 1초)
+constexpr size_t ZONE_CAPACITY = 1u << 15;
+
+// 링 버퍼 한 칸 (칸마다 seqlock)
+// sequence: 구간 i를 쓰는 중이면 2i+1, 다 쓰면 2i+2 → 읽는 쪽은 앞뒤로 2i+2를 확인해 찢어진 값을 버림
+// 필드도 atomic이라 덮어쓰기와 복사가 겹쳐도 데이터 경합이 아님
+struct ZoneSlot {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> start{0};
+    std::atomic<uint64_t> end{0};
+    std::atomic<uint32_t> depth{0};
+};
+
+struct ThreadBuffer {
+    uint32_t id = 0;
+    std::string name;
+    std::unique_ptr<ZoneSlot[]> zones{new ZoneSlot[ZONE_CAPACITY]};
+    std::atomic<uint64_t> written{0};
+    uint32_t depth = 0;             // 소유 스레드만 접근
+};
+
+// 버퍼는 프로세스가 끝날 때까지 해제하지 않음 (스레드가 끝나도 기록은 남음)
+std::mutex s_registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+std::atomic<uint64_t> s_frameStarts[2] = {{0}, {0}};   // [0] 직전 프레임 시작, [1] 현재 프레임 시작
+
+ThreadBuffer& LocalBuffer() {
+    if (!t_buffer) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(s_registryMutex);
+        buffer->id = static_cast<uint32_t>(s_buffers.size());
+        buffer->name = buffer->id == 0 ? "Main" : "Thread " + std::to_string(buffer->id);
+        t_buffer = buffer.get();
+        s_buffers.push_back(std::move(buffer));
+    }
+    return *t_buffer;
+}
+
+// 쓰는 스레드는 멈추지 않으므로 칸마다 sequence를 앞뒤로 확인하고, 그 사이 덮어쓴 칸은 건너뜀
+template<typename Fn>
+void ForEachRecordedZone(const ThreadBuffer& buffer, Fn&& fn) {
+    uint64_t written = buffer.written.load(std::memory_order_acquire);
+    uint64_t first = written > ZONE_CAPACITY ? written - ZONE_CAPACITY : 0;
+
+    for (uint64_t i = first; i < written; ++i) {
+        const ZoneSlot& slot = buffer.zones[i & (ZONE_CAPACITY - 1)];
+        const uint64_t expected = 2 * i + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            continue;
+        }
+
+        Profiler::Zone zone{slot.name.load(std::memory_order_relaxed),
+                            slot.start.load(std::memory_order_relaxed),
+                            slot.end.load(std::memory_order_relaxed),
+                            buffer.id,
+                            slot.depth.load(std::memory_order_relaxed)};
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+            continue;
+        }
+        fn(zone);
+    }
+}
+
+struct Clock {
+    uint64_t tickBase;
+    std::chrono::steady_clock::time_point timeBase;
+};
+
+const Clock& ClockBase() {
+    static const Clock base{Profiler::Now(), std::chrono::steady_clock::now()};
+    return base;
+}
+
+void WriteEscaped(FILE* file, const std::string& text) {
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(c, file);
+    }
+}
+
+} // namespace
+
+uint64_t Profiler::Now() {
+#if defined(PROFILER_HAS_TSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+double Profiler::TicksToMs(uint64_t ticks) {
+#if defined(PROFILER_HAS_TSC)
+    // TSC 주파수는 첫 호출 이후 경과 시간으로 추정하고, 충분히 지나면 고정
+    static std::atomic<double> s_msPerTick{0.0};
+    double msPerTick = s_msPerTick.load(std::memory_order_relaxed);
+    if (msPerTick == 0.0) {
+        const Clock& base = ClockBase();
+        uint64_t elapsedTicks = Now() - base.tickBase;
+        double elapsedMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - base.timeBase).count();
+        if (elapsedTicks == 0 || elapsedMs <= 0.0) {
+            return 0.0;
+        }
+        msPerTick = elapsedMs / static_cast<double>(elapsedTicks);
+        if (elapsedMs > 500.0) {
+            s_msPerTick.store(msPerTick, std::memory_order_relaxed);
+        }
+    }
+    return static_cast<double>(ticks) * msPerTick;
+#else
+    return static_cast<double>(ticks) / 1.0e6;
+#endif
+}
+
+void Profiler::SetThreadName(const char* name) {
+    ThreadBuffer& buffer = LocalBuffer();
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    buffer.name = name;
+}
+
+void Profiler::MarkFrame() {
+    ClockBase();
+    uint64_t now = Now();
+    s_frameStarts[0].store(s_frameStarts[1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    s_frameStarts[1].store(now, std::memory_order_release);
+}
+
+void Profiler::CollectLastFrame(std::vector<Zone>& zones, uint64_t& frameStart, uint64_t& frameEnd) {
+    zones.clear();
+    frameEnd = s_frameStarts[1].load(std::memory_order_acquire);
+    frameStart = s_frameStarts[0].load(std::memory_order_relaxed);
+    if (frameStart == 0 || frameEnd <= frameStart) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    for (const auto& buffer : s_buffers) {
+        ForEachRecordedZone(*buffer, [&](const Zone& zone) {
+            if (zone.start >= frameStart && zone.start < frameEnd) {
+                zones.push_back(zone);
+            }
+        });
+    }
+}
+
+std::vector<Profiler::ThreadInfo> Profiler::GetThreads() {
+    std::vector<ThreadInfo> threads;
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    for (const auto& buffer : s_buffers) {
+        threads.push_back({buffer->id, buffer->name});
+    }
+    return threads;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    const uint64_t origin = ClockBase().tickBase;
+    bool first = true;
+    auto separator = [&]() {
+        std::fputs(first ? "\n" : ",\n", file);
+        first = false;
+    };
+
+    std::fputs("{\"traceEvents\":[", file);
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    for (const auto& buffer : s_buffers) {
+        separator();
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"",
+                     buffer->id);
+        WriteEscaped(file, buffer->name);
+        std::fputs("\"}}", file);
+
+        ForEachRecordedZone(*buffer, [&](const Zone& zone) {
+            if (zone.start < origin) {
+                return;
+            }
+            separator();
+            std::fputs("{\"name\":\"", file);
+            WriteEscaped(file, zone.name);
+            std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         buffer->id, TicksToMs(zone.start - origin) * 1000.0,
+                         TicksToMs(zone.end - zone.start) * 1000.0);
+        });
+    }
+    std::fputs("\n]}\n", file);
+
+    return std::fclose(file) == 0;
+}
+
+Profiler::ScopedZone::ScopedZone(const char* name)
+    : m_name(name) {
+    ++LocalBuffer().depth;
+    m_start = Now();
+}
+
+Profiler::ScopedZone::~ScopedZone() {
+    uint64_t end = Now();
+    ThreadBuffer& buffer = *t_buffer;
+    uint32_t depth = --buffer.depth;
+
+    // 소유 스레드만 쓰므로 인덱스는 relaxed로 읽음
+    // 칸을 "쓰는 중"으로 표시한 뒤 필드를 채우고, 완료 표시와 기록 수를 release로 공개
+    uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    ZoneSlot& slot = buffer.zones[index & (ZONE_CAPACITY - 1)];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(m_name, std::memory_order_relaxed);
+    slot.start.store(m_start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 핫 패스 구간 계측기
+// - 구간 시작/끝은 TSC(x86) 또는 steady_clock 틱으로 기록
+// - 스레드마다 고정 크기 링 버퍼에 기록하고, 읽는 쪽은 칸별 seqlock으로 잠금 없이 복사 (쓰는 스레드는 멈추지 않음)
+// - ENABLE_PROFILER_ZONES가 꺼져 있으면 PROFILE_* 매크로는 아무 코드도 만들지 않음
+class Profiler {
+public:
+    struct Zone {
+        const char* name;       // 문자열 리터럴만 사용 (포인터만 저장)
+        uint64_t start;
+        uint64_t end;
+        uint32_t thread;
+        uint32_t depth;
+    };
+
+    struct ThreadInfo {
+        uint32_t id;
+        std::string name;
+    };
+
+    static uint64_t Now();
+    static double TicksToMs(uint64_t ticks);
+
+    static void SetThreadName(const char* name);
+    // 프레임 경계 표시 (메인 루프 시작마다)
+    static void MarkFrame();
+
+    // 직전에 끝난 프레임 구간과 그 안에서 시작한 구간들 (모든 스레드)
+    static void CollectLastFrame(std::vector<Zone>& zones, uint64_t& frameStart, uint64_t& frameEnd);
+    static std::vector<ThreadInfo> GetThreads();
+
+    // 버퍼에 남아 있는 모든 구간을 Chrome trace(JSON) 형식으로 저장 (chrome://tracing, Perfetto)
+    static bool ExportChromeTrace(const std::string& path);
+
+    class ScopedZone {
+    public:
+        explicit ScopedZone(const char* name);
+        ~ScopedZone();
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t m_start;
+    };
+};
+
+#if defined(ENABLE_PROFILER_ZONES)
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) Profiler::ScopedZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_FRAME() Profiler::MarkFrame()
+#define PROFILE_THREAD(name) Profiler::SetThreadName(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FRAME() ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif